@@ -0,0 +1,90 @@
+// Compiled by build_scripts/Linux_Compare_Swizzle_Modes.sh once with accessor swizzles and once with
+// VISAGE_MATH_SWIZZLE_UNION. Every Probe function does through a swizzle what its Reference function does through
+// the x, y, z and w members, the script fails if a probe compiles to more instructions than its reference. Not part
+// of the Benchmark project.
+
+#include "Math/Math.h"
+
+#ifdef VISAGE_MATH_SWIZZLE_UNION
+	#define VISAGE_SWIZZLE(vector, components) (vector).components
+#else
+	#define VISAGE_SWIZZLE(vector, components) (vector).components()
+#endif
+
+using namespace Visage::Math;
+
+extern "C"
+{
+	void ProbeRead(const Vec4<float>& vector, Vec3<float>& result)
+	{
+		result = VISAGE_SWIZZLE(vector, zyx);
+	}
+
+	void ReferenceRead(const Vec4<float>& vector, Vec3<float>& result)
+	{
+		result = Vec3<float>(vector.z, vector.y, vector.x);
+	}
+
+	void ProbeWrite(Vec4<float>& vector, const Vec2<float>& value)
+	{
+		VISAGE_SWIZZLE(vector, xz) = value;
+	}
+
+	void ReferenceWrite(Vec4<float>& vector, const Vec2<float>& value)
+	{
+		vector.x = value.x;
+		vector.z = value.y;
+	}
+
+	void ProbeAdd(Vec4<float>& vector, const Vec2<float>& value)
+	{
+		VISAGE_SWIZZLE(vector, yw) += value;
+	}
+
+	void ReferenceAdd(Vec4<float>& vector, const Vec2<float>& value)
+	{
+		vector.y += value.x;
+		vector.w += value.y;
+	}
+
+	void ProbeScale(Vec3<double>& vector, double scalar)
+	{
+		VISAGE_SWIZZLE(vector, zx) *= scalar;
+	}
+
+	void ReferenceScale(Vec3<double>& vector, double scalar)
+	{
+		vector.z *= scalar;
+		vector.x *= scalar;
+	}
+
+	void ProbeSwap(Vec4<int>& vector)
+	{
+		VISAGE_SWIZZLE(vector, wzyx) = vector;
+	}
+
+	void ReferenceSwap(Vec4<int>& vector)
+	{
+		Vec4<int> copy = vector;
+		vector.x = copy.w;
+		vector.y = copy.z;
+		vector.z = copy.y;
+		vector.w = copy.x;
+	}
+
+	// Instantiates every vector class the way ordinary code does, for the compile time of the headers
+	float UseVectorTypes(float value)
+	{
+		Vec2<float> a(value);
+		Vec3<float> b(value);
+		Vec4<float> c(value);
+		Vec2<double> d(value);
+		Vec3<double> e(value);
+		Vec4<double> f(value);
+		Vec2<int> g(1);
+		Vec3<int> h(1);
+		Vec4<int> i(1);
+
+		return a.x + b.y + c.z + static_cast<float>(d.x + e.y + f.z) + static_cast<float>(g.x + h.y + i.z);
+	}
+}
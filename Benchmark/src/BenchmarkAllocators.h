@@ -0,0 +1,388 @@
+#pragma once
+
+#include "Core/MemoryManagement/ConcurrentFreeListAllocator.h"
+#include "Core/MemoryManagement/ConcurrentLinearAllocator.h"
+#include "Core/MemoryManagement/ConcurrentPoolAllocator.h"
+#include "Core/MemoryManagement/DoubleEndedStackAllocator.h"
+#include "Core/MemoryManagement/FrameAllocator.h"
+#include "Core/MemoryManagement/FreeListAllocator.h"
+#include "Core/MemoryManagement/LinearAllocator.h"
+#include "Core/MemoryManagement/LockFreePoolAllocator.h"
+#include "Core/MemoryManagement/PoolAllocator.h"
+#include "Core/MemoryManagement/SegregatedFreeListAllocator.h"
+#include "Core/MemoryManagement/SmallObjectAllocator.h"
+#include "Core/MemoryManagement/StackAllocator.h"
+#include "Core/MemoryManagement/StlAllocator.h"
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+
+#ifdef VISAGE_BENCHMARK_JEMALLOC
+	#include <jemalloc/jemalloc.h>
+#endif
+
+#ifdef VISAGE_BENCHMARK_MIMALLOC
+	#include <mimalloc.h>
+#endif
+
+#ifdef _WIN32
+	#include <malloc.h>
+#endif
+
+namespace Visage
+{
+	namespace Benchmark
+	{
+		// Order in which an allocator can take its memory back, decides which patterns it is run with
+		enum class FreeOrder
+		{
+			Any,
+			Lifo,
+			Bulk
+		};
+
+		template <std::size_t Size, std::size_t Align>
+		struct alignas(Align) BenchmarkBlock {
+			unsigned char bytes[Size];
+		};
+
+		// Every benchmark allocator hands out blocks of one size and alignment known at compile time, so the pools
+		// can be measured next to the general purpose allocators and no call goes through a function pointer.
+		// Capacities are in bytes for buffers and in blocks for pools.
+
+		template <typename Allocator>
+		struct AllocatorTraits;
+
+		template <>
+		struct AllocatorTraits<Core::FreeListAllocator>
+		{
+			static const char* GetName() { return "FreeListAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = false;
+			static Core::FreeListAllocator* Create(std::size_t capacity) { return new Core::FreeListAllocator(capacity); }
+			static void Reset(Core::FreeListAllocator& allocator) { }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::SegregatedFreeListAllocator>
+		{
+			static const char* GetName() { return "SegregatedFreeListAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = false;
+			static Core::SegregatedFreeListAllocator* Create(std::size_t capacity) { return new Core::SegregatedFreeListAllocator(capacity); }
+			static void Reset(Core::SegregatedFreeListAllocator& allocator) { }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::ConcurrentFreeListAllocator>
+		{
+			static const char* GetName() { return "ConcurrentFreeListAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = true;
+			static Core::ConcurrentFreeListAllocator* Create(std::size_t capacity) { return new Core::ConcurrentFreeListAllocator(capacity); }
+			static void Reset(Core::ConcurrentFreeListAllocator& allocator) { }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::SmallObjectAllocator>
+		{
+			static const char* GetName() { return "SmallObjectAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = false;
+			static Core::SmallObjectAllocator* Create(std::size_t capacity) { return new Core::SmallObjectAllocator(capacity, capacity); }
+			static void Reset(Core::SmallObjectAllocator& allocator) { }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::StackAllocator>
+		{
+			static const char* GetName() { return "StackAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Lifo;
+			static const bool threadSafe = false;
+			static Core::StackAllocator* Create(std::size_t capacity) { return new Core::StackAllocator(capacity); }
+			static void Reset(Core::StackAllocator& allocator) { }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::DoubleEndedStackAllocator>
+		{
+			static const char* GetName() { return "DoubleEndedStackAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Lifo;
+			static const bool threadSafe = false;
+			static Core::DoubleEndedStackAllocator* Create(std::size_t capacity) { return new Core::DoubleEndedStackAllocator(capacity); }
+			static void Reset(Core::DoubleEndedStackAllocator& allocator) { }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::LinearAllocator>
+		{
+			static const char* GetName() { return "LinearAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Bulk;
+			static const bool threadSafe = false;
+			static Core::LinearAllocator* Create(std::size_t capacity) { return new Core::LinearAllocator(capacity); }
+			static void Reset(Core::LinearAllocator& allocator) { allocator.Reset(); }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::ConcurrentLinearAllocator>
+		{
+			static const char* GetName() { return "ConcurrentLinearAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Bulk;
+			static const bool threadSafe = true;
+			static Core::ConcurrentLinearAllocator* Create(std::size_t capacity) { return new Core::ConcurrentLinearAllocator(capacity, 16 * 1024); }
+			static void Reset(Core::ConcurrentLinearAllocator& allocator) { allocator.Reset(); }
+		};
+
+		template <>
+		struct AllocatorTraits<Core::FrameAllocator>
+		{
+			static const char* GetName() { return "FrameAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Bulk;
+			static const bool threadSafe = true;
+			static Core::FrameAllocator* Create(std::size_t capacity) { return new Core::FrameAllocator(capacity); }
+			static void Reset(Core::FrameAllocator& allocator) { allocator.AdvanceFrame(); }
+		};
+
+		template <typename T>
+		struct AllocatorTraits<Core::PoolAllocator<T>>
+		{
+			static const char* GetName() { return "PoolAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = false;
+			static Core::PoolAllocator<T>* Create(std::size_t capacity) { return new Core::PoolAllocator<T>(capacity); }
+		};
+
+		template <typename T>
+		struct AllocatorTraits<Core::ConcurrentPoolAllocator<T>>
+		{
+			static const char* GetName() { return "ConcurrentPoolAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = true;
+			static Core::ConcurrentPoolAllocator<T>* Create(std::size_t capacity) { return new Core::ConcurrentPoolAllocator<T>(capacity); }
+		};
+
+		template <typename T>
+		struct AllocatorTraits<Core::LockFreePoolAllocator<T>>
+		{
+			static const char* GetName() { return "LockFreePoolAllocator"; }
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = true;
+			static Core::LockFreePoolAllocator<T>* Create(std::size_t capacity) { return new Core::LockFreePoolAllocator<T>(capacity); }
+		};
+
+		// Allocators built on AllocatorInterface, reached through StlAllocator to get at the untyped entry points
+		template <typename Allocator, std::size_t Size, std::size_t Align>
+		class InterfaceBenchmark
+		{
+		private:
+			using Block = BenchmarkBlock<Size, Align>;
+
+			std::unique_ptr<Allocator> allocator;
+			Core::StlAllocator<Block, Allocator> stlAllocator;
+
+		public:
+			static const FreeOrder freeOrder = AllocatorTraits<Allocator>::freeOrder;
+			static const bool threadSafe = AllocatorTraits<Allocator>::threadSafe;
+			static const bool countsBlocks = false;
+
+			static inline const char* GetName()
+			{
+				return AllocatorTraits<Allocator>::GetName();
+			}
+
+			explicit InterfaceBenchmark(std::size_t capacity)
+				: allocator(AllocatorTraits<Allocator>::Create(capacity)), stlAllocator(*allocator)
+			{ }
+
+			inline void* Allocate()
+			{
+				return stlAllocator.allocate(1);
+			}
+
+			inline void Deallocate(void* pointer)
+			{
+				stlAllocator.deallocate(static_cast<Block*>(pointer), 1);
+			}
+
+			inline void Reset()
+			{
+				AllocatorTraits<Allocator>::Reset(*allocator);
+			}
+		};
+
+		template <template <typename> class Pool, std::size_t Size, std::size_t Align>
+		class PoolBenchmark
+		{
+		private:
+			using Block = BenchmarkBlock<Size, Align>;
+
+			std::unique_ptr<Pool<Block>> pool;
+
+		public:
+			static const FreeOrder freeOrder = AllocatorTraits<Pool<Block>>::freeOrder;
+			static const bool threadSafe = AllocatorTraits<Pool<Block>>::threadSafe;
+			static const bool countsBlocks = true;
+
+			static inline const char* GetName()
+			{
+				return AllocatorTraits<Pool<Block>>::GetName();
+			}
+
+			explicit PoolBenchmark(std::size_t capacity)
+				: pool(AllocatorTraits<Pool<Block>>::Create(capacity))
+			{ }
+
+			inline void* Allocate()
+			{
+				return pool->New();
+			}
+
+			inline void Deallocate(void* pointer)
+			{
+				pool->Delete(static_cast<Block*>(pointer));
+			}
+
+			inline void Reset()
+			{ }
+		};
+
+		template <std::size_t Size, std::size_t Align>
+		using FreeListBenchmark = InterfaceBenchmark<Core::FreeListAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using SegregatedFreeListBenchmark = InterfaceBenchmark<Core::SegregatedFreeListAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using ConcurrentFreeListBenchmark = InterfaceBenchmark<Core::ConcurrentFreeListAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using SmallObjectBenchmark = InterfaceBenchmark<Core::SmallObjectAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using StackBenchmark = InterfaceBenchmark<Core::StackAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using DoubleEndedStackBenchmark = InterfaceBenchmark<Core::DoubleEndedStackAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using LinearBenchmark = InterfaceBenchmark<Core::LinearAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using ConcurrentLinearBenchmark = InterfaceBenchmark<Core::ConcurrentLinearAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using FrameBenchmark = InterfaceBenchmark<Core::FrameAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using PoolAllocatorBenchmark = PoolBenchmark<Core::PoolAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using ConcurrentPoolBenchmark = PoolBenchmark<Core::ConcurrentPoolAllocator, Size, Align>;
+
+		template <std::size_t Size, std::size_t Align>
+		using LockFreePoolBenchmark = PoolBenchmark<Core::LockFreePoolAllocator, Size, Align>;
+
+		// System heap baseline
+		template <std::size_t Size, std::size_t Align>
+		class MallocBenchmark
+		{
+		public:
+			static const FreeOrder freeOrder = FreeOrder::Any;
+			static const bool threadSafe = true;
+			static const bool countsBlocks = false;
+
+			static inline const char* GetName()
+			{
+				return "malloc";
+			}
+
+			explicit MallocBenchmark(std::size_t capacity)
+			{ }
+
+			inline void* Allocate()
+			{
+				#ifdef _WIN32
+					return _aligned_malloc(Size, Align);
+				#else
+					return (Align <= alignof(std::max_align_t)) ? std::malloc(Size) : std::aligned_alloc(Align, Size);
+				#endif
+			}
+
+			inline void Deallocate(void* pointer)
+			{
+				#ifdef _WIN32
+					_aligned_free(pointer);
+				#else
+					std::free(pointer);
+				#endif
+			}
+
+			inline void Reset()
+			{ }
+		};
+
+		#ifdef VISAGE_BENCHMARK_JEMALLOC
+			template <std::size_t Size, std::size_t Align>
+			class JemallocBenchmark
+			{
+			public:
+				static const FreeOrder freeOrder = FreeOrder::Any;
+				static const bool threadSafe = true;
+				static const bool countsBlocks = false;
+
+				static inline const char* GetName()
+				{
+					return "jemalloc";
+				}
+
+				explicit JemallocBenchmark(std::size_t capacity)
+				{ }
+
+				inline void* Allocate()
+				{
+					return mallocx(Size, MALLOCX_ALIGN(Align));
+				}
+
+				inline void Deallocate(void* pointer)
+				{
+					sdallocx(pointer, Size, MALLOCX_ALIGN(Align));
+				}
+
+				inline void Reset()
+				{ }
+			};
+		#endif
+
+		#ifdef VISAGE_BENCHMARK_MIMALLOC
+			template <std::size_t Size, std::size_t Align>
+			class MimallocBenchmark
+			{
+			public:
+				static const FreeOrder freeOrder = FreeOrder::Any;
+				static const bool threadSafe = true;
+				static const bool countsBlocks = false;
+
+				static inline const char* GetName()
+				{
+					return "mimalloc";
+				}
+
+				explicit MimallocBenchmark(std::size_t capacity)
+				{ }
+
+				inline void* Allocate()
+				{
+					return mi_malloc_aligned(Size, Align);
+				}
+
+				inline void Deallocate(void* pointer)
+				{
+					mi_free(pointer);
+				}
+
+				inline void Reset()
+				{ }
+			};
+		#endif
+	}
+}
@@ -0,0 +1,147 @@
+#include "BenchmarkReport.h"
+#include <algorithm>
+#include <chrono>
+
+namespace Visage
+{
+	namespace Benchmark
+	{
+		static const int schemaVersion = 1;
+
+		static std::uint32_t GetPercentile(const std::vector<std::uint32_t>& sortedSamples, double percentile)
+		{
+			std::size_t index = static_cast<std::size_t>(percentile * static_cast<double>(sortedSamples.size() - 1) + 0.5);
+			return sortedSamples[std::min(index, sortedSamples.size() - 1)];
+		}
+
+		static void WriteJsonLatencies(std::ostream& stream, const LatencySummary& latencies)
+		{
+			stream << "{\"mean\":" << latencies.mean
+				<< ",\"p50\":" << latencies.p50
+				<< ",\"p90\":" << latencies.p90
+				<< ",\"p99\":" << latencies.p99
+				<< ",\"p999\":" << latencies.p999
+				<< ",\"max\":" << latencies.max << "}";
+		}
+
+		static void WriteCsvLatencies(std::ostream& stream, const LatencySummary& latencies)
+		{
+			stream << latencies.mean << "," << latencies.p50 << "," << latencies.p90 << "," << latencies.p99 << "," << latencies.p999 << "," << latencies.max;
+		}
+
+		LatencySummary SummarizeLatencies(std::vector<std::uint32_t>& samples)
+		{
+			LatencySummary summary;
+
+			if (samples.empty())
+			{
+				return summary;
+			}
+
+			std::sort(samples.begin(), samples.end());
+
+			double sum = 0.0;
+			for (std::uint32_t sample : samples)
+			{
+				sum += sample;
+			}
+
+			summary.mean = sum / static_cast<double>(samples.size());
+			summary.p50 = GetPercentile(samples, 0.5);
+			summary.p90 = GetPercentile(samples, 0.9);
+			summary.p99 = GetPercentile(samples, 0.99);
+			summary.p999 = GetPercentile(samples, 0.999);
+			summary.max = samples.back();
+
+			return summary;
+		}
+
+		double MeasureTimerOverhead()
+		{
+			const int numberOfSamples = 100000;
+
+			std::vector<std::uint32_t> samples;
+			samples.reserve(numberOfSamples);
+
+			for (int i = 0; i < numberOfSamples; i++)
+			{
+				auto start = std::chrono::steady_clock::now();
+				auto finish = std::chrono::steady_clock::now();
+				samples.push_back(static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count()));
+			}
+
+			return SummarizeLatencies(samples).p50;
+		}
+
+		void WriteJson(std::ostream& stream, const BenchmarkReport& report)
+		{
+			stream << "{\"schema\":" << schemaVersion
+				<< ",\"operations\":" << report.operations
+				<< ",\"liveAllocations\":" << report.liveAllocations
+				<< ",\"threads\":" << report.threads
+				<< ",\"timerOverheadNanoseconds\":" << report.timerOverheadNanoseconds
+				<< ",\"results\":[";
+
+			for (std::size_t i = 0; i < report.results.size(); i++)
+			{
+				const BenchmarkResult& result = report.results[i];
+
+				// Names are identifiers chosen by the benchmark, nothing to escape
+				stream << ((i > 0) ? "," : "")
+					<< "{\"allocator\":\"" << result.allocator << "\""
+					<< ",\"pattern\":\"" << result.pattern << "\""
+					<< ",\"size\":" << result.size
+					<< ",\"align\":" << result.align
+					<< ",\"threads\":" << result.threads
+					<< ",\"operations\":" << result.operations
+					<< ",\"seconds\":" << result.seconds
+					<< ",\"operationsPerSecond\":" << result.operationsPerSecond
+					<< ",\"allocateNanoseconds\":";
+
+				WriteJsonLatencies(stream, result.allocate);
+
+				stream << ",\"deallocateNanoseconds\":";
+
+				if (result.hasDeallocate)
+				{
+					WriteJsonLatencies(stream, result.deallocate);
+				}
+				else
+				{
+					stream << "null";
+				}
+
+				stream << "}";
+			}
+
+			stream << "]}" << std::endl;
+		}
+
+		void WriteCsv(std::ostream& stream, const BenchmarkReport& report)
+		{
+			stream << "allocator,pattern,size,align,threads,operations,seconds,operationsPerSecond,"
+				<< "allocateMean,allocateP50,allocateP90,allocateP99,allocateP999,allocateMax,"
+				<< "deallocateMean,deallocateP50,deallocateP90,deallocateP99,deallocateP999,deallocateMax" << std::endl;
+
+			for (const BenchmarkResult& result : report.results)
+			{
+				stream << result.allocator << "," << result.pattern << "," << result.size << "," << result.align << "," << result.threads << ","
+					<< result.operations << "," << result.seconds << "," << result.operationsPerSecond << ",";
+
+				WriteCsvLatencies(stream, result.allocate);
+				stream << ",";
+
+				if (result.hasDeallocate)
+				{
+					WriteCsvLatencies(stream, result.deallocate);
+				}
+				else
+				{
+					stream << ",,,,,";
+				}
+
+				stream << std::endl;
+			}
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace Visage
+{
+	namespace Benchmark
+	{
+		struct LatencySummary {
+			double mean = 0.0;
+			std::uint32_t p50 = 0;
+			std::uint32_t p90 = 0;
+			std::uint32_t p99 = 0;
+			std::uint32_t p999 = 0;
+			std::uint32_t max = 0;
+		};
+
+		struct BenchmarkResult {
+			const char* allocator;
+			const char* pattern;
+			std::size_t size;
+			std::size_t align;
+			unsigned int threads;
+			std::size_t operations;
+			double seconds;
+			double operationsPerSecond;
+			LatencySummary allocate;
+
+			// Bulk allocators free by resetting, they have no per block deallocation latency
+			bool hasDeallocate;
+			LatencySummary deallocate;
+		};
+
+		struct BenchmarkReport {
+			std::size_t operations;
+			std::size_t liveAllocations;
+			unsigned int threads;
+			double timerOverheadNanoseconds;
+			std::vector<BenchmarkResult> results;
+		};
+
+		// Sorts the samples, latencies are in nanoseconds
+		LatencySummary SummarizeLatencies(std::vector<std::uint32_t>& samples);
+
+		// Median cost of reading the clock twice, included in every latency sample
+		double MeasureTimerOverhead();
+
+		// One object with the run settings and an array of results. The format is versioned by "schema", fields are
+		// only ever added, so older tooling keeps reading newer reports.
+		void WriteJson(std::ostream& stream, const BenchmarkReport& report);
+
+		// One row per result, the run settings are left out
+		void WriteCsv(std::ostream& stream, const BenchmarkReport& report);
+	}
+}
@@ -0,0 +1,435 @@
+#pragma once
+
+#include "BenchmarkAllocators.h"
+#include "BenchmarkReport.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace Visage
+{
+	namespace Benchmark
+	{
+		enum class Pattern
+		{
+			// Batches freed in reverse order, the natural order for stacks and scoped temporaries
+			Lifo,
+
+			// Steady state queue, every allocation frees the oldest live block
+			Fifo,
+
+			// Every allocation frees a randomly picked live block, the worst case for free lists
+			Random,
+
+			// Batches released at once by resetting the allocator
+			Bulk,
+
+			// One thread allocates, another frees, blocks cross threads through a queue
+			ProducerConsumer,
+
+			// Every thread runs LIFO batches on the same allocator
+			Contended
+		};
+
+		inline const char* GetPatternName(Pattern pattern)
+		{
+			switch (pattern)
+			{
+				case Pattern::Lifo:
+					return "Lifo";
+				case Pattern::Fifo:
+					return "Fifo";
+				case Pattern::Random:
+					return "Random";
+				case Pattern::Bulk:
+					return "Bulk";
+				case Pattern::ProducerConsumer:
+					return "ProducerConsumer";
+				default:
+					return "Contended";
+			}
+		}
+
+		struct BenchmarkSettings {
+			// Allocations per benchmark, each one is paired with a free
+			std::size_t operations = 200000;
+
+			// Blocks alive at once per thread, also the batch size of the LIFO and bulk patterns
+			std::size_t liveAllocations = 1000;
+
+			// Highest thread count of the contended pattern, which also runs with 1, 2, 4 ... threads below it
+			unsigned int threads = 4;
+
+			// Only allocators whose name contains this are run, all of them if null
+			const char* filter = nullptr;
+		};
+
+		// Calls straight through, used for the throughput pass so the clock does not distort it
+		class ThroughputRecorder
+		{
+		public:
+			inline void Reserve(std::size_t operations)
+			{ }
+
+			template <typename Benchmark>
+			inline void* Allocate(Benchmark& benchmark)
+			{
+				void* pointer = benchmark.Allocate();
+
+				if (pointer == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+
+				return pointer;
+			}
+
+			template <typename Benchmark>
+			inline void Deallocate(Benchmark& benchmark, void* pointer)
+			{
+				benchmark.Deallocate(pointer);
+			}
+		};
+
+		// Times every call on its own, each sample includes the timer overhead reported with the results
+		class LatencyRecorder
+		{
+		private:
+			using Clock = std::chrono::steady_clock;
+
+			static inline std::uint32_t GetNanoseconds(Clock::time_point start, Clock::time_point finish)
+			{
+				return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+			}
+
+		public:
+			std::vector<std::uint32_t> allocateNanoseconds;
+			std::vector<std::uint32_t> deallocateNanoseconds;
+
+			inline void Reserve(std::size_t operations)
+			{
+				allocateNanoseconds.reserve(allocateNanoseconds.size() + operations);
+				deallocateNanoseconds.reserve(deallocateNanoseconds.size() + operations);
+			}
+
+			template <typename Benchmark>
+			inline void* Allocate(Benchmark& benchmark)
+			{
+				Clock::time_point start = Clock::now();
+				void* pointer = benchmark.Allocate();
+				Clock::time_point finish = Clock::now();
+
+				if (pointer == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+
+				allocateNanoseconds.push_back(GetNanoseconds(start, finish));
+				return pointer;
+			}
+
+			template <typename Benchmark>
+			inline void Deallocate(Benchmark& benchmark, void* pointer)
+			{
+				Clock::time_point start = Clock::now();
+				benchmark.Deallocate(pointer);
+				Clock::time_point finish = Clock::now();
+
+				deallocateNanoseconds.push_back(GetNanoseconds(start, finish));
+			}
+		};
+
+		// Writes the block the way a caller would, so allocators that hand out untouched memory pay for it
+		inline void TouchBlock(void* pointer)
+		{
+			*static_cast<volatile unsigned char*>(pointer) = 1;
+		}
+
+		template <typename Benchmark, typename Recorder>
+		void RunLifo(Benchmark& benchmark, Recorder& recorder, std::size_t operations, std::size_t liveAllocations)
+		{
+			std::vector<void*> pointers(liveAllocations);
+
+			for (std::size_t done = 0; done < operations; done += liveAllocations)
+			{
+				std::size_t batchSize = std::min(liveAllocations, operations - done);
+
+				for (std::size_t i = 0; i < batchSize; i++)
+				{
+					pointers[i] = recorder.Allocate(benchmark);
+					TouchBlock(pointers[i]);
+				}
+
+				for (std::size_t i = batchSize; i > 0; i--)
+				{
+					recorder.Deallocate(benchmark, pointers[i - 1]);
+				}
+			}
+		}
+
+		template <typename Benchmark, typename Recorder>
+		void RunBulk(Benchmark& benchmark, Recorder& recorder, std::size_t operations, std::size_t liveAllocations)
+		{
+			for (std::size_t done = 0; done < operations; done += liveAllocations)
+			{
+				std::size_t batchSize = std::min(liveAllocations, operations - done);
+
+				for (std::size_t i = 0; i < batchSize; i++)
+				{
+					TouchBlock(recorder.Allocate(benchmark));
+				}
+
+				benchmark.Reset();
+			}
+		}
+
+		// Random replaces a random live block instead of the oldest one
+		template <typename Benchmark, typename Recorder>
+		void RunSteadyState(Benchmark& benchmark, Recorder& recorder, std::size_t operations, std::size_t liveAllocations, bool random)
+		{
+			std::vector<void*> pointers(std::min(liveAllocations, operations));
+			std::uint32_t randomState = 0x9E3779B9;
+
+			for (std::size_t i = 0; i < pointers.size(); i++)
+			{
+				pointers[i] = recorder.Allocate(benchmark);
+				TouchBlock(pointers[i]);
+			}
+
+			for (std::size_t i = pointers.size(); i < operations; i++)
+			{
+				std::size_t index = i % pointers.size();
+
+				if (random)
+				{
+					// xorshift, cheap enough not to show up next to the allocator
+					randomState ^= randomState << 13;
+					randomState ^= randomState >> 17;
+					randomState ^= randomState << 5;
+					index = randomState % pointers.size();
+				}
+
+				recorder.Deallocate(benchmark, pointers[index]);
+				pointers[index] = recorder.Allocate(benchmark);
+				TouchBlock(pointers[index]);
+			}
+
+			for (std::size_t i = 0; i < pointers.size(); i++)
+			{
+				recorder.Deallocate(benchmark, pointers[(operations + i) % pointers.size()]);
+			}
+		}
+
+		template <typename Benchmark, typename Recorder>
+		void RunProducerConsumer(Benchmark& benchmark, Recorder& producerRecorder, Recorder& consumerRecorder, std::size_t operations, std::size_t liveAllocations)
+		{
+			std::vector<void*> queue(liveAllocations);
+			std::atomic<std::size_t> numberProduced(0);
+			std::atomic<std::size_t> numberConsumed(0);
+
+			std::thread consumer([&]()
+			{
+				for (std::size_t i = 0; i < operations; i++)
+				{
+					while (numberProduced.load(std::memory_order_acquire) == i)
+					{
+						std::this_thread::yield();
+					}
+
+					void* pointer = queue[i % liveAllocations];
+					numberConsumed.store(i + 1, std::memory_order_release);
+					consumerRecorder.Deallocate(benchmark, pointer);
+				}
+			});
+
+			for (std::size_t i = 0; i < operations; i++)
+			{
+				void* pointer = producerRecorder.Allocate(benchmark);
+				TouchBlock(pointer);
+
+				while (i - numberConsumed.load(std::memory_order_acquire) >= liveAllocations)
+				{
+					std::this_thread::yield();
+				}
+
+				queue[i % liveAllocations] = pointer;
+				numberProduced.store(i + 1, std::memory_order_release);
+			}
+
+			consumer.join();
+		}
+
+		template <typename Benchmark, typename Recorder>
+		void RunContended(Benchmark& benchmark, std::vector<Recorder>& recorders, std::size_t operations, std::size_t liveAllocations)
+		{
+			std::vector<std::thread> threads;
+			std::size_t operationsPerThread = operations / recorders.size();
+
+			for (Recorder& recorder : recorders)
+			{
+				threads.emplace_back([&]()
+				{
+					RunLifo(benchmark, recorder, operationsPerThread, liveAllocations);
+				});
+			}
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		class BenchmarkSuite
+		{
+		private:
+			BenchmarkSettings settings;
+			BenchmarkReport& report;
+
+			template <typename Benchmark, typename Recorder>
+			void RunPattern(Benchmark& benchmark, Pattern pattern, std::vector<Recorder>& recorders)
+			{
+				std::size_t operations = settings.operations;
+				std::size_t liveAllocations = settings.liveAllocations;
+
+				for (Recorder& recorder : recorders)
+				{
+					recorder.Reserve(operations);
+				}
+
+				switch (pattern)
+				{
+					case Pattern::Lifo:
+						RunLifo(benchmark, recorders[0], operations, liveAllocations);
+						break;
+					case Pattern::Fifo:
+						RunSteadyState(benchmark, recorders[0], operations, liveAllocations, false);
+						break;
+					case Pattern::Random:
+						RunSteadyState(benchmark, recorders[0], operations, liveAllocations, true);
+						break;
+					case Pattern::Bulk:
+						RunBulk(benchmark, recorders[0], operations, liveAllocations);
+						break;
+					case Pattern::ProducerConsumer:
+						RunProducerConsumer(benchmark, recorders[0], recorders[1], operations, liveAllocations);
+						break;
+					default:
+						RunContended(benchmark, recorders, operations, liveAllocations);
+						break;
+				}
+			}
+
+			template <typename Benchmark, std::size_t Size, std::size_t Align>
+			void RunCase(Pattern pattern, unsigned int numberOfThreads = 1)
+			{
+				numberOfThreads = (pattern == Pattern::ProducerConsumer) ? 2 : numberOfThreads;
+				std::size_t liveBlocks = settings.liveAllocations * (numberOfThreads + 1);
+
+				// Room for every live block with its header and padding, and for the blocks parked in thread caches
+				std::size_t capacity = Benchmark::countsBlocks ? liveBlocks * 2 + 256 * numberOfThreads : liveBlocks * (Size + Align + 64) * 2 + (1 << 20);
+
+				#ifdef VISAGE_MEMORY_CHECKING
+					// Freed blocks stay allocated while they sit in the quarantine
+					capacity += Benchmark::countsBlocks ? 0 : VISAGE_MEMORY_QUARANTINE_SIZE * (Size + Align + 64);
+				#endif
+
+				BenchmarkResult result = {};
+				result.allocator = Benchmark::GetName();
+				result.pattern = GetPatternName(pattern);
+				result.size = Size;
+				result.align = Align;
+				result.threads = numberOfThreads;
+				result.operations = settings.operations;
+				result.hasDeallocate = pattern != Pattern::Bulk;
+
+				try
+				{
+					Benchmark benchmark(capacity);
+
+					// The first pass warms the allocator up and gives the throughput, the second one the latencies
+					std::vector<ThroughputRecorder> throughputRecorders((pattern == Pattern::Contended) ? numberOfThreads : 2);
+					auto start = std::chrono::steady_clock::now();
+					RunPattern(benchmark, pattern, throughputRecorders);
+					auto finish = std::chrono::steady_clock::now();
+
+					result.seconds = std::chrono::duration<double>(finish - start).count();
+					result.operationsPerSecond = static_cast<double>(settings.operations) * (result.hasDeallocate ? 2.0 : 1.0) / result.seconds;
+
+					std::vector<LatencyRecorder> latencyRecorders((pattern == Pattern::Contended) ? numberOfThreads : 2);
+					RunPattern(benchmark, pattern, latencyRecorders);
+
+					std::vector<std::uint32_t> allocateNanoseconds;
+					std::vector<std::uint32_t> deallocateNanoseconds;
+
+					for (LatencyRecorder& recorder : latencyRecorders)
+					{
+						allocateNanoseconds.insert(allocateNanoseconds.end(), recorder.allocateNanoseconds.begin(), recorder.allocateNanoseconds.end());
+						deallocateNanoseconds.insert(deallocateNanoseconds.end(), recorder.deallocateNanoseconds.begin(), recorder.deallocateNanoseconds.end());
+					}
+
+					result.allocate = SummarizeLatencies(allocateNanoseconds);
+					result.deallocate = SummarizeLatencies(deallocateNanoseconds);
+				}
+				catch (const std::bad_alloc&)
+				{
+					std::cerr << result.allocator << " " << result.pattern << " " << Size << "/" << Align << " x" << numberOfThreads << ": out of memory, skipped" << std::endl;
+					return;
+				}
+
+				std::cerr << result.allocator << " " << result.pattern << " " << Size << "/" << Align << " x" << numberOfThreads << ": " << result.operationsPerSecond / 1e6 << " Mops/s" << std::endl;
+				report.results.push_back(result);
+			}
+
+		public:
+			BenchmarkSuite(const BenchmarkSettings& settings, BenchmarkReport& report)
+				: settings(settings), report(report)
+			{ }
+
+			// Runs every pattern the allocator supports with blocks of one size and alignment
+			template <template <std::size_t, std::size_t> class Benchmark, std::size_t Size, std::size_t Align>
+			void Run()
+			{
+				using Instance = Benchmark<Size, Align>;
+
+				if (settings.filter != nullptr && std::strstr(Instance::GetName(), settings.filter) == nullptr)
+				{
+					return;
+				}
+
+				if (Instance::freeOrder == FreeOrder::Bulk)
+				{
+					RunCase<Instance, Size, Align>(Pattern::Bulk);
+					return;
+				}
+
+				RunCase<Instance, Size, Align>(Pattern::Lifo);
+
+				if (Instance::freeOrder == FreeOrder::Any)
+				{
+					RunCase<Instance, Size, Align>(Pattern::Fifo);
+					RunCase<Instance, Size, Align>(Pattern::Random);
+
+					if (Instance::threadSafe)
+					{
+						RunCase<Instance, Size, Align>(Pattern::ProducerConsumer);
+
+						// Doubling the threads up to the limit shows how the allocator scales under contention
+						for (unsigned int numberOfThreads = 1; numberOfThreads < settings.threads; numberOfThreads *= 2)
+						{
+							RunCase<Instance, Size, Align>(Pattern::Contended, numberOfThreads);
+						}
+
+						RunCase<Instance, Size, Align>(Pattern::Contended, settings.threads);
+					}
+				}
+			}
+		};
+	}
+}
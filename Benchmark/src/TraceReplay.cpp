@@ -0,0 +1,140 @@
+#include "TraceReplay.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace Visage
+{
+	namespace Benchmark
+	{
+		TraceReplay::TraceReplay(const Core::AllocationTrace& trace, const char* tag, const char* filter, BenchmarkReport& report)
+			: numberOfSlots(0), numberOfAllocations(0), peakNumberOfLiveBlocks(0), capacity(0), filter(filter), report(report)
+		{
+			struct LiveBlock {
+				std::uint32_t slot;
+				std::size_t size;
+				std::uint32_t align;
+				std::uint16_t tag;
+			};
+
+			std::unordered_map<std::uint64_t, LiveBlock> liveBlocks;
+			std::vector<std::pair<std::uint64_t, LiveBlock>> releasedBlocks;
+			std::size_t liveBytes = 0;
+			std::size_t peakLiveBytes = 0;
+			std::size_t numberOfLiveBlocks = 0;
+			std::size_t largestBlock = 0;
+			std::size_t numberOfUnmatchedFrees = 0;
+
+			auto freeBlock = [&](const LiveBlock& block)
+			{
+				ReplayOperation operation = { block.slot, block.size, block.align, false };
+				operations.push_back(operation);
+				liveBytes -= block.size + block.align;
+				numberOfLiveBlocks--;
+			};
+
+			// Frees the live blocks the predicate picks, latest first like an allocator dropping them at once would
+			auto releaseBlocks = [&](auto isReleased)
+			{
+				releasedBlocks.clear();
+
+				for (const auto& liveBlock : liveBlocks)
+				{
+					if (isReleased(liveBlock.first, liveBlock.second))
+					{
+						releasedBlocks.push_back(liveBlock);
+					}
+				}
+
+				std::sort(releasedBlocks.begin(), releasedBlocks.end(), [](const std::pair<std::uint64_t, LiveBlock>& first, const std::pair<std::uint64_t, LiveBlock>& second)
+				{
+					return first.second.slot > second.second.slot;
+				});
+
+				for (const auto& releasedBlock : releasedBlocks)
+				{
+					freeBlock(releasedBlock.second);
+					liveBlocks.erase(releasedBlock.first);
+				}
+			};
+
+			for (const Core::AllocationTraceEvent& event : trace.GetEvents())
+			{
+				if (tag != nullptr && std::strcmp(trace.GetTagName(event.tag), tag) != 0)
+				{
+					continue;
+				}
+
+				switch (event.type)
+				{
+					case Core::AllocationTraceEventType::Allocate:
+					{
+						// The address was released without a free the trace could see, e.g. by a frame allocator
+						auto liveBlock = liveBlocks.find(event.address);
+						if (liveBlock != liveBlocks.end())
+						{
+							freeBlock(liveBlock->second);
+							liveBlocks.erase(liveBlock);
+						}
+
+						LiveBlock block = { numberOfSlots++, std::max<std::size_t>(event.size, 1), static_cast<std::uint32_t>(event.align), event.tag };
+						liveBlocks.emplace(event.address, block);
+
+						ReplayOperation operation = { block.slot, block.size, block.align, true };
+						operations.push_back(operation);
+						numberOfAllocations++;
+
+						liveBytes += block.size + block.align;
+						peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+						peakNumberOfLiveBlocks = std::max(peakNumberOfLiveBlocks, ++numberOfLiveBlocks);
+						largestBlock = std::max<std::size_t>(largestBlock, block.size + block.align);
+						break;
+					}
+					case Core::AllocationTraceEventType::Deallocate:
+					{
+						auto liveBlock = liveBlocks.find(event.address);
+						if (liveBlock == liveBlocks.end())
+						{
+							numberOfUnmatchedFrees++;
+							break;
+						}
+
+						freeBlock(liveBlock->second);
+						liveBlocks.erase(liveBlock);
+						break;
+					}
+					case Core::AllocationTraceEventType::Reset:
+						releaseBlocks([&](std::uint64_t address, const LiveBlock& block)
+						{
+							return block.tag == event.tag;
+						});
+						break;
+					default:
+						releaseBlocks([&](std::uint64_t address, const LiveBlock& block)
+						{
+							return block.tag == event.tag && address >= event.address && address < event.address + event.size;
+						});
+						break;
+				}
+			}
+
+			// Blocks still alive when the recording stopped
+			releaseBlocks([](std::uint64_t address, const LiveBlock& block)
+			{
+				return true;
+			});
+
+			// Room for the peak of the trace with a header per block, and for fragmentation
+			capacity = peakLiveBytes * 2 + peakNumberOfLiveBlocks * 64 + (16 << 20);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				// Freed blocks stay allocated while they sit in the quarantine
+				capacity += VISAGE_MEMORY_QUARANTINE_SIZE * (largestBlock + 64);
+			#endif
+
+			if (numberOfUnmatchedFrees > 0)
+			{
+				std::cerr << numberOfUnmatchedFrees << " frees of blocks allocated before the recording started are left out" << std::endl;
+			}
+		}
+	}
+}
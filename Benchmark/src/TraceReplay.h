@@ -0,0 +1,287 @@
+#pragma once
+
+#include "BenchmarkAllocators.h"
+#include "BenchmarkReport.h"
+#include "BenchmarkSuite.h"
+#include "Core/MemoryManagement/AllocationTrace.h"
+#include "Core/MemoryManagement/MemoryResource.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Visage
+{
+	namespace Benchmark
+	{
+		// Replays take blocks of any size and alignment, so only allocators that free in any order are replay
+		// targets. Every target hands out blocks through the same two calls.
+
+		template <typename Allocator>
+		class InterfaceReplayTarget
+		{
+		private:
+			std::unique_ptr<Allocator> allocator;
+			Core::MemoryResource<Allocator> memoryResource;
+
+		public:
+			static inline const char* GetName()
+			{
+				return AllocatorTraits<Allocator>::GetName();
+			}
+
+			explicit InterfaceReplayTarget(std::size_t capacity)
+				: allocator(AllocatorTraits<Allocator>::Create(capacity)), memoryResource(*allocator)
+			{ }
+
+			inline void* Allocate(std::size_t size, std::size_t align)
+			{
+				return memoryResource.allocate(size, align);
+			}
+
+			inline void Deallocate(void* pointer, std::size_t size, std::size_t align)
+			{
+				memoryResource.deallocate(pointer, size, align);
+			}
+		};
+
+		class MallocReplayTarget
+		{
+		public:
+			static inline const char* GetName()
+			{
+				return "malloc";
+			}
+
+			explicit MallocReplayTarget(std::size_t capacity)
+			{ }
+
+			inline void* Allocate(std::size_t size, std::size_t align)
+			{
+				#ifdef _WIN32
+					return _aligned_malloc(size, align);
+				#else
+					return (align <= alignof(std::max_align_t)) ? std::malloc(size) : std::aligned_alloc(align, (size + align - 1) & ~(align - 1));
+				#endif
+			}
+
+			inline void Deallocate(void* pointer, std::size_t size, std::size_t align)
+			{
+				#ifdef _WIN32
+					_aligned_free(pointer);
+				#else
+					std::free(pointer);
+				#endif
+			}
+		};
+
+		#ifdef VISAGE_BENCHMARK_JEMALLOC
+			class JemallocReplayTarget
+			{
+			public:
+				static inline const char* GetName()
+				{
+					return "jemalloc";
+				}
+
+				explicit JemallocReplayTarget(std::size_t capacity)
+				{ }
+
+				inline void* Allocate(std::size_t size, std::size_t align)
+				{
+					return mallocx(size, MALLOCX_ALIGN(align));
+				}
+
+				inline void Deallocate(void* pointer, std::size_t size, std::size_t align)
+				{
+					sdallocx(pointer, size, MALLOCX_ALIGN(align));
+				}
+			};
+		#endif
+
+		#ifdef VISAGE_BENCHMARK_MIMALLOC
+			class MimallocReplayTarget
+			{
+			public:
+				static inline const char* GetName()
+				{
+					return "mimalloc";
+				}
+
+				explicit MimallocReplayTarget(std::size_t capacity)
+				{ }
+
+				inline void* Allocate(std::size_t size, std::size_t align)
+				{
+					return mi_malloc_aligned(size, align);
+				}
+
+				inline void Deallocate(void* pointer, std::size_t size, std::size_t align)
+				{
+					mi_free_size_aligned(pointer, size, align);
+				}
+			};
+		#endif
+
+		// Runs a recorded AllocationTrace against other allocators. The trace is turned into a flat list of
+		// operations up front, so the replay itself does no address lookups: every allocation gets a slot and the
+		// frees refer to it. Resets and rewinds become frees of the blocks they released, blocks still alive when
+		// the recording stopped are freed at the end and frees of blocks allocated before it started are dropped.
+		// Events of every thread are replayed on one thread in the order they were recorded. Results use the
+		// "Replay" pattern with size and align 0, the sizes are those of the trace.
+		class TraceReplay
+		{
+		private:
+			struct ReplayOperation {
+				std::uint32_t slot;
+				std::size_t size;
+				std::uint32_t align;
+				bool isAllocation;
+			};
+
+			std::vector<ReplayOperation> operations;
+			std::uint32_t numberOfSlots;
+			std::size_t numberOfAllocations;
+			std::size_t peakNumberOfLiveBlocks;
+			std::size_t capacity;
+			const char* filter;
+			BenchmarkReport& report;
+
+			template <typename Target, typename Recorder>
+			void RunOperations(Target& target, Recorder& recorder, std::vector<void*>& slots)
+			{
+				for (const ReplayOperation& operation : operations)
+				{
+					if (operation.isAllocation)
+					{
+						slots[operation.slot] = recorder.Allocate(target, operation.size, operation.align);
+						TouchBlock(slots[operation.slot]);
+					}
+					else
+					{
+						recorder.Deallocate(target, slots[operation.slot], operation.size, operation.align);
+						slots[operation.slot] = nullptr;
+					}
+				}
+			}
+
+			// Adapts the pattern recorders of the benchmark suite to blocks of any size
+			template <typename Target>
+			class SizedTarget
+			{
+			private:
+				Target& target;
+				std::size_t size;
+				std::size_t align;
+
+			public:
+				SizedTarget(Target& target, std::size_t size, std::size_t align)
+					: target(target), size(size), align(align)
+				{ }
+
+				inline void* Allocate()
+				{
+					return target.Allocate(size, align);
+				}
+
+				inline void Deallocate(void* pointer)
+				{
+					target.Deallocate(pointer, size, align);
+				}
+			};
+
+			template <typename Recorder>
+			class SizedRecorder
+			{
+			private:
+				Recorder& recorder;
+
+			public:
+				explicit SizedRecorder(Recorder& recorder)
+					: recorder(recorder)
+				{ }
+
+				template <typename Target>
+				inline void* Allocate(Target& target, std::size_t size, std::size_t align)
+				{
+					SizedTarget<Target> sizedTarget(target, size, align);
+					return recorder.Allocate(sizedTarget);
+				}
+
+				template <typename Target>
+				inline void Deallocate(Target& target, void* pointer, std::size_t size, std::size_t align)
+				{
+					SizedTarget<Target> sizedTarget(target, size, align);
+					recorder.Deallocate(sizedTarget, pointer);
+				}
+			};
+
+		public:
+			// Prepares the events of the trace, only those of allocators recorded under the tag if it is not null
+			TraceReplay(const Core::AllocationTrace& trace, const char* tag, const char* filter, BenchmarkReport& report);
+
+			inline std::size_t GetNumberOfAllocations() const
+			{
+				return numberOfAllocations;
+			}
+
+			inline std::size_t GetPeakNumberOfLiveBlocks() const
+			{
+				return peakNumberOfLiveBlocks;
+			}
+
+			template <typename Target>
+			void Run()
+			{
+				if (filter != nullptr && std::strstr(Target::GetName(), filter) == nullptr)
+				{
+					return;
+				}
+
+				BenchmarkResult result = {};
+				result.allocator = Target::GetName();
+				result.pattern = "Replay";
+				result.threads = 1;
+				result.operations = numberOfAllocations;
+				result.hasDeallocate = true;
+
+				try
+				{
+					Target target(capacity);
+					std::vector<void*> slots(numberOfSlots, nullptr);
+
+					// The first pass warms the allocator up and gives the throughput, the second one the latencies
+					ThroughputRecorder throughputRecorder;
+					SizedRecorder<ThroughputRecorder> sizedThroughputRecorder(throughputRecorder);
+
+					auto start = std::chrono::steady_clock::now();
+					RunOperations(target, sizedThroughputRecorder, slots);
+					auto finish = std::chrono::steady_clock::now();
+
+					result.seconds = std::chrono::duration<double>(finish - start).count();
+					result.operationsPerSecond = static_cast<double>(operations.size()) / result.seconds;
+
+					LatencyRecorder latencyRecorder;
+					latencyRecorder.Reserve(numberOfAllocations);
+					SizedRecorder<LatencyRecorder> sizedLatencyRecorder(latencyRecorder);
+					RunOperations(target, sizedLatencyRecorder, slots);
+
+					result.allocate = SummarizeLatencies(latencyRecorder.allocateNanoseconds);
+					result.deallocate = SummarizeLatencies(latencyRecorder.deallocateNanoseconds);
+				}
+				catch (const std::bad_alloc&)
+				{
+					std::cerr << result.allocator << " Replay: out of memory, skipped" << std::endl;
+					return;
+				}
+
+				std::cerr << result.allocator << " Replay: " << result.operationsPerSecond / 1e6 << " Mops/s" << std::endl;
+				report.results.push_back(result);
+			}
+		};
+	}
+}
@@ -0,0 +1,207 @@
+#include "BenchmarkAllocators.h"
+#include "BenchmarkReport.h"
+#include "BenchmarkSuite.h"
+#include "TraceReplay.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+using namespace Visage::Benchmark;
+
+// Every allocator with blocks of one size and alignment, the allocators skip the patterns they cannot run
+template <std::size_t Size, std::size_t Align>
+void RunAllocators(BenchmarkSuite& suite)
+{
+	suite.Run<MallocBenchmark, Size, Align>();
+
+	#ifdef VISAGE_BENCHMARK_JEMALLOC
+		suite.Run<JemallocBenchmark, Size, Align>();
+	#endif
+
+	#ifdef VISAGE_BENCHMARK_MIMALLOC
+		suite.Run<MimallocBenchmark, Size, Align>();
+	#endif
+
+	suite.Run<PoolAllocatorBenchmark, Size, Align>();
+	suite.Run<ConcurrentPoolBenchmark, Size, Align>();
+	suite.Run<LockFreePoolBenchmark, Size, Align>();
+	suite.Run<StackBenchmark, Size, Align>();
+	suite.Run<DoubleEndedStackBenchmark, Size, Align>();
+	suite.Run<LinearBenchmark, Size, Align>();
+	suite.Run<ConcurrentLinearBenchmark, Size, Align>();
+	suite.Run<FrameBenchmark, Size, Align>();
+	suite.Run<FreeListBenchmark, Size, Align>();
+	suite.Run<SegregatedFreeListBenchmark, Size, Align>();
+	suite.Run<ConcurrentFreeListBenchmark, Size, Align>();
+	suite.Run<SmallObjectBenchmark, Size, Align>();
+}
+
+// Every allocator that takes blocks of any size and frees them in any order
+void ReplayAllocators(TraceReplay& replay)
+{
+	replay.Run<MallocReplayTarget>();
+
+	#ifdef VISAGE_BENCHMARK_JEMALLOC
+		replay.Run<JemallocReplayTarget>();
+	#endif
+
+	#ifdef VISAGE_BENCHMARK_MIMALLOC
+		replay.Run<MimallocReplayTarget>();
+	#endif
+
+	replay.Run<InterfaceReplayTarget<Visage::Core::FreeListAllocator>>();
+	replay.Run<InterfaceReplayTarget<Visage::Core::SegregatedFreeListAllocator>>();
+	replay.Run<InterfaceReplayTarget<Visage::Core::ConcurrentFreeListAllocator>>();
+	replay.Run<InterfaceReplayTarget<Visage::Core::SmallObjectAllocator>>();
+}
+
+void PrintUsage()
+{
+	std::cerr << "Usage: Benchmark [options]\n"
+		<< "  --format json|csv    Report format written to the output, json by default\n"
+		<< "  --output <path>      Writes the report to a file instead of stdout\n"
+		<< "  --filter <name>      Only runs allocators whose name contains <name>\n"
+		<< "  --operations <n>     Allocations per benchmark, 200000 by default\n"
+		<< "  --live <n>           Blocks alive at once per thread, 1000 by default\n"
+		<< "  --threads <n>        Most threads of the contended pattern, swept from 1 in powers of two, the core count by default\n"
+		<< "  --replay <path>      Replays an allocation trace against the allocators instead of the patterns\n"
+		<< "  --tag <name>         Only replays the events of the allocator recorded under <name>\n"
+		<< "Progress goes to stderr, the report is the only thing written to the output." << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkSettings settings;
+	settings.threads = std::max(2u, std::min(std::thread::hardware_concurrency(), 32u));
+
+	const char* format = "json";
+	const char* outputPath = nullptr;
+	const char* replayPath = nullptr;
+	const char* replayTag = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+		if (value != nullptr && std::strcmp(argv[i], "--format") == 0)
+		{
+			format = value;
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--output") == 0)
+		{
+			outputPath = value;
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--filter") == 0)
+		{
+			settings.filter = value;
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--operations") == 0)
+		{
+			settings.operations = std::strtoull(value, nullptr, 10);
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--live") == 0)
+		{
+			settings.liveAllocations = std::strtoull(value, nullptr, 10);
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--threads") == 0)
+		{
+			settings.threads = static_cast<unsigned int>(std::strtoul(value, nullptr, 10));
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--replay") == 0)
+		{
+			replayPath = value;
+		}
+		else if (value != nullptr && std::strcmp(argv[i], "--tag") == 0)
+		{
+			replayTag = value;
+		}
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		i++;
+	}
+
+	bool validFormat = std::strcmp(format, "json") == 0 || std::strcmp(format, "csv") == 0;
+	bool validSettings = settings.operations > 0 && settings.liveAllocations > 0 && settings.threads > 0 && settings.threads <= 32;
+
+	if (!validFormat || !validSettings)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	BenchmarkReport report;
+	report.operations = settings.operations;
+	report.liveAllocations = settings.liveAllocations;
+	report.threads = settings.threads;
+	report.timerOverheadNanoseconds = MeasureTimerOverhead();
+
+	if (replayPath != nullptr)
+	{
+		Visage::Core::AllocationTrace trace;
+
+		if (!trace.Load(replayPath))
+		{
+			std::cerr << "Cannot load the allocation trace " << replayPath << std::endl;
+			return 1;
+		}
+
+		TraceReplay replay(trace, replayTag, settings.filter, report);
+
+		if (replay.GetNumberOfAllocations() == 0)
+		{
+			std::cerr << "No allocations to replay in " << replayPath << std::endl;
+			return 1;
+		}
+
+		// The replay has no settings of its own, the report carries the shape of the trace
+		report.operations = replay.GetNumberOfAllocations();
+		report.liveAllocations = replay.GetPeakNumberOfLiveBlocks();
+		report.threads = 1;
+
+		ReplayAllocators(replay);
+	}
+	else
+	{
+		BenchmarkSuite suite(settings, report);
+
+		RunAllocators<16, 8>(suite);
+		RunAllocators<64, 8>(suite);
+		RunAllocators<256, 8>(suite);
+		RunAllocators<4096, 8>(suite);
+		RunAllocators<64, 64>(suite);
+		RunAllocators<256, 64>(suite);
+		RunAllocators<4096, 64>(suite);
+	}
+
+	std::ofstream outputFile;
+	if (outputPath != nullptr)
+	{
+		outputFile.open(outputPath);
+
+		if (!outputFile)
+		{
+			std::cerr << "Cannot open " << outputPath << std::endl;
+			return 1;
+		}
+	}
+
+	std::ostream& output = (outputPath != nullptr) ? static_cast<std::ostream&>(outputFile) : std::cout;
+
+	if (std::strcmp(format, "csv") == 0)
+	{
+		WriteCsv(output, report);
+	}
+	else
+	{
+		WriteJson(output, report);
+	}
+
+	return 0;
+}
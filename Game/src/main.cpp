@@ -1,93 +1,187 @@
 #include <Math/Math.h>
 #include "Rendering/RenderWindow.h"
-#include "Core/MemoryManagement/StackAllocator.h"
-#include "Core/MemoryManagement/PoolAllocator.h"
-#include "Core/MemoryManagement/DoubleFrameAllocator.h"
+#include "Core/MemoryManagement/AllocationTrace.h"
+#include "Core/MemoryManagement/FrameAllocator.h"
 #include "Core/MemoryManagement/FreeListAllocator.h"
+#include "Core/MemoryManagement/LockFreePoolAllocator.h"
+#include "Core/MemoryManagement/StlAllocator.h"
+#include "Core/MemoryManagement/MemoryResource.h"
+#include "Core/MemoryManagement/MemoryManager.h"
+#include "Core/MemoryManagement/MemoryTracking.h"
 #include "Math/Vec2.h"
 #include "Rendering/RenderWindow.h"
-#include <chrono>
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
-int main()
+// Hammers a LockFreePoolAllocator from several threads and checks that no chunk is ever handed out twice
+bool RunLockFreePoolStressTest()
 {
-	Visage::Core::FreeListAllocator list(1000 * 1000 * 1000);
-	char* c = list.NewWithArgs<char>('c');
-	int* p = list.NewWithArgs<int>(1);
-	list.Delete(c);
-	list.Delete(p);
+	const std::size_t numberOfChunks = 256;
+	const int iterationsPerThread = 200000;
+	unsigned int numberOfThreads = std::thread::hardware_concurrency();
+	numberOfThreads = (numberOfThreads < 4) ? 4 : numberOfThreads;
 
-	Visage::Core::PoolAllocator<Visage::vec2> allocator(3);
+	Visage::Core::LockFreePoolAllocator<Visage::vec2> pool(numberOfChunks);
 
-	// Record start time
-	auto start = std::chrono::high_resolution_clock::now();
+	// Drain the pool once to find the first chunk so every chunk can be mapped to an ownership flag
+	std::vector<Visage::vec2*> allChunks;
+	for (std::size_t i = 0; i < numberOfChunks; i++)
+	{
+		allChunks.push_back(pool.New());
+	}
+	Visage::vec2* firstChunk = *std::min_element(allChunks.begin(), allChunks.end());
+	for (Visage::vec2* chunk : allChunks)
+	{
+		pool.Delete(chunk);
+	}
 
-	for (int i = 0; i < 100000000; i++)
+	std::vector<std::atomic<bool>> chunkInUse(numberOfChunks);
+	std::atomic<bool> passed(true);
+	std::vector<std::thread> threads;
+
+	for (unsigned int i = 0; i < numberOfThreads; i++)
 	{
-		Visage::vec2* v1 = allocator.NewWithArgs(1, 2);
-		Visage::vec2* v2 = allocator.NewWithArgs(1, 2);
-		Visage::vec2* v3 = allocator.NewWithArgs(1, 2);
+		threads.emplace_back([&]()
+		{
+			Visage::vec2* ownedChunks[8];
+
+			for (int j = 0; j < iterationsPerThread; j++)
+			{
+				int numberOfOwnedChunks = 0;
+
+				for (int k = 0; k < 8; k++)
+				{
+					Visage::vec2* chunk = pool.NewWithArgs(1, 2);
+
+					if (chunk != nullptr)
+					{
+						if (chunkInUse[chunk - firstChunk].exchange(true))
+						{
+							passed = false;
+						}
+
+						ownedChunks[numberOfOwnedChunks++] = chunk;
+					}
+				}
+
+				for (int k = 0; k < numberOfOwnedChunks; k++)
+				{
+					chunkInUse[ownedChunks[k] - firstChunk] = false;
+					pool.Delete(ownedChunks[k]);
+				}
+			}
+		});
+	}
 
-		allocator.Delete(v1);
-		allocator.Delete(v2);
-		allocator.Delete(v3);
+	for (std::thread& thread : threads)
+	{
+		thread.join();
 	}
-	
-	// Record end time
-	auto finish = std::chrono::high_resolution_clock::now();
-	auto ellapsed = finish - start;
-	std::cout << ellapsed.count() / 100000000.0f << std::endl;
 
-	Visage::Core::StackAllocator allocator2(sizeof(Visage::vec2) * 3 + 16 * 3);
+	return passed && pool.GetNumberOfAllocations() == 0;
+}
+
+// Compares Mat3x4<float> products, SIMD when the math-simd option is set, with the scalar Mat3x4<double> ones. The
+// values are small integers so both have to match exactly.
+// The products are kept out of line and their operands are temporaries only the products read. Inlined or
+// fed from matrices that are also read as floats, GCC folds them and hides aliasing problems in the SIMD loads
+#if defined(_MSC_VER)
+	#define GAME_NOINLINE __declspec(noinline)
+#else
+	#define GAME_NOINLINE __attribute__((noinline))
+#endif
+
+GAME_NOINLINE Visage::mat3x4 MultiplyMat3x4(const Visage::mat3x4& left, const Visage::mat3x4& right)
+{
+	return left * right;
+}
+
+GAME_NOINLINE void MultiplyAssignMat3x4(Visage::mat3x4& left, const Visage::mat3x4& right)
+{
+	Visage::mat3x4 result = left;
+	result *= right;
+	left = result;
+}
 
-	// Record start time
-	start = std::chrono::high_resolution_clock::now();
+bool RunMat3x4ProductCheck()
+{
+	#define GAME_LEFT_MATRIX 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12
+	#define GAME_RIGHT_MATRIX 2, 0, 1, 3, 1, 1, 0, -1, 0, 2, 1, 5
 
-	for (int i = 0; i < 100000000; i++)
+	auto matches = [](const Visage::mat3x4& matrix, const Visage::dmat3x4& expected)
 	{
-		Visage::vec2* v1 = allocator2.NewWithArgs<Visage::vec2>(1, 2);
-		Visage::vec2* v2 = allocator2.NewWithArgs<Visage::vec2>(1, 2);
-		Visage::vec2* v3 = allocator2.NewWithArgs<Visage::vec2>(1, 2);
+		for (int row = 0; row < 3; row++)
+		{
+			for (int column = 0; column < 4; column++)
+			{
+				if (static_cast<double>(matrix(row, column)) != expected(row, column))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	};
+
+	const Visage::dmat3x4 left(GAME_LEFT_MATRIX);
+	const Visage::dmat3x4 right(GAME_RIGHT_MATRIX);
+
+	Visage::mat3x4 product(GAME_LEFT_MATRIX);
+	MultiplyAssignMat3x4(product, Visage::mat3x4(GAME_RIGHT_MATRIX));
+
+	const bool passed = matches(MultiplyMat3x4(Visage::mat3x4(GAME_LEFT_MATRIX), Visage::mat3x4(GAME_RIGHT_MATRIX)), left * right) &&
+		matches(MultiplyMat3x4(Visage::mat3x4(GAME_RIGHT_MATRIX), Visage::mat3x4(GAME_LEFT_MATRIX)), right * left) &&
+		matches(product, left * right);
+
+	#undef GAME_LEFT_MATRIX
+	#undef GAME_RIGHT_MATRIX
+
+	return passed;
+}
 
-		allocator2.Delete<Visage::vec2>(v3);
-		allocator2.Delete<Visage::vec2>(v2);
-		allocator2.Delete<Visage::vec2>(v1);
-	}
+int main()
+{
+	Visage::Core::MemoryManager::Initialize();
 
-	// Record end time
-	finish = std::chrono::high_resolution_clock::now();
-	ellapsed = finish - start;
-	std::cout << ellapsed.count() / 100000000.0f << std::endl;
+	#ifdef VISAGE_ALLOCATION_TRACING
+		// Replayed against other allocators with Benchmark --replay AllocationTrace.vtrace
+		Visage::Core::AllocationTrace::Start("AllocationTrace.vtrace");
+	#endif
 
-	// Record start time
-	start = std::chrono::high_resolution_clock::now();
+	Visage::Core::FreeListAllocator list(1000 * 1000 * 1000);
+	char* c = list.NewWithArgs<char>('c');
+	int* p = list.NewWithArgs<int>(1);
+	list.Delete(c);
+	list.Delete(p);
 
-	for (int i = 0; i < 100000; i++)
 	{
-		char* v1 = list.NewArray<char>(64000);
-
-		list.DeleteArray(v1);
+		// Long lived containers in the free list, per frame ones in the frame allocator
+		std::vector<int, Visage::Core::StlAllocator<int, Visage::Core::FreeListAllocator>> persistentNumbers(list);
+		persistentNumbers.assign(1000, 1);
+
+		Visage::Core::FrameAllocator frameAllocator(1024 * 1024);
+		Visage::Core::MemoryResource<Visage::Core::FrameAllocator> frameResource(frameAllocator);
+		std::pmr::vector<std::pmr::string> frameNames(&frameResource);
+		frameNames.emplace_back("Frame allocated string that does not fit in place");
 	}
 
-	// Record end time
-	finish = std::chrono::high_resolution_clock::now();
-	ellapsed = finish - start;
-	std::cout << ellapsed.count() / 100000.0f << std::endl;
+	std::cout << "LockFreePoolAllocator stress test " << (RunLockFreePoolStressTest() ? "passed" : "FAILED") << std::endl;
+	std::cout << "Mat3x4 product check " << (RunMat3x4ProductCheck() ? "passed" : "FAILED") << std::endl;
 
-	// Record start time
-	start = std::chrono::high_resolution_clock::now();
+	std::cout << "Untagged allocations: " << Visage::Core::MemoryManager::GetNumberOfUntaggedAllocations()
+		<< " live, " << Visage::Core::MemoryManager::GetNumberOfFallbackAllocations() << " fell back to malloc" << std::endl;
 
-	for (int i = 0; i < 100000; i++)
-	{
-		char* v1 = new char[64000];
+	Visage::Core::MemoryTracker::WriteJson(std::cout, Visage::Core::MemoryManager::GetInstance().GetFrameIndex());
 
-		delete v1;
-	}
+	#ifdef VISAGE_ALLOCATION_TRACING
+		Visage::Core::AllocationTrace::Stop();
+	#endif
 
-	// Record end time
-	finish = std::chrono::high_resolution_clock::now();
-	ellapsed = finish - start;
-	std::cout << ellapsed.count() / 100000.0f << std::endl;
+	Visage::Core::MemoryManager::Shutdown();
 
 	return 0;
 }
\ No newline at end of file
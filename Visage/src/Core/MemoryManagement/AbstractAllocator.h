@@ -1,5 +1,10 @@
 #pragma once
 
+#include "AllocatorInterface.h"
+#include "MemoryTracking.h"
+#include "MemoryUtils.h"
+#include "VirtualMemory.h"
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cassert>
@@ -9,7 +14,10 @@ namespace Visage
 {
 	namespace Core
 	{
-		class AbstractAllocator
+		// Common buffer and statistics for the single threaded allocators. Derived is the concrete allocator
+		// (CRTP), it provides Allocate/Deallocate and befriends AllocatorInterface<Derived>, no virtual calls involved.
+		template <typename Derived>
+		class AbstractAllocator : public AllocatorInterface<Derived>
 		{
 		protected:
 			std::size_t sizeOfBuffer = 0;
@@ -17,27 +25,192 @@ namespace Visage
 			std::size_t memoryUsed;
 			void* startOfBuffer;
 
-			virtual void* Allocate(std::size_t size, std::uint8_t) = 0;
-			virtual void Deallocate(void*& pointer) = 0;
-			
+			// Allocations past this address have to commit more of the buffer first, the whole buffer is
+			// committed unless it is backed by reserved virtual memory
+			void* endOfCommittedBuffer;
+			BufferBacking backing;
+			int numaNode;
+			VirtualMemoryPolicy virtualMemoryPolicy;
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				AllocationStats stats;
+			#endif
+
+			// size is what the allocation costs the allocator, requestedSize what the caller asked for
+			inline void RecordAllocation(void* address, std::size_t size, std::size_t requestedSize)
+			{
+				memoryUsed += size;
+				numberOfAllocations++;
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					// Allocators without a single buffer report their peak usage as the high-water mark
+					std::size_t endOffset = (startOfBuffer != nullptr) ? PointerDiff(AddToPointer(address, requestedSize), startOfBuffer) : memoryUsed;
+					stats.RecordAllocation(address, size, requestedSize, endOffset);
+				#endif
+			}
+
+			inline void RecordDeallocation(void* address, std::size_t size)
+			{
+				memoryUsed -= size;
+				numberOfAllocations--;
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.RecordDeallocation(address, size);
+				#endif
+			}
+
+			inline void RecordReset()
+			{
+				memoryUsed = 0;
+				numberOfAllocations = 0;
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.RecordReset();
+				#endif
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::RecordReset(static_cast<Derived*>(this));
+				#endif
+			}
+
+			// For allocators that move live allocations, size is what the allocation costs before and after the move
+			inline void RecordMove(void* oldAddress, void* newAddress, std::size_t oldSize, std::size_t newSize)
+			{
+				memoryUsed = memoryUsed - oldSize + newSize;
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.RecordMove(oldAddress, newAddress, oldSize, newSize);
+				#endif
+			}
+
+			// Drops every allocation in [begin, end) at once, restoring the counters saved before they were made
+			inline void RecordRewind(void* begin, void* end, std::size_t previousMemoryUsed, std::size_t previousNumberOfAllocations)
+			{
+				memoryUsed = previousMemoryUsed;
+				numberOfAllocations = previousNumberOfAllocations;
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.RecordRewind(begin, end, previousMemoryUsed, previousNumberOfAllocations);
+				#endif
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::RecordRewind(static_cast<Derived*>(this), begin, end);
+				#endif
+			}
+
+			// Slow path for allocations reaching past the committed part of the buffer
+			bool CommitBufferUpTo(const void* address)
+			{
+				std::size_t requiredSize = PointerDiff(address, startOfBuffer);
+				std::size_t committedSize = PointerDiff(endOfCommittedBuffer, startOfBuffer);
+
+				if (requiredSize > sizeOfBuffer || backing != BufferBacking::ReservedVirtualMemory)
+				{
+					return false; // assert out of memory error
+				}
+
+				std::size_t newCommittedSize = RoundUpToPageSize(std::max(requiredSize, committedSize + virtualMemoryPolicy.commitGranularity));
+				newCommittedSize = std::min(newCommittedSize, sizeOfBuffer);
+
+				if (!CommitVirtualMemory(endOfCommittedBuffer, newCommittedSize - committedSize))
+				{
+					return false;
+				}
+
+				endOfCommittedBuffer = AddToPointer(startOfBuffer, newCommittedSize);
+				return true;
+			}
+
+			// Returns committed pages above the policy's threshold to the OS, called once the buffer is empty
+			void DecommitBuffer()
+			{
+				if (backing != BufferBacking::ReservedVirtualMemory)
+				{
+					return;
+				}
+
+				std::size_t committedSize = PointerDiff(endOfCommittedBuffer, startOfBuffer);
+				std::size_t retainedSize = std::min(RoundUpToPageSize(virtualMemoryPolicy.decommitThreshold), sizeOfBuffer);
+
+				if (committedSize > retainedSize)
+				{
+					DecommitVirtualMemory(AddToPointer(startOfBuffer, retainedSize), committedSize - retainedSize);
+					endOfCommittedBuffer = AddToPointer(startOfBuffer, retainedSize);
+				}
+			}
+
 		public:
 			AbstractAllocator()
-				: startOfBuffer(nullptr), numberOfAllocations(0), memoryUsed(0)
+				: numberOfAllocations(0), memoryUsed(0), startOfBuffer(nullptr), endOfCommittedBuffer(nullptr), backing(BufferBacking::Heap), numaNode(-1)
+				#ifdef VISAGE_MEMORY_TRACKING
+					, stats(&sizeOfBuffer)
+				#endif
 			{ }
 
 			AbstractAllocator(std::size_t size)
-				: sizeOfBuffer(size), numberOfAllocations(0), memoryUsed(0)
+				: sizeOfBuffer(size), numberOfAllocations(0), memoryUsed(0), backing(BufferBacking::Heap), numaNode(-1)
+				#ifdef VISAGE_MEMORY_TRACKING
+					, stats(&sizeOfBuffer)
+				#endif
 			{
 				startOfBuffer = new std::uint8_t[size];
+				endOfCommittedBuffer = AddToPointer(startOfBuffer, size);
+				this->LimitQuarantine(sizeOfBuffer);
+			}
+
+			// Reserves the address range only, pages are committed as allocations reach them
+			AbstractAllocator(std::size_t size, const VirtualMemoryPolicy& policy)
+				: sizeOfBuffer(RoundUpToPageSize(size)), numberOfAllocations(0), memoryUsed(0), backing(BufferBacking::ReservedVirtualMemory),
+				  numaNode(-1), virtualMemoryPolicy(policy)
+				#ifdef VISAGE_MEMORY_TRACKING
+					, stats(&sizeOfBuffer)
+				#endif
+			{
+				startOfBuffer = ReserveVirtualMemory(sizeOfBuffer);
+				assert(startOfBuffer != nullptr);
+				endOfCommittedBuffer = startOfBuffer;
+				this->LimitQuarantine(sizeOfBuffer);
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.SetBacking(backing, numaNode);
+				#endif
+			}
+
+			// Maps the buffer directly from the OS, on huge pages and a NUMA node if the policy asks for them and the
+			// system can provide them. The size may be rounded up to a whole number of (huge) pages.
+			AbstractAllocator(std::size_t size, const PhysicalMemoryPolicy& policy)
+				: sizeOfBuffer(size), numberOfAllocations(0), memoryUsed(0)
+				#ifdef VISAGE_MEMORY_TRACKING
+					, stats(&sizeOfBuffer)
+				#endif
+			{
+				startOfBuffer = MapPhysicalMemory(sizeOfBuffer, policy, backing, numaNode);
+				assert(startOfBuffer != nullptr);
+				endOfCommittedBuffer = AddToPointer(startOfBuffer, sizeOfBuffer);
+				this->LimitQuarantine(sizeOfBuffer);
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.SetBacking(backing, numaNode);
+				#endif
 			}
 
-			virtual ~AbstractAllocator()
+			AbstractAllocator(const AbstractAllocator& allocator) = delete;
+			AbstractAllocator& operator=(const AbstractAllocator& allocator) = delete;
+
+			~AbstractAllocator()
 			{
 				#ifdef DEBUG
 					assert(numberOfAllocations == 0 && memoryUsed == 0);
 				#endif
 				
-				delete startOfBuffer;
+				if (backing == BufferBacking::Heap)
+				{
+					delete[] static_cast<std::uint8_t*>(startOfBuffer);
+				}
+				else
+				{
+					ReleaseVirtualMemory(startOfBuffer, sizeOfBuffer);
+				}
 			}
 			
 			std::size_t GetNumberOfAllocations()
@@ -49,6 +222,46 @@ namespace Visage
 			{
 				return memoryUsed;
 			}
+
+			void* GetStartOfBuffer()
+			{
+				return startOfBuffer;
+			}
+
+			std::size_t GetCommittedSize()
+			{
+				return (backing == BufferBacking::ReservedVirtualMemory) ? PointerDiff(endOfCommittedBuffer, startOfBuffer) : sizeOfBuffer;
+			}
+
+			BufferBacking GetBacking()
+			{
+				return backing;
+			}
+
+			// NUMA node the buffer is bound to, -1 if it is not bound
+			int GetNumaNode()
+			{
+				return numaNode;
+			}
+
+			// Tag the allocator is reported under by the MemoryTracker and in allocation traces, the string has to outlive the allocator
+			inline void SetName(const char* name)
+			{
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.SetName(name);
+				#endif
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::SetAllocatorName(static_cast<Derived*>(this), name);
+				#endif
+			}
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				inline const AllocationStats& GetStats()
+				{
+					return stats;
+				}
+			#endif
 		};
 	}
 }
@@ -0,0 +1,299 @@
+#include "AllocationTrace.h"
+#include <cstdio>
+#include <cstring>
+
+#ifdef VISAGE_ALLOCATION_TRACING
+	#include "ThreadUtils.h"
+	#include <chrono>
+	#include <mutex>
+#endif
+
+namespace Visage
+{
+	namespace Core
+	{
+		#ifdef VISAGE_ALLOCATION_TRACING
+			// The recorder runs inside the allocators, including the one behind operator new, so none of its state
+			// lives on the heap
+			namespace
+			{
+				struct TagSlot {
+					const void* allocator;
+					const char* name;
+					// Whether the name was written to the current file
+					bool isNameWritten;
+				};
+
+				// Open addressed by allocator address, the tag of an allocator is its slot index plus one
+				const std::size_t numberOfTagSlots = 1024;
+
+				const std::size_t numberOfBufferedRecords = 4096;
+
+				struct TraceRecorder {
+					std::mutex mutex;
+					std::FILE* file = nullptr;
+					std::chrono::steady_clock::time_point startTime;
+					TagSlot tagSlots[numberOfTagSlots] = {};
+					std::size_t numberOfBufferedBytes = 0;
+					std::uint8_t buffer[numberOfBufferedRecords * 24];
+
+					// A session that exits without calling Stop still leaves a complete file
+					~TraceRecorder()
+					{
+						if (file != nullptr)
+						{
+							std::fwrite(buffer, 1, numberOfBufferedBytes, file);
+							std::fclose(file);
+							file = nullptr;
+						}
+					}
+				};
+
+				TraceRecorder& GetRecorder()
+				{
+					static TraceRecorder recorder;
+					return recorder;
+				}
+
+				std::size_t HashAllocator(const void* allocator)
+				{
+					std::uint64_t key = reinterpret_cast<std::uintptr_t>(allocator);
+					return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 54);
+				}
+
+				// Slot of the allocator, claiming a free one on first use. Null once every slot is taken.
+				TagSlot* FindTagSlot(TraceRecorder& recorder, const void* allocator)
+				{
+					std::size_t index = HashAllocator(allocator) & (numberOfTagSlots - 1);
+
+					for (std::size_t probe = 0; probe < numberOfTagSlots; probe++)
+					{
+						TagSlot& slot = recorder.tagSlots[(index + probe) & (numberOfTagSlots - 1)];
+
+						if (slot.allocator == allocator)
+						{
+							return &slot;
+						}
+
+						if (slot.allocator == nullptr)
+						{
+							slot.allocator = allocator;
+							return &slot;
+						}
+					}
+
+					return nullptr;
+				}
+
+				void FlushBuffer(TraceRecorder& recorder)
+				{
+					if (recorder.numberOfBufferedBytes > 0)
+					{
+						std::fwrite(recorder.buffer, 1, recorder.numberOfBufferedBytes, recorder.file);
+						recorder.numberOfBufferedBytes = 0;
+					}
+				}
+
+				void WriteBytes(TraceRecorder& recorder, const void* bytes, std::size_t size)
+				{
+					if (size == 0)
+					{
+						return;
+					}
+
+					if (recorder.numberOfBufferedBytes + size > sizeof(recorder.buffer))
+					{
+						FlushBuffer(recorder);
+					}
+
+					std::memcpy(recorder.buffer + recorder.numberOfBufferedBytes, bytes, size);
+					recorder.numberOfBufferedBytes += size;
+				}
+			}
+
+			std::atomic<bool> AllocationTrace::recording(false);
+		#endif
+
+		bool AllocationTrace::Load(const char* path)
+		{
+			events.clear();
+			tagNames.clear();
+
+			std::FILE* file = std::fopen(path, "rb");
+			if (file == nullptr)
+			{
+				return false;
+			}
+
+			FileHeader header;
+			bool isValid = std::fread(&header, sizeof(header), 1, file) == 1 && header.magic == fileMagic && header.version == fileVersion;
+
+			FileRecord record;
+			while (isValid && std::fread(&record, sizeof(record), 1, file) == 1)
+			{
+				std::uint8_t type = record.typeAndAlign & 0x0F;
+
+				if (record.tag >= tagNames.size())
+				{
+					tagNames.resize(record.tag + 1);
+				}
+
+				if (type == nameRecordType)
+				{
+					std::size_t paddedSize = (record.size + sizeof(FileRecord) - 1) / sizeof(FileRecord) * sizeof(FileRecord);
+
+					std::string name(paddedSize, '\0');
+					isValid = paddedSize == 0 || std::fread(&name[0], paddedSize, 1, file) == 1;
+					name.resize(record.size);
+
+					tagNames[record.tag] = name;
+					continue;
+				}
+
+				if (type > static_cast<std::uint8_t>(AllocationTraceEventType::Rewind))
+				{
+					isValid = false;
+					break;
+				}
+
+				AllocationTraceEvent event;
+				event.timestamp = record.timestamp;
+				event.address = record.address;
+				event.size = static_cast<std::size_t>(record.size);
+				event.align = static_cast<std::size_t>(1) << (record.typeAndAlign >> 4);
+				event.tag = record.tag;
+				event.thread = record.thread;
+				event.type = static_cast<AllocationTraceEventType>(type);
+
+				events.push_back(event);
+			}
+
+			std::fclose(file);
+
+			if (!isValid)
+			{
+				events.clear();
+				tagNames.clear();
+			}
+
+			return isValid;
+		}
+
+		#ifdef VISAGE_ALLOCATION_TRACING
+			bool AllocationTrace::Start(const char* path)
+			{
+				Stop();
+
+				TraceRecorder& recorder = GetRecorder();
+				std::lock_guard<std::mutex> lock(recorder.mutex);
+
+				recorder.file = std::fopen(path, "wb");
+				if (recorder.file == nullptr)
+				{
+					return false;
+				}
+
+				FileHeader header;
+				header.magic = fileMagic;
+				header.version = fileVersion;
+				WriteBytes(recorder, &header, sizeof(header));
+
+				// Names are written again the first time each allocator shows up in the new file
+				for (TagSlot& slot : recorder.tagSlots)
+				{
+					slot.isNameWritten = false;
+				}
+
+				recorder.startTime = std::chrono::steady_clock::now();
+				recording.store(true, std::memory_order_relaxed);
+
+				return true;
+			}
+
+			void AllocationTrace::Stop()
+			{
+				TraceRecorder& recorder = GetRecorder();
+				std::lock_guard<std::mutex> lock(recorder.mutex);
+
+				recording.store(false, std::memory_order_relaxed);
+
+				if (recorder.file != nullptr)
+				{
+					FlushBuffer(recorder);
+					std::fclose(recorder.file);
+					recorder.file = nullptr;
+				}
+			}
+
+			void AllocationTrace::SetAllocatorName(const void* allocator, const char* name)
+			{
+				TraceRecorder& recorder = GetRecorder();
+				std::lock_guard<std::mutex> lock(recorder.mutex);
+
+				TagSlot* slot = FindTagSlot(recorder, allocator);
+				if (slot != nullptr)
+				{
+					slot->name = name;
+
+					// Renamed while recording, the next event writes the new name
+					slot->isNameWritten = false;
+				}
+			}
+
+			void AllocationTrace::Record(const void* allocator, AllocationTraceEventType type, const void* address, std::size_t size, std::uint8_t align)
+			{
+				std::uint8_t thread = static_cast<std::uint8_t>(GetCurrentThreadIndex());
+
+				TraceRecorder& recorder = GetRecorder();
+				std::lock_guard<std::mutex> lock(recorder.mutex);
+
+				// Stopped between the caller's check and taking the lock
+				if (recorder.file == nullptr)
+				{
+					return;
+				}
+
+				std::uint64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - recorder.startTime).count();
+
+				TagSlot* slot = FindTagSlot(recorder, allocator);
+				std::uint16_t tag = (slot != nullptr) ? static_cast<std::uint16_t>(slot - recorder.tagSlots + 1) : 0;
+
+				if (slot != nullptr && !slot->isNameWritten)
+				{
+					std::size_t nameLength = (slot->name != nullptr) ? std::strlen(slot->name) : 0;
+
+					FileRecord nameRecord = {};
+					nameRecord.timestamp = timestamp;
+					nameRecord.size = nameLength;
+					nameRecord.tag = tag;
+					nameRecord.thread = thread;
+					nameRecord.typeAndAlign = nameRecordType;
+					WriteBytes(recorder, &nameRecord, sizeof(nameRecord));
+
+					std::size_t paddedSize = (nameLength + sizeof(FileRecord) - 1) / sizeof(FileRecord) * sizeof(FileRecord);
+					std::uint8_t padding[sizeof(FileRecord)] = {};
+
+					WriteBytes(recorder, slot->name, nameLength);
+					WriteBytes(recorder, padding, paddedSize - nameLength);
+
+					slot->isNameWritten = true;
+				}
+
+				std::uint8_t alignShift = 0;
+				while ((static_cast<std::size_t>(1) << alignShift) < align)
+				{
+					alignShift++;
+				}
+
+				FileRecord record = {};
+				record.timestamp = timestamp;
+				record.address = reinterpret_cast<std::uintptr_t>(address);
+				record.size = size;
+				record.tag = tag;
+				record.thread = thread;
+				record.typeAndAlign = static_cast<std::uint8_t>(static_cast<std::uint8_t>(type) | (alignShift << 4));
+				WriteBytes(recorder, &record, sizeof(record));
+			}
+		#endif
+	}
+}
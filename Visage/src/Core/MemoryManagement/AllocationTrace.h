@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef VISAGE_ALLOCATION_TRACING
+	#include <atomic>
+#endif
+
+namespace Visage
+{
+	namespace Core
+	{
+		enum class AllocationTraceEventType : std::uint8_t
+		{
+			Allocate,
+			Deallocate,
+			// Every allocation of the allocator was released at once
+			Reset,
+			// Every allocation of the allocator inside [address, address + size) was released at once
+			Rewind
+		};
+
+		struct AllocationTraceEvent {
+			// Nanoseconds since the recording started
+			std::uint64_t timestamp;
+			std::uint64_t address;
+			std::size_t size;
+			std::size_t align;
+			// Allocator the event belongs to, see AllocationTrace::GetTagName
+			std::uint16_t tag;
+			std::uint8_t thread;
+			AllocationTraceEventType type;
+		};
+
+		// Binary log of every allocation and free made through the allocators, recorded in a game session and
+		// loaded by tools that replay it against other allocators. Recording is compiled in with
+		// VISAGE_ALLOCATION_TRACING and then costs one relaxed load per allocation until Start is called. While
+		// recording, events from every thread are serialized through one lock so the file order is a valid order
+		// to replay them in.
+		class AllocationTrace
+		{
+		private:
+			struct FileHeader {
+				std::uint32_t magic;
+				std::uint32_t version;
+			};
+
+			// Names are stored in records of their own, followed by the name padded to whole records
+			static const std::uint8_t nameRecordType = 0x0F;
+
+			struct FileRecord {
+				std::uint64_t timestamp;
+				std::uint64_t address;
+				// 64 bits wide, rewinds of large buffers and allocations from the backing heap do not fit 32
+				std::uint64_t size;
+				std::uint16_t tag;
+				std::uint8_t thread;
+				// Event type in the low 4 bits, log2 of the alignment in the high 4 bits
+				std::uint8_t typeAndAlign;
+				std::uint8_t padding[4];
+			};
+
+			static_assert(sizeof(FileRecord) == 32, "Trace records are written to the file as they are");
+
+			static const std::uint32_t fileMagic = 0x43525456; // "VTRC"
+			static const std::uint32_t fileVersion = 2;
+
+			std::vector<AllocationTraceEvent> events;
+			std::vector<std::string> tagNames;
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				static std::atomic<bool> recording;
+
+				static void Record(const void* allocator, AllocationTraceEventType type, const void* address, std::size_t size, std::uint8_t align);
+			#endif
+
+		public:
+			AllocationTrace() = default;
+
+			AllocationTrace(const AllocationTrace& trace) = delete;
+			AllocationTrace& operator=(const AllocationTrace& trace) = delete;
+
+			// Reads a whole trace file, replacing the trace loaded before. Returns false if the file cannot be read or
+			// is not a trace of this version.
+			bool Load(const char* path);
+
+			inline const std::vector<AllocationTraceEvent>& GetEvents() const
+			{
+				return events;
+			}
+
+			inline std::size_t GetNumberOfTags() const
+			{
+				return tagNames.size();
+			}
+
+			// Name the allocator had while it was recorded, tag 0 collects the allocators the recorder had no room for
+			inline const char* GetTagName(std::uint16_t tag) const
+			{
+				return (tag < tagNames.size() && !tagNames[tag].empty()) ? tagNames[tag].c_str() : "Unnamed";
+			}
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				// Starts writing every event to the file, stopping the recording in progress. Returns false if the
+				// file cannot be created.
+				static bool Start(const char* path);
+
+				// Writes out the buffered events and closes the file
+				static void Stop();
+
+				static inline bool IsRecording()
+				{
+					return recording.load(std::memory_order_relaxed);
+				}
+
+				// Called by the allocators' SetName, the string has to outlive the allocator
+				static void SetAllocatorName(const void* allocator, const char* name);
+
+				static inline void RecordAllocation(const void* allocator, const void* address, std::size_t size, std::uint8_t align)
+				{
+					if (IsRecording() && address != nullptr)
+					{
+						Record(allocator, AllocationTraceEventType::Allocate, address, size, align);
+					}
+				}
+
+				// Recorded before the memory is released, so no other thread can be handed the address before the free is logged
+				static inline void RecordDeallocation(const void* allocator, const void* address)
+				{
+					if (IsRecording() && address != nullptr)
+					{
+						Record(allocator, AllocationTraceEventType::Deallocate, address, 0, 1);
+					}
+				}
+
+				static inline void RecordReset(const void* allocator)
+				{
+					if (IsRecording())
+					{
+						Record(allocator, AllocationTraceEventType::Reset, nullptr, 0, 1);
+					}
+				}
+
+				static inline void RecordRewind(const void* allocator, const void* begin, const void* end)
+				{
+					if (IsRecording())
+					{
+						Record(allocator, AllocationTraceEventType::Rewind, begin, static_cast<const std::uint8_t*>(end) - static_cast<const std::uint8_t*>(begin), 1);
+					}
+				}
+			#endif
+		};
+	}
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "AllocationTrace.h"
+#include "MemoryChecking.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Visage
+{
+	namespace Core
+	{
+		class AllocatorRef;
+		class MemoryManager;
+
+		template <typename T, typename Allocator>
+		class StlAllocator;
+
+		template <typename Allocator>
+		class MemoryResource;
+
+		// Typed New/Delete front end shared by every allocator. The allocator type provides
+		// void* Allocate(std::size_t size, std::uint8_t align) and void Deallocate(void* pointer), which are
+		// resolved at compile time so the whole allocation path can be inlined into the caller.
+		template <typename Allocator>
+		class AllocatorInterface
+		{
+			friend class AllocatorRef;
+			friend class MemoryManager;
+
+			template <typename T, typename OtherAllocator>
+			friend class StlAllocator;
+
+			friend class MemoryResource<Allocator>;
+
+		private:
+			#ifdef VISAGE_MEMORY_CHECKING
+				MemoryQuarantine quarantine;
+			#endif
+
+			inline Allocator& GetAllocator()
+			{
+				return *static_cast<Allocator*>(this);
+			}
+
+			inline void* AllocateGuarded(std::size_t size, std::uint8_t align)
+			{
+				#ifdef VISAGE_MEMORY_CHECKING
+					if (MemoryCheckTraits<Allocator>::level != MemoryCheckLevel::None)
+					{
+						void* blockAddress = GetAllocator().Allocate(MemoryChecker::GetGuardedSize(size, align), MemoryChecker::GetGuardedAlign(align));
+
+						// Memory held back in the quarantine would still be free in an unchecked build
+						if (blockAddress == nullptr && MemoryCheckTraits<Allocator>::level == MemoryCheckLevel::GuardsAndQuarantine)
+						{
+							FlushQuarantine();
+							blockAddress = GetAllocator().Allocate(MemoryChecker::GetGuardedSize(size, align), MemoryChecker::GetGuardedAlign(align));
+						}
+
+						return (blockAddress != nullptr) ? MemoryChecker::GuardAllocation(blockAddress, size, align) : nullptr;
+					}
+				#endif
+
+				return GetAllocator().Allocate(size, align);
+			}
+
+			inline void DeallocateGuarded(void* pointer)
+			{
+				#ifdef VISAGE_MEMORY_CHECKING
+					if (MemoryCheckTraits<Allocator>::level != MemoryCheckLevel::None && pointer != nullptr)
+					{
+						void* blockAddress = MemoryChecker::CheckDeallocation(pointer);
+
+						if (MemoryCheckTraits<Allocator>::level == MemoryCheckLevel::Guards || !quarantine.Push(pointer, MemoryChecker::GetGuardedBlockSize(pointer)))
+						{
+							GetAllocator().Deallocate(blockAddress);
+							return;
+						}
+
+						while (void* evictedPointer = quarantine.PopExcess())
+						{
+							GetAllocator().Deallocate(MemoryChecker::CheckQuarantinedBlock(evictedPointer));
+						}
+
+						return;
+					}
+				#endif
+
+				GetAllocator().Deallocate(pointer);
+			}
+
+			// Every allocation and free of the interface and the adapters passes through these two
+			inline void* AllocateChecked(std::size_t size, std::uint8_t align)
+			{
+				#ifdef VISAGE_ALLOCATION_TRACING
+					// An AllocatorRef forwards to an allocator that records the event itself
+					if (!std::is_same<Allocator, AllocatorRef>::value && AllocationTrace::IsRecording())
+					{
+						void* pointer = AllocateGuarded(size, align);
+						AllocationTrace::RecordAllocation(&GetAllocator(), pointer, size, align);
+						return pointer;
+					}
+				#endif
+
+				return AllocateGuarded(size, align);
+			}
+
+			inline void DeallocateChecked(void* pointer)
+			{
+				#ifdef VISAGE_ALLOCATION_TRACING
+					if (!std::is_same<Allocator, AllocatorRef>::value)
+					{
+						AllocationTrace::RecordDeallocation(&GetAllocator(), pointer);
+					}
+				#endif
+
+				DeallocateGuarded(pointer);
+			}
+
+			// Untyped entry points for the adapters, Allocate/Deallocate themselves stay hidden in the allocator
+			inline void* AllocateBytes(std::size_t size, std::uint8_t align)
+			{
+				return AllocateChecked(size, align);
+			}
+
+			inline void DeallocateBytes(void* pointer)
+			{
+				DeallocateChecked(pointer);
+			}
+
+			// Number of elements in front of an array that are needed to store its length
+			template <typename T>
+			static constexpr std::size_t NumberOfElementsForOneWord()
+			{
+				return (sizeof(std::size_t) + sizeof(T) - 1) / sizeof(T);
+			}
+
+			static void* AllocateThunk(void* allocator, std::size_t size, std::uint8_t align)
+			{
+				return static_cast<Allocator*>(allocator)->AllocateChecked(size, align);
+			}
+
+			static void DeallocateThunk(void* allocator, void* pointer)
+			{
+				static_cast<Allocator*>(allocator)->DeallocateChecked(pointer);
+			}
+
+		protected:
+			// Lets the quarantine hold back up to 1/VISAGE_MEMORY_QUARANTINE_FRACTION of the allocator's capacity
+			inline void LimitQuarantine(std::size_t capacity)
+			{
+				#ifdef VISAGE_MEMORY_CHECKING
+					quarantine.SetByteLimit(capacity / VISAGE_MEMORY_QUARANTINE_FRACTION);
+				#endif
+			}
+
+		public:
+			template <typename T>
+			T* New()
+			{
+				void* alignedAddress = AllocateChecked(sizeof(T), alignof(T));
+				return (alignedAddress != nullptr) ? new (alignedAddress) T : nullptr;
+			}
+
+			template <typename T, typename... Args>
+			T* NewWithArgs(Args&&... args)
+			{
+				void* alignedAddress = AllocateChecked(sizeof(T), alignof(T));
+				return (alignedAddress != nullptr) ? new (alignedAddress) T(std::forward<Args>(args)...) : nullptr;
+			}
+
+			template <typename T>
+			T* NewArray(std::size_t arrayLength)
+			{
+				const std::size_t numberOfElementsForOneWord = NumberOfElementsForOneWord<T>();
+
+				T* startOfArrayBuffer = reinterpret_cast<T*>(AllocateChecked((arrayLength + numberOfElementsForOneWord) * sizeof(T), alignof(T)));
+				if (startOfArrayBuffer == nullptr)
+				{
+					return nullptr;
+				}
+
+				T* baseArrayAddress = startOfArrayBuffer + numberOfElementsForOneWord;
+				*(reinterpret_cast<std::size_t*>(baseArrayAddress) - 1) = arrayLength;
+
+				for (std::size_t i = 0; i < arrayLength; i++)
+				{
+					new (&baseArrayAddress[i]) T;
+				}
+
+				return baseArrayAddress;
+			}
+
+			template <typename T>
+			void Delete(T* objectToDelete)
+			{
+				objectToDelete->~T();
+				DeallocateChecked(objectToDelete);
+			}
+
+			template <typename T>
+			void DeleteArray(T* arrayToDelete)
+			{
+				std::size_t arrayLength = *(reinterpret_cast<std::size_t*>(arrayToDelete) - 1);
+
+				for (std::size_t i = 0; i < arrayLength; i++)
+				{
+					arrayToDelete[i].~T();
+				}
+
+				DeallocateChecked(arrayToDelete - NumberOfElementsForOneWord<T>());
+			}
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				// Checks and releases every block held back in the quarantine, allocators do this before their destructor
+				// asserts nothing is left allocated
+				void FlushQuarantine()
+				{
+					while (void* pointer = quarantine.Pop())
+					{
+						GetAllocator().Deallocate(MemoryChecker::CheckQuarantinedBlock(pointer));
+					}
+				}
+			#endif
+		};
+	}
+}
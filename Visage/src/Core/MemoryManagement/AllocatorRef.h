@@ -0,0 +1,56 @@
+#pragma once
+
+#include "AllocatorInterface.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Non-owning, type erased handle to any allocator for the few places that need to pick an allocator at
+		// runtime. Costs one indirect call per Allocate/Deallocate, prefer using the allocator type directly.
+		class AllocatorRef : public AllocatorInterface<AllocatorRef>
+		{
+			friend class AllocatorInterface<AllocatorRef>;
+
+		private:
+			void* allocator;
+			void* (*allocateFunction)(void* allocator, std::size_t size, std::uint8_t align);
+			void (*deallocateFunction)(void* allocator, void* pointer);
+
+			inline void* Allocate(std::size_t size, std::uint8_t align)
+			{
+				return allocateFunction(allocator, size, align);
+			}
+
+			inline void Deallocate(void* pointer)
+			{
+				deallocateFunction(allocator, pointer);
+			}
+
+		public:
+			AllocatorRef() = delete;
+
+			template <typename Allocator>
+			AllocatorRef(AllocatorInterface<Allocator>& allocator)
+				: allocator(static_cast<Allocator*>(&allocator)),
+				  allocateFunction(&AllocatorInterface<Allocator>::AllocateThunk),
+				  deallocateFunction(&AllocatorInterface<Allocator>::DeallocateThunk)
+			{ }
+
+			AllocatorRef(const AllocatorRef& allocatorRef) = default;
+			AllocatorRef& operator=(const AllocatorRef& allocatorRef) = default;
+
+			friend bool operator==(const AllocatorRef& leftAllocator, const AllocatorRef& rightAllocator)
+			{
+				return leftAllocator.allocator == rightAllocator.allocator;
+			}
+
+			friend bool operator!=(const AllocatorRef& leftAllocator, const AllocatorRef& rightAllocator)
+			{
+				return !(leftAllocator == rightAllocator);
+			}
+		};
+	}
+}
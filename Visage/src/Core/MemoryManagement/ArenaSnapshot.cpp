@@ -0,0 +1,257 @@
+#include "ArenaSnapshot.h"
+#include "MemoryUtils.h"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Visage
+{
+	namespace Core
+	{
+		static const std::uint64_t nullOffset = ~static_cast<std::uint64_t>(0);
+
+		ArenaSnapshot::ArenaSnapshot()
+			: mapping(nullptr), sizeOfMapping(0), startOfArena(nullptr), sizeOfArena(0), root(nullptr)
+			#ifdef _WIN32
+				, fileMappingHandle(nullptr)
+			#endif
+		{ }
+
+		ArenaSnapshot::~ArenaSnapshot()
+		{
+			Unmap();
+		}
+
+		bool ArenaSnapshot::Write(const char* path, const void* startOfArena, const void* endOfArena, const ArenaRelocationTable& relocations, const void* root)
+		{
+			const std::size_t arenaSize = PointerDiff(endOfArena, startOfArena);
+
+			// Offsets of the non-null pointer fields in file order, null pointers are written as they are
+			std::vector<std::uint64_t> relocationOffsets;
+			relocationOffsets.reserve(relocations.pointerFields.size());
+
+			// Fields or pointees outside the arena would stream memory past it or write offsets Map rejects, so they
+			// fail the write in release builds too. Addresses below the arena wrap around to large offsets.
+			for (const void* pointerField : relocations.pointerFields)
+			{
+				const std::size_t fieldOffset = PointerDiff(pointerField, startOfArena);
+				if (arenaSize < sizeof(void*) || fieldOffset > arenaSize - sizeof(void*))
+				{
+					return false;
+				}
+
+				const void* pointee = *static_cast<const void* const*>(pointerField);
+				if (pointee != nullptr)
+				{
+					if (PointerDiff(pointee, startOfArena) > arenaSize)
+					{
+						return false;
+					}
+
+					relocationOffsets.push_back(fieldOffset);
+				}
+			}
+
+			if (root != nullptr && PointerDiff(root, startOfArena) >= arenaSize)
+			{
+				return false;
+			}
+
+			std::sort(relocationOffsets.begin(), relocationOffsets.end());
+			relocationOffsets.erase(std::unique(relocationOffsets.begin(), relocationOffsets.end()), relocationOffsets.end());
+
+			// Overlapping fields cannot both be written as offsets, streaming them would run the write position backwards
+			for (std::size_t i = 1; i < relocationOffsets.size(); i++)
+			{
+				if (relocationOffsets[i] - relocationOffsets[i - 1] < sizeof(void*))
+				{
+					return false;
+				}
+			}
+
+			FileHeader header;
+			header.magic = fileMagic;
+			header.version = fileVersion;
+			header.sizeOfArena = arenaSize;
+			header.numberOfRelocations = relocationOffsets.size();
+			header.rootOffset = (root != nullptr) ? PointerDiff(root, startOfArena) : nullOffset;
+
+			// The mapping starts on a page boundary, offsetting the data by the arena's misalignment keeps every
+			// allocation as aligned as it was in the arena
+			std::size_t tableEnd = sizeof(FileHeader) + relocationOffsets.size() * sizeof(std::uint64_t);
+			header.dataOffset = ((tableEnd + maximumAlignment - 1) & ~(maximumAlignment - 1)) + (reinterpret_cast<std::uintptr_t>(startOfArena) & (maximumAlignment - 1));
+
+			std::FILE* file = std::fopen(path, "wb");
+			if (file == nullptr)
+			{
+				return false;
+			}
+
+			bool written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+			written = written && (relocationOffsets.empty() || std::fwrite(relocationOffsets.data(), sizeof(std::uint64_t), relocationOffsets.size(), file) == relocationOffsets.size());
+
+			const std::uint8_t padding[maximumAlignment * 2] = {};
+			written = written && std::fwrite(padding, 1, header.dataOffset - tableEnd, file) == header.dataOffset - tableEnd;
+
+			// Stream the arena, writing relocated fields as offsets instead of copying it to patch them
+			std::size_t writtenSize = 0;
+			for (std::uint64_t relocationOffset : relocationOffsets)
+			{
+				std::uint64_t pointerOffset = PointerDiff(*reinterpret_cast<void* const*>(AddToPointer(startOfArena, relocationOffset)), startOfArena);
+
+				written = written && std::fwrite(AddToPointer(startOfArena, writtenSize), 1, relocationOffset - writtenSize, file) == relocationOffset - writtenSize;
+				written = written && std::fwrite(&pointerOffset, sizeof(pointerOffset), 1, file) == 1;
+				writtenSize = relocationOffset + sizeof(pointerOffset);
+			}
+
+			written = written && std::fwrite(AddToPointer(startOfArena, writtenSize), 1, arenaSize - writtenSize, file) == arenaSize - writtenSize;
+
+			return (std::fclose(file) == 0) && written;
+		}
+
+		bool ArenaSnapshot::Write(const char* path, LinearAllocator& arena, const ArenaRelocationTable& relocations, const void* root)
+		{
+			return Write(path, arena.GetStartOfBuffer(), arena.GetCurrentPosition(), relocations, root);
+		}
+
+		bool ArenaSnapshot::Write(const char* path, StackAllocator& arena, const ArenaRelocationTable& relocations, const void* root)
+		{
+			return Write(path, arena.GetStartOfBuffer(), arena.GetTopOfStack(), relocations, root);
+		}
+
+		bool ArenaSnapshot::Map(const char* path)
+		{
+			static_assert(sizeof(void*) == sizeof(std::uint64_t), "Snapshots store pointers as 64 bit offsets");
+
+			Unmap();
+
+			#ifdef _WIN32
+				HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				if (file == INVALID_HANDLE_VALUE)
+				{
+					return false;
+				}
+
+				LARGE_INTEGER fileSize;
+				HANDLE fileMapping = GetFileSizeEx(file, &fileSize) ? CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr) : nullptr;
+				CloseHandle(file);
+
+				if (fileMapping == nullptr)
+				{
+					return false;
+				}
+
+				// Copy-on-write, the fix-ups only touch the pages holding pointers and never reach the file
+				mapping = MapViewOfFile(fileMapping, FILE_MAP_COPY, 0, 0, 0);
+				if (mapping == nullptr)
+				{
+					CloseHandle(fileMapping);
+					return false;
+				}
+
+				fileMappingHandle = fileMapping;
+				sizeOfMapping = static_cast<std::size_t>(fileSize.QuadPart);
+			#else
+				int file = open(path, O_RDONLY);
+				if (file < 0)
+				{
+					return false;
+				}
+
+				struct stat fileStatus;
+				void* fileMapping = MAP_FAILED;
+
+				if (fstat(file, &fileStatus) == 0 && fileStatus.st_size > 0)
+				{
+					// Copy-on-write, the fix-ups only touch the pages holding pointers and never reach the file
+					fileMapping = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+				}
+
+				close(file);
+
+				if (fileMapping == MAP_FAILED)
+				{
+					return false;
+				}
+
+				mapping = fileMapping;
+				sizeOfMapping = static_cast<std::size_t>(fileStatus.st_size);
+			#endif
+
+			const FileHeader* header = static_cast<const FileHeader*>(mapping);
+
+			// Snapshot files are untrusted input, everything the fix-ups touch is bounds checked in release builds too
+			if (sizeOfMapping < sizeof(FileHeader) || header->magic != fileMagic || header->version != fileVersion ||
+				header->numberOfRelocations > (sizeOfMapping - sizeof(FileHeader)) / sizeof(std::uint64_t) ||
+				header->dataOffset < sizeof(FileHeader) + header->numberOfRelocations * sizeof(std::uint64_t) ||
+				header->dataOffset > sizeOfMapping || header->sizeOfArena > sizeOfMapping - header->dataOffset ||
+				(header->rootOffset != nullOffset && header->rootOffset >= header->sizeOfArena))
+			{
+				Unmap();
+				return false;
+			}
+
+			startOfArena = AddToPointer(mapping, header->dataOffset);
+			sizeOfArena = header->sizeOfArena;
+			root = (header->rootOffset != nullOffset) ? AddToPointer(startOfArena, header->rootOffset) : nullptr;
+
+			const std::uint64_t* relocationOffsets = reinterpret_cast<const std::uint64_t*>(header + 1);
+			const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(startOfArena);
+
+			for (std::uint64_t i = 0; i < header->numberOfRelocations; i++)
+			{
+				if (sizeOfArena < sizeof(std::uintptr_t) || relocationOffsets[i] > sizeOfArena - sizeof(std::uintptr_t))
+				{
+					Unmap();
+					return false;
+				}
+
+				std::uintptr_t* pointerField = reinterpret_cast<std::uintptr_t*>(base + relocationOffsets[i]);
+
+				// A stored offset may point one past the end of the arena, like the end pointer of a range
+				if (*pointerField > sizeOfArena)
+				{
+					Unmap();
+					return false;
+				}
+
+				*pointerField += base;
+			}
+
+			return true;
+		}
+
+		void ArenaSnapshot::Unmap()
+		{
+			if (mapping == nullptr)
+			{
+				return;
+			}
+
+			#ifdef _WIN32
+				UnmapViewOfFile(mapping);
+				CloseHandle(fileMappingHandle);
+				fileMappingHandle = nullptr;
+			#else
+				munmap(mapping, sizeOfMapping);
+			#endif
+
+			mapping = nullptr;
+			sizeOfMapping = 0;
+			startOfArena = nullptr;
+			sizeOfArena = 0;
+			root = nullptr;
+		}
+	}
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "LinearAllocator.h"
+#include "StackAllocator.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Pointer fields inside an arena that point back into the same arena. They are written to a snapshot as
+		// offsets from the start of the arena and turned back into pointers when the snapshot is mapped.
+		class ArenaRelocationTable
+		{
+			friend class ArenaSnapshot;
+
+		private:
+			std::vector<const void*> pointerFields;
+
+		public:
+			template <typename T>
+			inline void AddPointer(T* const* pointerField)
+			{
+				pointerFields.push_back(pointerField);
+			}
+
+			inline void Clear()
+			{
+				pointerFields.clear();
+			}
+
+			inline std::size_t GetNumberOfPointers() const
+			{
+				return pointerFields.size();
+			}
+		};
+
+		// The used part of a LinearAllocator or StackAllocator saved to a file and mapped back in copy-on-write.
+		// Loading costs one mapping plus one fix-up per pointer in the relocation table, the objects themselves are
+		// neither parsed nor constructed, so only trivially copyable data without pointers outside the arena
+		// belongs in a snapshot.
+		class ArenaSnapshot
+		{
+		private:
+			struct FileHeader {
+				std::uint32_t magic;
+				std::uint32_t version;
+				std::uint64_t sizeOfArena;
+				std::uint64_t numberOfRelocations;
+				std::uint64_t rootOffset;
+				std::uint64_t dataOffset;
+			};
+
+			static const std::uint32_t fileMagic = 0x504e5356; // "VSNP"
+			static const std::uint32_t fileVersion = 1;
+
+			// Snapshots keep the arena's address modulo this, so allocations aligned up to it stay aligned
+			static const std::size_t maximumAlignment = 128;
+
+			void* mapping;
+			std::size_t sizeOfMapping;
+			void* startOfArena;
+			std::size_t sizeOfArena;
+			void* root;
+
+			#ifdef _WIN32
+				void* fileMappingHandle;
+			#endif
+
+		public:
+			ArenaSnapshot();
+
+			ArenaSnapshot(const ArenaSnapshot& snapshot) = delete;
+			ArenaSnapshot& operator=(const ArenaSnapshot& snapshot) = delete;
+
+			~ArenaSnapshot();
+
+			// Writes [startOfArena, endOfArena) to the file. Every pointer registered in the relocation table has to be
+			// null or point into the range, root is handed back by GetRoot after loading. Returns false on I/O errors,
+			// when two registered pointer fields overlap and when a field, its pointee or root is outside the range.
+			static bool Write(const char* path, const void* startOfArena, const void* endOfArena, const ArenaRelocationTable& relocations, const void* root);
+
+			static bool Write(const char* path, LinearAllocator& arena, const ArenaRelocationTable& relocations, const void* root);
+
+			static bool Write(const char* path, StackAllocator& arena, const ArenaRelocationTable& relocations, const void* root);
+
+			// Maps the snapshot and fixes up its pointers, replacing any snapshot mapped before. Returns false if the
+			// file cannot be mapped or is not a snapshot of this version.
+			bool Map(const char* path);
+
+			void Unmap();
+
+			inline bool IsMapped() const
+			{
+				return mapping != nullptr;
+			}
+
+			template <typename T>
+			inline T* GetRoot() const
+			{
+				return static_cast<T*>(root);
+			}
+
+			inline void* GetStartOfArena() const
+			{
+				return startOfArena;
+			}
+
+			inline std::size_t GetSizeOfArena() const
+			{
+				return sizeOfArena;
+			}
+		};
+	}
+}
@@ -0,0 +1,236 @@
+#include "ConcurrentFreeListAllocator.h"
+#include "MemoryUtils.h"
+
+namespace Visage
+{
+	namespace Core
+	{
+		ConcurrentFreeListAllocator::ConcurrentFreeListAllocator(std::size_t size, std::size_t objectsPerMagazine)
+			: chunksPerMagazine(objectsPerMagazine), depot(size)
+			#ifdef VISAGE_MEMORY_TRACKING
+				, stats(&depot.sizeOfBuffer)
+			#endif
+		{
+			assert(objectsPerMagazine > 0);
+			LimitQuarantine(size);
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				depot.SetName("ConcurrentFreeListAllocator depot");
+				stats.SetBacking(depot.backing, depot.numaNode);
+			#endif
+		}
+
+		ConcurrentFreeListAllocator::~ConcurrentFreeListAllocator()
+		{
+			#ifdef VISAGE_MEMORY_CHECKING
+				FlushQuarantine();
+			#endif
+
+			#ifdef DEBUG
+				assert(GetNumberOfAllocations() == 0 && GetMemoryUsed() == 0);
+			#endif
+
+			for (void* slab : slabs)
+			{
+				depot.Deallocate(slab);
+			}
+		}
+
+		std::size_t ConcurrentFreeListAllocator::GetNumberOfAllocations()
+		{
+			std::int64_t numberOfAllocations = 0;
+
+			for (std::size_t i = 0; i < maximumNumberOfThreads; i++)
+			{
+				numberOfAllocations += threadCaches[i].numberOfAllocations.load(std::memory_order_relaxed);
+			}
+
+			return static_cast<std::size_t>(numberOfAllocations);
+		}
+
+		std::size_t ConcurrentFreeListAllocator::GetMemoryUsed()
+		{
+			std::int64_t memoryUsed = 0;
+
+			for (std::size_t i = 0; i < maximumNumberOfThreads; i++)
+			{
+				memoryUsed += threadCaches[i].memoryUsed.load(std::memory_order_relaxed);
+			}
+
+			return static_cast<std::size_t>(memoryUsed);
+		}
+
+		bool ConcurrentFreeListAllocator::Owns(const void* pointer)
+		{
+			return PointerDiff(pointer, depot.startOfBuffer) < depot.sizeOfBuffer;
+		}
+
+		bool ConcurrentFreeListAllocator::RefillMagazine(Magazine& magazine, std::size_t sizeClass)
+		{
+			std::lock_guard<std::mutex> lock(depotMutex);
+
+			if (!fullMagazines[sizeClass].empty())
+			{
+				magazine = fullMagazines[sizeClass].back();
+				fullMagazines[sizeClass].pop_back();
+				return true;
+			}
+
+			// No magazine to reuse, carve a new one out of a single depot block
+			std::size_t chunkSize = GetChunkSize(sizeClass);
+			void* slab = depot.Allocate(chunkSize * chunksPerMagazine, sizeClassGranularity);
+
+			if (slab == nullptr)
+			{
+				return false; // assert out of memory error
+			}
+
+			slabs.push_back(slab);
+
+			ChunkNode* currentChunkNode = reinterpret_cast<ChunkNode*>(slab);
+			for (std::size_t i = 1; i < chunksPerMagazine; i++)
+			{
+				ChunkNode* nextChunk = reinterpret_cast<ChunkNode*>(AddToPointer(currentChunkNode, chunkSize));
+				currentChunkNode->nextFreeChunk = nextChunk;
+				currentChunkNode = nextChunk;
+			}
+			currentChunkNode->nextFreeChunk = nullptr;
+
+			magazine.freeChunkNodeList = reinterpret_cast<ChunkNode*>(slab);
+			magazine.numberOfChunks = chunksPerMagazine;
+
+			return true;
+		}
+
+		void ConcurrentFreeListAllocator::DrainMagazine(Magazine& magazine, std::size_t sizeClass)
+		{
+			// Keep one magazine worth of chunks for the next allocations and hand a full one back to the depot
+			ChunkNode* lastChunkToReturn = magazine.freeChunkNodeList;
+			for (std::size_t i = 1; i < chunksPerMagazine; i++)
+			{
+				lastChunkToReturn = lastChunkToReturn->nextFreeChunk;
+			}
+
+			Magazine fullMagazine = { magazine.freeChunkNodeList, chunksPerMagazine };
+			magazine.freeChunkNodeList = lastChunkToReturn->nextFreeChunk;
+			magazine.numberOfChunks -= chunksPerMagazine;
+			lastChunkToReturn->nextFreeChunk = nullptr;
+
+			std::lock_guard<std::mutex> lock(depotMutex);
+			fullMagazines[sizeClass].push_back(fullMagazine);
+		}
+
+		void* ConcurrentFreeListAllocator::Allocate(std::size_t size, std::uint8_t align)
+		{
+			ThreadCache& threadCache = threadCaches[GetCurrentThreadIndex()];
+
+			std::size_t sizeClass = largeSizeClass;
+			if (align <= sizeClassGranularity && size <= numberOfSizeClasses * sizeClassGranularity)
+			{
+				sizeClass = (size > 0) ? (size - 1) / sizeClassGranularity : 0;
+			}
+
+			void* alignedAddress = nullptr;
+			AllocationHeader* header = nullptr;
+			std::size_t allocationSize = 0;
+
+			if (sizeClass != largeSizeClass)
+			{
+				Magazine& magazine = threadCache.sizeClasses[sizeClass];
+
+				if (magazine.freeChunkNodeList == nullptr && !RefillMagazine(magazine, sizeClass))
+				{
+					return nullptr;
+				}
+
+				ChunkNode* chunk = magazine.freeChunkNodeList;
+				magazine.freeChunkNodeList = chunk->nextFreeChunk;
+				magazine.numberOfChunks--;
+
+				header = reinterpret_cast<AllocationHeader*>(chunk);
+				header->baseAddress = chunk;
+				alignedAddress = AddToPointer(chunk, allocationHeaderSize);
+				allocationSize = GetChunkSize(sizeClass);
+			}
+			else
+			{
+				std::uint8_t alignment = (align > sizeClassGranularity) ? align : sizeClassGranularity;
+				void* baseAddress = nullptr;
+
+				{
+					std::lock_guard<std::mutex> lock(depotMutex);
+					baseAddress = depot.Allocate(size + allocationHeaderSize + (alignment - sizeClassGranularity), sizeClassGranularity);
+
+					if (baseAddress == nullptr)
+					{
+						return nullptr; // assert out of memory error
+					}
+
+					allocationSize = SegregatedFreeListAllocator::GetBlockSize(SegregatedFreeListAllocator::GetBlockFromData(baseAddress));
+				}
+
+				alignedAddress = AlignPointer(AddToPointer(baseAddress, allocationHeaderSize), alignment);
+				header = reinterpret_cast<AllocationHeader*>(SubtractFromPointer(alignedAddress, allocationHeaderSize));
+				header->baseAddress = baseAddress;
+			}
+
+			header->sizeClass = sizeClass;
+
+			threadCache.numberOfAllocations.store(threadCache.numberOfAllocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			threadCache.memoryUsed.store(threadCache.memoryUsed.load(std::memory_order_relaxed) + allocationSize, std::memory_order_relaxed);
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				{
+					std::lock_guard<std::mutex> lock(statsMutex);
+					stats.RecordAllocation(alignedAddress, allocationSize, size, PointerDiff(AddToPointer(alignedAddress, size), depot.startOfBuffer));
+				}
+			#endif
+
+			return alignedAddress;
+		}
+
+		void ConcurrentFreeListAllocator::Deallocate(void* pointer)
+		{
+			ThreadCache& threadCache = threadCaches[GetCurrentThreadIndex()];
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubtractFromPointer(pointer, allocationHeaderSize));
+			std::size_t sizeClass = header->sizeClass;
+			std::size_t allocationSize = 0;
+
+			if (sizeClass != largeSizeClass)
+			{
+				assert(sizeClass < numberOfSizeClasses);
+
+				Magazine& magazine = threadCache.sizeClasses[sizeClass];
+				ChunkNode* newChunkNode = reinterpret_cast<ChunkNode*>(header->baseAddress);
+				newChunkNode->nextFreeChunk = magazine.freeChunkNodeList;
+				magazine.freeChunkNodeList = newChunkNode;
+				magazine.numberOfChunks++;
+				allocationSize = GetChunkSize(sizeClass);
+
+				if (magazine.numberOfChunks >= chunksPerMagazine * 2)
+				{
+					DrainMagazine(magazine, sizeClass);
+				}
+			}
+			else
+			{
+				void* baseAddress = header->baseAddress;
+
+				std::lock_guard<std::mutex> lock(depotMutex);
+				allocationSize = SegregatedFreeListAllocator::GetBlockSize(SegregatedFreeListAllocator::GetBlockFromData(baseAddress));
+				depot.Deallocate(baseAddress);
+			}
+
+			threadCache.numberOfAllocations.store(threadCache.numberOfAllocations.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+			threadCache.memoryUsed.store(threadCache.memoryUsed.load(std::memory_order_relaxed) - allocationSize, std::memory_order_relaxed);
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				{
+					std::lock_guard<std::mutex> lock(statsMutex);
+					stats.RecordDeallocation(pointer, allocationSize);
+				}
+			#endif
+		}
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "AllocatorInterface.h"
+#include "SegregatedFreeListAllocator.h"
+#include "ThreadUtils.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Thread safe general purpose heap. Small requests are rounded up to a size class and served from
+		// per-thread magazines without locking, refilling from and draining to a shared depot of magazines.
+		// Large or over aligned requests go straight to a SegregatedFreeListAllocator guarded by a mutex.
+		class ConcurrentFreeListAllocator : public AllocatorInterface<ConcurrentFreeListAllocator>
+		{
+			friend class AllocatorInterface<ConcurrentFreeListAllocator>;
+
+		private:
+			struct ChunkNode {
+				ChunkNode* nextFreeChunk;
+			};
+
+			struct AllocationHeader {
+				void* baseAddress;
+				std::size_t sizeClass;
+			};
+
+			struct Magazine {
+				ChunkNode* freeChunkNodeList;
+				std::size_t numberOfChunks;
+			};
+
+			static const std::size_t allocationHeaderSize = sizeof(AllocationHeader);
+			static const std::size_t sizeClassGranularity = 16;
+			static const std::size_t numberOfSizeClasses = 16;
+			static const std::size_t largeSizeClass = numberOfSizeClasses;
+
+			struct alignas(cacheLineSize) ThreadCache {
+				Magazine sizeClasses[numberOfSizeClasses] = {};
+
+				// Only written by the owning thread, may go negative when freeing memory allocated by other threads
+				std::atomic<std::int64_t> numberOfAllocations{0};
+				std::atomic<std::int64_t> memoryUsed{0};
+			};
+
+			std::size_t chunksPerMagazine;
+
+			std::mutex depotMutex;
+			SegregatedFreeListAllocator depot;
+			std::vector<Magazine> fullMagazines[numberOfSizeClasses];
+			std::vector<void*> slabs;
+
+			ThreadCache threadCaches[maximumNumberOfThreads];
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				// Records every allocation handed out, the depot's own stats only see slabs and large blocks
+				std::mutex statsMutex;
+				AllocationStats stats;
+			#endif
+
+			static inline std::size_t GetChunkSize(std::size_t sizeClass)
+			{
+				return allocationHeaderSize + (sizeClass + 1) * sizeClassGranularity;
+			}
+
+			bool RefillMagazine(Magazine& magazine, std::size_t sizeClass);
+
+			void DrainMagazine(Magazine& magazine, std::size_t sizeClass);
+
+			void* Allocate(std::size_t size, std::uint8_t align);
+
+			void Deallocate(void* pointer);
+
+		public:
+			ConcurrentFreeListAllocator() = delete;
+
+			ConcurrentFreeListAllocator(std::size_t size, std::size_t objectsPerMagazine = 32);
+
+			ConcurrentFreeListAllocator(const ConcurrentFreeListAllocator& allocator) = delete;
+			ConcurrentFreeListAllocator& operator=(const ConcurrentFreeListAllocator& allocator) = delete;
+
+			~ConcurrentFreeListAllocator();
+
+			std::size_t GetNumberOfAllocations();
+
+			std::size_t GetMemoryUsed();
+
+			inline void SetName(const char* name)
+			{
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.SetName(name);
+				#endif
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::SetAllocatorName(this, name);
+				#endif
+			}
+
+			// True if the pointer lies inside the memory managed by this allocator
+			bool Owns(const void* pointer);
+		};
+	}
+}
@@ -0,0 +1,95 @@
+#include "ConcurrentLinearAllocator.h"
+#include <algorithm>
+#include <cassert>
+
+namespace Visage
+{
+	namespace Core
+	{
+		ConcurrentLinearAllocator::ConcurrentLinearAllocator(std::size_t size, std::size_t subChunkSize)
+			: sizeOfBuffer(size), subChunkSize(subChunkSize), offset(0)
+			#ifdef VISAGE_MEMORY_TRACKING
+				, stats(&sizeOfBuffer)
+			#endif
+		{
+			assert(subChunkSize <= size);
+			startOfBuffer = new std::uint8_t[size];
+		}
+
+		ConcurrentLinearAllocator::~ConcurrentLinearAllocator()
+		{
+			delete[] startOfBuffer;
+		}
+
+		void* ConcurrentLinearAllocator::AllocateFromNewSubChunk(ThreadCache& cache, std::size_t size, std::uint8_t align)
+		{
+			void* alignedAddress = nullptr;
+
+			// Large requests would waste most of a chunk, the rest of the current chunk stays usable
+			if (size + align - 1 > subChunkSize / 2)
+			{
+				alignedAddress = AllocateShared(size, align);
+			}
+			else
+			{
+				std::size_t chunkOffset = offset.fetch_add(subChunkSize, std::memory_order_relaxed);
+
+				if (chunkOffset + subChunkSize > sizeOfBuffer)
+				{
+					return nullptr; // assert out of memory error
+				}
+
+				std::uintptr_t startOfChunk = reinterpret_cast<std::uintptr_t>(startOfBuffer + chunkOffset);
+				std::uintptr_t alignedChunkAddress = AlignAddress(startOfChunk, align);
+
+				cache.currentPosition = alignedChunkAddress + size;
+				cache.endOfChunk = startOfChunk + subChunkSize;
+				alignedAddress = reinterpret_cast<void*>(alignedChunkAddress);
+			}
+
+			if (alignedAddress != nullptr)
+			{
+				CountAllocation(cache);
+			}
+
+			return alignedAddress;
+		}
+
+		void ConcurrentLinearAllocator::Reset()
+		{
+			#ifdef VISAGE_MEMORY_TRACKING
+				stats.RecordUsage(GetMemoryUsed(), GetNumberOfAllocations());
+			#endif
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				AllocationTrace::RecordReset(this);
+			#endif
+
+			for (std::size_t i = 0; i < maximumNumberOfThreads; i++)
+			{
+				threadCaches[i].currentPosition = 0;
+				threadCaches[i].endOfChunk = 0;
+				threadCaches[i].numberOfAllocations.store(0, std::memory_order_relaxed);
+			}
+
+			offset.store(0, std::memory_order_relaxed);
+		}
+
+		std::size_t ConcurrentLinearAllocator::GetMemoryUsed()
+		{
+			return std::min(offset.load(std::memory_order_relaxed), sizeOfBuffer);
+		}
+
+		std::size_t ConcurrentLinearAllocator::GetNumberOfAllocations()
+		{
+			std::size_t numberOfAllocations = 0;
+
+			for (std::size_t i = 0; i < maximumNumberOfThreads; i++)
+			{
+				numberOfAllocations += threadCaches[i].numberOfAllocations.load(std::memory_order_relaxed);
+			}
+
+			return numberOfAllocations;
+		}
+	}
+}
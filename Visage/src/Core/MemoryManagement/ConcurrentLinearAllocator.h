@@ -0,0 +1,128 @@
+#pragma once
+
+#include "AllocatorInterface.h"
+#include "MemoryTracking.h"
+#include "MemoryUtils.h"
+#include "ThreadUtils.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Thread safe linear allocator for per frame scratch memory filled by many jobs. Every allocation is a single
+		// fetch_add on the shared bump pointer, or with sub-chunks enabled threads carve chunks off the shared buffer
+		// and bump inside their own chunk without touching the shared cache line. Memory is released by Reset.
+		class ConcurrentLinearAllocator : public AllocatorInterface<ConcurrentLinearAllocator>
+		{
+			friend class AllocatorInterface<ConcurrentLinearAllocator>;
+
+		private:
+			struct alignas(cacheLineSize) ThreadCache {
+				std::uintptr_t currentPosition = 0;
+				std::uintptr_t endOfChunk = 0;
+
+				// Only written by the owning thread (and by Reset)
+				std::atomic<std::size_t> numberOfAllocations{0};
+			};
+
+			std::size_t sizeOfBuffer;
+			std::size_t subChunkSize;
+			std::uint8_t* startOfBuffer;
+
+			alignas(cacheLineSize) std::atomic<std::size_t> offset;
+
+			ThreadCache threadCaches[maximumNumberOfThreads];
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				AllocationStats stats;
+			#endif
+
+			static inline void CountAllocation(ThreadCache& cache)
+			{
+				cache.numberOfAllocations.store(cache.numberOfAllocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+
+			inline void* AllocateShared(std::size_t size, std::uint8_t align)
+			{
+				// Reserve the worst case padding up front so the allocation stays a single atomic add
+				std::size_t reservedSize = size + align - 1;
+				std::size_t allocationOffset = offset.fetch_add(reservedSize, std::memory_order_relaxed);
+
+				if (allocationOffset + reservedSize > sizeOfBuffer)
+				{
+					return nullptr; // assert out of memory error
+				}
+
+				return AlignPointer(startOfBuffer + allocationOffset, align);
+			}
+
+			void* AllocateFromNewSubChunk(ThreadCache& cache, std::size_t size, std::uint8_t align);
+
+			inline void* Allocate(std::size_t size, std::uint8_t align)
+			{
+				ThreadCache& cache = threadCaches[GetCurrentThreadIndex()];
+
+				if (subChunkSize == 0)
+				{
+					void* alignedAddress = AllocateShared(size, align);
+
+					if (alignedAddress != nullptr)
+					{
+						CountAllocation(cache);
+					}
+
+					return alignedAddress;
+				}
+
+				std::uintptr_t alignedAddress = AlignAddress(cache.currentPosition, align);
+
+				if (alignedAddress + size > cache.endOfChunk || cache.endOfChunk == 0)
+				{
+					return AllocateFromNewSubChunk(cache, size, align);
+				}
+
+				cache.currentPosition = alignedAddress + size;
+				CountAllocation(cache);
+
+				return reinterpret_cast<void*>(alignedAddress);
+			}
+
+			inline void Deallocate(void* pointer)
+			{ }
+
+		public:
+			ConcurrentLinearAllocator() = delete;
+
+			// subChunkSize of 0 makes every allocation bump the shared pointer, otherwise threads take chunks of
+			// that many bytes and requests larger than half a chunk go to the shared pointer directly
+			ConcurrentLinearAllocator(std::size_t size, std::size_t subChunkSize = 0);
+
+			ConcurrentLinearAllocator(const ConcurrentLinearAllocator& allocator) = delete;
+			ConcurrentLinearAllocator& operator=(const ConcurrentLinearAllocator& allocator) = delete;
+
+			~ConcurrentLinearAllocator();
+
+			// Releases everything, once per frame while no thread is allocating
+			void Reset();
+
+			// Bytes taken from the shared buffer, including padding and the unused ends of sub-chunks
+			std::size_t GetMemoryUsed();
+
+			std::size_t GetNumberOfAllocations();
+
+			inline void SetName(const char* name)
+			{
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.SetName(name);
+				#endif
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::SetAllocatorName(this, name);
+				#endif
+			}
+		};
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ThreadUtils.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Thread safe pool. Every thread allocates from and frees to its own magazine of chunks without locking,
+		// and only touches the shared depot (under a mutex) to swap a whole magazine in or out.
+		template <typename T>
+		class ConcurrentPoolAllocator
+		{
+		private:
+			struct ChunkNode {
+				ChunkNode* nextFreeChunk;
+			};
+
+			struct Magazine {
+				ChunkNode* freeChunkNodeList;
+				std::size_t numberOfChunks;
+			};
+
+			struct alignas(cacheLineSize) ThreadCache {
+				ChunkNode* freeChunkNodeList = nullptr;
+				std::size_t numberOfChunks = 0;
+
+				// Only written by the owning thread, may go negative when freeing chunks allocated by other threads
+				std::atomic<std::int64_t> numberOfAllocations{0};
+			};
+
+			std::size_t chunksPerBlock;
+			std::size_t chunksPerMagazine;
+			std::uint8_t* startOfBuffer;
+
+			std::mutex depotMutex;
+			std::vector<Magazine> fullMagazines;
+
+			ThreadCache threadCaches[maximumNumberOfThreads];
+
+			void* Allocate();
+
+			void Deallocate(void* pointer);
+
+		public:
+			ConcurrentPoolAllocator() = delete;
+
+			ConcurrentPoolAllocator(std::size_t objectsPerBlock, std::size_t objectsPerMagazine = 32);
+
+			ConcurrentPoolAllocator(const ConcurrentPoolAllocator& allocator) = delete;
+			ConcurrentPoolAllocator& operator=(const ConcurrentPoolAllocator& allocator) = delete;
+
+			~ConcurrentPoolAllocator();
+
+			std::size_t GetNumberOfAllocations();
+
+			std::size_t GetMemoryUsed();
+
+			T* New()
+			{
+				return new (Allocate()) T;
+			}
+
+			template <typename... Args>
+			T* NewWithArgs(Args&&... args)
+			{
+				return new (Allocate()) T(std::forward<Args>(args)...);
+			}
+
+			void Delete(T* objectToDelete)
+			{
+				objectToDelete->~T();
+				Deallocate(objectToDelete);
+			}
+		};
+	}
+}
+
+#include "ConcurrentPoolAllocator.inl"
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "ConcurrentPoolAllocator.h"
+#include "AllocationTrace.h"
+#include "MemoryChecking.h"
+#include "MemoryUtils.h"
+#include <cstring>
+
+namespace Visage
+{
+	namespace Core
+	{
+		template <typename T>
+		ConcurrentPoolAllocator<T>::ConcurrentPoolAllocator(std::size_t objectsPerBlock, std::size_t objectsPerMagazine)
+			: chunksPerBlock(objectsPerBlock), chunksPerMagazine(objectsPerMagazine)
+		{
+			assert(sizeof(T) >= sizeof(ChunkNode));
+			assert(objectsPerBlock > 0 && objectsPerMagazine > 0);
+
+			startOfBuffer = new std::uint8_t[(objectsPerBlock * sizeof(T)) + alignof(T)];
+
+			std::uint8_t adjustment = AlignedPointerAdjustment(startOfBuffer, alignof(T));
+			void* firstChunk = AddToPointer(startOfBuffer, adjustment);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				std::memset(firstChunk, MemoryChecker::freedFill, objectsPerBlock * sizeof(T));
+			#endif
+
+			// Carve the block into full magazines up front so the depot never has to walk chunk lists under the lock
+			fullMagazines.reserve((objectsPerBlock + objectsPerMagazine - 1) / objectsPerMagazine);
+			for (std::size_t firstIndex = 0; firstIndex < objectsPerBlock; firstIndex += objectsPerMagazine)
+			{
+				std::size_t numberOfChunks = (objectsPerBlock - firstIndex < objectsPerMagazine) ? objectsPerBlock - firstIndex : objectsPerMagazine;
+
+				ChunkNode* currentChunkNode = reinterpret_cast<ChunkNode*>(AddToPointer(firstChunk, firstIndex * sizeof(T)));
+				fullMagazines.push_back({ currentChunkNode, numberOfChunks });
+
+				for (std::size_t i = 1; i < numberOfChunks; i++)
+				{
+					ChunkNode* nextChunk = reinterpret_cast<ChunkNode*>(AddToPointer(currentChunkNode, sizeof(T)));
+					currentChunkNode->nextFreeChunk = nextChunk;
+					currentChunkNode = nextChunk;
+				}
+				currentChunkNode->nextFreeChunk = nullptr;
+			}
+		}
+
+		template <typename T>
+		ConcurrentPoolAllocator<T>::~ConcurrentPoolAllocator()
+		{
+			#ifdef DEBUG
+				assert(GetNumberOfAllocations() == 0);
+			#endif
+
+			delete[] startOfBuffer;
+		}
+
+		template <typename T>
+		std::size_t ConcurrentPoolAllocator<T>::GetNumberOfAllocations()
+		{
+			std::int64_t numberOfAllocations = 0;
+
+			for (std::size_t i = 0; i < maximumNumberOfThreads; i++)
+			{
+				numberOfAllocations += threadCaches[i].numberOfAllocations.load(std::memory_order_relaxed);
+			}
+
+			return static_cast<std::size_t>(numberOfAllocations);
+		}
+
+		template <typename T>
+		std::size_t ConcurrentPoolAllocator<T>::GetMemoryUsed()
+		{
+			return GetNumberOfAllocations() * sizeof(T);
+		}
+
+		template <typename T>
+		void* ConcurrentPoolAllocator<T>::Allocate()
+		{
+			ThreadCache& threadCache = threadCaches[GetCurrentThreadIndex()];
+
+			if (threadCache.freeChunkNodeList == nullptr)
+			{
+				std::lock_guard<std::mutex> lock(depotMutex);
+
+				if (fullMagazines.empty())
+				{
+					return nullptr;
+				}
+
+				threadCache.freeChunkNodeList = fullMagazines.back().freeChunkNodeList;
+				threadCache.numberOfChunks = fullMagazines.back().numberOfChunks;
+				fullMagazines.pop_back();
+			}
+
+			ChunkNode* chunk = threadCache.freeChunkNodeList;
+			threadCache.freeChunkNodeList = chunk->nextFreeChunk;
+			threadCache.numberOfChunks--;
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				MemoryChecker::CheckPoisonedChunk(chunk, sizeof(T), sizeof(ChunkNode));
+			#endif
+
+			threadCache.numberOfAllocations.store(threadCache.numberOfAllocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				AllocationTrace::RecordAllocation(this, chunk, sizeof(T), alignof(T));
+			#endif
+
+			return chunk;
+		}
+
+		template <typename T>
+		void ConcurrentPoolAllocator<T>::Deallocate(void* pointer)
+		{
+			ThreadCache& threadCache = threadCaches[GetCurrentThreadIndex()];
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				AllocationTrace::RecordDeallocation(this, pointer);
+			#endif
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				MemoryChecker::PoisonChunk(pointer, sizeof(T), sizeof(ChunkNode));
+			#endif
+
+			ChunkNode* newChunkNode = reinterpret_cast<ChunkNode*>(pointer);
+			newChunkNode->nextFreeChunk = threadCache.freeChunkNodeList;
+			threadCache.freeChunkNodeList = newChunkNode;
+			threadCache.numberOfChunks++;
+			threadCache.numberOfAllocations.store(threadCache.numberOfAllocations.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+			// Keep one magazine worth of chunks for the next allocations and hand a full one back to the depot
+			if (threadCache.numberOfChunks >= chunksPerMagazine * 2)
+			{
+				ChunkNode* lastChunkToReturn = threadCache.freeChunkNodeList;
+				for (std::size_t i = 1; i < chunksPerMagazine; i++)
+				{
+					lastChunkToReturn = lastChunkToReturn->nextFreeChunk;
+				}
+
+				Magazine magazine = { threadCache.freeChunkNodeList, chunksPerMagazine };
+				threadCache.freeChunkNodeList = lastChunkToReturn->nextFreeChunk;
+				threadCache.numberOfChunks -= chunksPerMagazine;
+				lastChunkToReturn->nextFreeChunk = nullptr;
+
+				std::lock_guard<std::mutex> lock(depotMutex);
+				fullMagazines.push_back(magazine);
+			}
+		}
+	}
+}
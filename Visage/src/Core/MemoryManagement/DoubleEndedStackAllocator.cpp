@@ -0,0 +1,103 @@
+#include "DoubleEndedStackAllocator.h"
+#include "MemoryUtils.h"
+
+namespace Visage
+{
+	namespace Core
+	{
+		DoubleEndedStackAllocator::DoubleEndedStackAllocator(std::size_t size)
+			: AbstractAllocator(size), activeEnd(StackEnd::Lower)
+		{
+			ClearStack();
+		}
+
+		DoubleEndedStackAllocator::DoubleEndedStackAllocator(std::size_t size, const PhysicalMemoryPolicy& policy)
+			: AbstractAllocator(size, policy), activeEnd(StackEnd::Lower)
+		{
+			ClearStack();
+		}
+
+		void* DoubleEndedStackAllocator::GetTopOfStack(StackEnd end)
+		{
+			return (end == StackEnd::Lower) ? lowerTopOfStack : upperTopOfStack;
+		}
+
+		std::size_t DoubleEndedStackAllocator::GetFreeSpace()
+		{
+			return PointerDiff(upperTopOfStack, lowerTopOfStack);
+		}
+
+		DoubleEndedStackAllocator::Marker DoubleEndedStackAllocator::GetMarker(StackEnd end)
+		{
+			if (end == StackEnd::Lower)
+			{
+				#ifdef DEBUG
+					return { lowerTopOfStack, numberOfLowerAllocations, previousLowerAddress };
+				#else
+					return { lowerTopOfStack, numberOfLowerAllocations };
+				#endif
+			}
+
+			#ifdef DEBUG
+				return { upperTopOfStack, numberOfUpperAllocations, previousUpperAddress };
+			#else
+				return { upperTopOfStack, numberOfUpperAllocations };
+			#endif
+		}
+
+		void DoubleEndedStackAllocator::FreeToMarker(StackEnd end, const Marker& marker)
+		{
+			if (end == StackEnd::Lower)
+			{
+				assert(reinterpret_cast<std::uintptr_t>(marker.topOfStack) >= reinterpret_cast<std::uintptr_t>(startOfBuffer) &&
+					reinterpret_cast<std::uintptr_t>(marker.topOfStack) <= reinterpret_cast<std::uintptr_t>(lowerTopOfStack));
+
+				RecordRewind(marker.topOfStack, lowerTopOfStack, memoryUsed - PointerDiff(lowerTopOfStack, marker.topOfStack),
+					numberOfAllocations - (numberOfLowerAllocations - marker.numberOfAllocations));
+				lowerTopOfStack = marker.topOfStack;
+				numberOfLowerAllocations = marker.numberOfAllocations;
+
+				#ifdef DEBUG
+					previousLowerAddress = marker.previousAddress;
+				#endif
+			}
+			else
+			{
+				assert(reinterpret_cast<std::uintptr_t>(marker.topOfStack) >= reinterpret_cast<std::uintptr_t>(upperTopOfStack) &&
+					reinterpret_cast<std::uintptr_t>(marker.topOfStack) <= reinterpret_cast<std::uintptr_t>(AddToPointer(startOfBuffer, sizeOfBuffer)));
+
+				RecordRewind(upperTopOfStack, marker.topOfStack, memoryUsed - PointerDiff(marker.topOfStack, upperTopOfStack),
+					numberOfAllocations - (numberOfUpperAllocations - marker.numberOfAllocations));
+				upperTopOfStack = marker.topOfStack;
+				numberOfUpperAllocations = marker.numberOfAllocations;
+
+				#ifdef DEBUG
+					previousUpperAddress = marker.previousAddress;
+				#endif
+			}
+		}
+
+		void DoubleEndedStackAllocator::ClearStack(StackEnd end)
+		{
+			#ifdef DEBUG
+				FreeToMarker(end, { (end == StackEnd::Lower) ? startOfBuffer : AddToPointer(startOfBuffer, sizeOfBuffer), 0, nullptr });
+			#else
+				FreeToMarker(end, { (end == StackEnd::Lower) ? startOfBuffer : AddToPointer(startOfBuffer, sizeOfBuffer), 0 });
+			#endif
+		}
+
+		void DoubleEndedStackAllocator::ClearStack()
+		{
+			RecordReset();
+			lowerTopOfStack = startOfBuffer;
+			upperTopOfStack = AddToPointer(startOfBuffer, sizeOfBuffer);
+			numberOfLowerAllocations = 0;
+			numberOfUpperAllocations = 0;
+
+			#ifdef DEBUG
+				previousLowerAddress = nullptr;
+				previousUpperAddress = nullptr;
+			#endif
+		}
+	}
+}
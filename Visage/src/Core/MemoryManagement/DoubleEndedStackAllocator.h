@@ -0,0 +1,189 @@
+#pragma once
+
+#include "AbstractAllocator.h"
+#include "MemoryUtils.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		enum class StackEnd : std::uint8_t
+		{
+			Lower,
+			Upper
+		};
+
+		// Two stacks sharing one buffer, the lower one grows up from the start and the upper one down from the end,
+		// so either side can use whatever the other leaves free. New/Allocate use the active end, Delete works out
+		// the end from the address. Each end has to be freed in LIFO order on its own.
+		class DoubleEndedStackAllocator : public AbstractAllocator<DoubleEndedStackAllocator>
+		{
+			friend class AllocatorInterface<DoubleEndedStackAllocator>;
+
+		private:
+			// Same as the StackAllocator header, the adjustment leads back to the previous top of the lower stack
+			struct LowerAllocationHeader {
+				std::uint8_t adjustment;
+
+				#ifdef DEBUG
+					void* previousAddress;
+				#endif
+			};
+
+			// Upper allocations are aligned downwards, so the header keeps how far the top of the stack moved instead
+			struct UpperAllocationHeader {
+				std::size_t allocationSize;
+
+				#ifdef DEBUG
+					void* previousAddress;
+				#endif
+			};
+
+			void* lowerTopOfStack;
+			void* upperTopOfStack;
+			std::size_t numberOfLowerAllocations;
+			std::size_t numberOfUpperAllocations;
+			StackEnd activeEnd;
+
+			#ifdef DEBUG
+				void* previousLowerAddress;
+				void* previousUpperAddress;
+			#endif
+
+			static const std::size_t lowerAllocationHeaderSize = sizeof(LowerAllocationHeader);
+			static const std::size_t upperAllocationHeaderSize = sizeof(UpperAllocationHeader);
+
+			inline void* AllocateLower(std::size_t size, std::uint8_t align)
+			{
+				std::uint8_t adjustment = AlignedPointerWithHeaderAdjustment(lowerTopOfStack, align, lowerAllocationHeaderSize);
+
+				if (size + adjustment > PointerDiff(upperTopOfStack, lowerTopOfStack))
+				{
+					return nullptr; // assert out of memory error
+				}
+
+				void* alignedAddress = AddToPointer(lowerTopOfStack, adjustment);
+
+				LowerAllocationHeader* header = reinterpret_cast<LowerAllocationHeader*>(SubtractFromPointer(alignedAddress, lowerAllocationHeaderSize));
+				header->adjustment = adjustment;
+
+				lowerTopOfStack = AddToPointer(alignedAddress, size);
+				numberOfLowerAllocations++;
+				RecordAllocation(alignedAddress, size + adjustment, size);
+
+				#ifdef DEBUG
+					header->previousAddress = previousLowerAddress;
+					previousLowerAddress = alignedAddress;
+				#endif
+
+				return alignedAddress;
+			}
+
+			inline void* AllocateUpper(std::size_t size, std::uint8_t align)
+			{
+				std::size_t freeSpace = PointerDiff(upperTopOfStack, lowerTopOfStack);
+
+				if (size + upperAllocationHeaderSize + align - 1 > freeSpace)
+				{
+					return nullptr; // assert out of memory error
+				}
+
+				std::uintptr_t alignedAddress = (reinterpret_cast<std::uintptr_t>(upperTopOfStack) - size) & ~static_cast<std::uintptr_t>(align - 1);
+				void* newUpperTopOfStack = reinterpret_cast<void*>(alignedAddress - upperAllocationHeaderSize);
+
+				UpperAllocationHeader* header = reinterpret_cast<UpperAllocationHeader*>(newUpperTopOfStack);
+				header->allocationSize = PointerDiff(upperTopOfStack, newUpperTopOfStack);
+
+				upperTopOfStack = newUpperTopOfStack;
+				numberOfUpperAllocations++;
+				RecordAllocation(reinterpret_cast<void*>(alignedAddress), header->allocationSize, size);
+
+				#ifdef DEBUG
+					header->previousAddress = previousUpperAddress;
+					previousUpperAddress = reinterpret_cast<void*>(alignedAddress);
+				#endif
+
+				return reinterpret_cast<void*>(alignedAddress);
+			}
+
+		protected:
+			inline void* Allocate(std::size_t size, std::uint8_t align)
+			{
+				return (activeEnd == StackEnd::Lower) ? AllocateLower(size, align) : AllocateUpper(size, align);
+			}
+
+			inline void Deallocate(void* pointer)
+			{
+				if (reinterpret_cast<std::uintptr_t>(pointer) < reinterpret_cast<std::uintptr_t>(lowerTopOfStack))
+				{
+					LowerAllocationHeader* header = reinterpret_cast<LowerAllocationHeader*>(SubtractFromPointer(pointer, lowerAllocationHeaderSize));
+
+					#ifdef DEBUG
+						assert(previousLowerAddress == pointer);
+						previousLowerAddress = header->previousAddress;
+					#endif
+
+					RecordDeallocation(pointer, PointerDiff(lowerTopOfStack, pointer) + header->adjustment);
+					lowerTopOfStack = SubtractFromPointer(pointer, header->adjustment);
+					numberOfLowerAllocations--;
+				}
+				else
+				{
+					UpperAllocationHeader* header = reinterpret_cast<UpperAllocationHeader*>(SubtractFromPointer(pointer, upperAllocationHeaderSize));
+
+					#ifdef DEBUG
+						assert(previousUpperAddress == pointer && header == upperTopOfStack);
+						previousUpperAddress = header->previousAddress;
+					#endif
+
+					RecordDeallocation(pointer, header->allocationSize);
+					upperTopOfStack = AddToPointer(header, header->allocationSize);
+					numberOfUpperAllocations--;
+				}
+			}
+
+		public:
+			// Saved top of one end, everything allocated on that end after the marker was taken is freed by FreeToMarker
+			struct Marker {
+				void* topOfStack;
+				std::size_t numberOfAllocations;
+
+				#ifdef DEBUG
+					void* previousAddress;
+				#endif
+			};
+
+			DoubleEndedStackAllocator() = delete;
+
+			DoubleEndedStackAllocator(std::size_t size);
+
+			DoubleEndedStackAllocator(std::size_t size, const PhysicalMemoryPolicy& policy);
+
+			inline void SetActiveEnd(StackEnd end)
+			{
+				activeEnd = end;
+			}
+
+			inline StackEnd GetActiveEnd() const
+			{
+				return activeEnd;
+			}
+
+			void* GetTopOfStack(StackEnd end);
+
+			// Bytes left between the two stacks
+			std::size_t GetFreeSpace();
+
+			Marker GetMarker(StackEnd end);
+
+			// Releases every allocation made on that end since the marker in one step, destructors are not called
+			void FreeToMarker(StackEnd end, const Marker& marker);
+
+			void ClearStack(StackEnd end);
+
+			void ClearStack();
+		};
+	}
+}
@@ -0,0 +1,180 @@
+#include "FrameAllocator.h"
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
+namespace Visage
+{
+	namespace Core
+	{
+		FrameAllocator::FrameAllocator(std::size_t sizeOfBuffers, std::size_t numberOfBuffers)
+			: activeBuffer(0), numberOfBuffers(numberOfBuffers), sizeOfBuffers(sizeOfBuffers), sizeOfAllBuffers(sizeOfBuffers * numberOfBuffers),
+			  backing(BufferBacking::Heap)
+			#ifdef VISAGE_MEMORY_TRACKING
+				, stats(&sizeOfAllBuffers)
+			#endif
+		{
+			assert(numberOfBuffers >= 2 && numberOfBuffers <= maximumNumberOfBuffers);
+
+			startOfBuffer = new std::uint8_t[sizeOfAllBuffers];
+
+			for (std::size_t i = 0; i < numberOfBuffers; i++)
+			{
+				buffers[i].committedSize.store(sizeOfBuffers, std::memory_order_relaxed);
+			}
+		}
+
+		FrameAllocator::FrameAllocator(std::size_t sizeOfBuffers, std::size_t numberOfBuffers, const VirtualMemoryPolicy& policy)
+			: activeBuffer(0), numberOfBuffers(numberOfBuffers), sizeOfBuffers(RoundUpToPageSize(sizeOfBuffers)),
+			  sizeOfAllBuffers(RoundUpToPageSize(sizeOfBuffers) * numberOfBuffers), backing(BufferBacking::ReservedVirtualMemory), virtualMemoryPolicy(policy)
+			#ifdef VISAGE_MEMORY_TRACKING
+				, stats(&sizeOfAllBuffers)
+			#endif
+		{
+			assert(numberOfBuffers >= 2 && numberOfBuffers <= maximumNumberOfBuffers);
+
+			startOfBuffer = static_cast<std::uint8_t*>(ReserveVirtualMemory(sizeOfAllBuffers));
+			assert(startOfBuffer != nullptr);
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				stats.SetBacking(backing, -1);
+			#endif
+		}
+
+		FrameAllocator::~FrameAllocator()
+		{
+			#ifdef DEBUG
+				for (std::size_t i = 0; i < numberOfBuffers; i++)
+				{
+					assert(buffers[i].pendingReleases.load(std::memory_order_acquire) == 0);
+				}
+			#endif
+
+			if (backing == BufferBacking::Heap)
+			{
+				delete[] startOfBuffer;
+			}
+			else
+			{
+				ReleaseVirtualMemory(startOfBuffer, sizeOfAllBuffers);
+			}
+		}
+
+		bool FrameAllocator::CommitBufferUpTo(std::size_t buffer, std::size_t size)
+		{
+			if (backing != BufferBacking::ReservedVirtualMemory)
+			{
+				return false;
+			}
+
+			std::lock_guard<std::mutex> lock(commitMutex);
+
+			// Another thread may have committed the range while this one waited for the lock
+			std::size_t committedSize = buffers[buffer].committedSize.load(std::memory_order_relaxed);
+			if (size <= committedSize)
+			{
+				return true;
+			}
+
+			std::size_t newCommittedSize = RoundUpToPageSize(std::max(size, committedSize + virtualMemoryPolicy.commitGranularity));
+			newCommittedSize = std::min(newCommittedSize, sizeOfBuffers);
+
+			if (!CommitVirtualMemory(GetStartOfBuffer(buffer) + committedSize, newCommittedSize - committedSize))
+			{
+				return false;
+			}
+
+			buffers[buffer].committedSize.store(newCommittedSize, std::memory_order_release);
+			return true;
+		}
+
+		void FrameAllocator::ClearBuffer(std::size_t buffer)
+		{
+			FrameBuffer& frameBuffer = buffers[buffer];
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				stats.RecordUsage(std::min(frameBuffer.offset.load(std::memory_order_relaxed), sizeOfBuffers),
+					frameBuffer.numberOfAllocations.exchange(0, std::memory_order_relaxed));
+			#endif
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				AllocationTrace::RecordRewind(this, GetStartOfBuffer(buffer), GetStartOfBuffer(buffer) + sizeOfBuffers);
+			#endif
+
+			frameBuffer.offset.store(0, std::memory_order_relaxed);
+
+			if (backing == BufferBacking::ReservedVirtualMemory)
+			{
+				std::size_t committedSize = frameBuffer.committedSize.load(std::memory_order_relaxed);
+				std::size_t retainedSize = std::min(RoundUpToPageSize(virtualMemoryPolicy.decommitThreshold), sizeOfBuffers);
+
+				if (committedSize > retainedSize)
+				{
+					DecommitVirtualMemory(GetStartOfBuffer(buffer) + retainedSize, committedSize - retainedSize);
+					frameBuffer.committedSize.store(retainedSize, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		void FrameAllocator::AdvanceFrame()
+		{
+			while (!TryAdvanceFrame())
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		bool FrameAllocator::TryAdvanceFrame()
+		{
+			std::size_t nextBuffer = (activeBuffer.load(std::memory_order_relaxed) + 1) % numberOfBuffers;
+
+			// Pairs with the release in ReleaseFrame so everything the retaining work did with the memory is finished
+			if (buffers[nextBuffer].pendingReleases.load(std::memory_order_acquire) != 0)
+			{
+				return false;
+			}
+
+			ClearBuffer(nextBuffer);
+			activeBuffer.store(nextBuffer, std::memory_order_release);
+			return true;
+		}
+
+		std::size_t FrameAllocator::GetMemoryUsed()
+		{
+			std::size_t memoryUsed = 0;
+
+			for (std::size_t i = 0; i < numberOfBuffers; i++)
+			{
+				memoryUsed += std::min(buffers[i].offset.load(std::memory_order_relaxed), sizeOfBuffers);
+			}
+
+			return memoryUsed;
+		}
+
+		std::size_t FrameAllocator::GetNumberOfAllocations()
+		{
+			std::size_t numberOfAllocations = 0;
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				for (std::size_t i = 0; i < numberOfBuffers; i++)
+				{
+					numberOfAllocations += buffers[i].numberOfAllocations.load(std::memory_order_relaxed);
+				}
+			#endif
+
+			return numberOfAllocations;
+		}
+
+		std::size_t FrameAllocator::GetCommittedSize()
+		{
+			std::size_t committedSize = 0;
+
+			for (std::size_t i = 0; i < numberOfBuffers; i++)
+			{
+				committedSize += buffers[i].committedSize.load(std::memory_order_relaxed);
+			}
+
+			return committedSize;
+		}
+	}
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "AllocatorInterface.h"
+#include "MemoryTracking.h"
+#include "MemoryUtils.h"
+#include "ThreadUtils.h"
+#include "VirtualMemory.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Frame scratch memory in 2 to 4 buffers used round robin. Any thread may allocate from the current frame's
+		// buffer, an allocation is a single atomic add on its bump pointer. Work that reads frame memory after the
+		// frame ends (GPU submission, jobs spanning frames) retains the frame and releases it once it is done, a
+		// buffer is only cleared for reuse when every retain on it has been released.
+		class FrameAllocator : public AllocatorInterface<FrameAllocator>
+		{
+			friend class AllocatorInterface<FrameAllocator>;
+
+		public:
+			static const std::size_t maximumNumberOfBuffers = 4;
+
+			// Identifies the buffer a frame allocated from, see RetainCurrentFrame
+			using FrameHandle = std::size_t;
+
+		private:
+			struct alignas(cacheLineSize) FrameBuffer {
+				std::atomic<std::size_t> offset{0};
+
+				// Committed bytes of the buffer, only grows under commitMutex
+				std::atomic<std::size_t> committedSize{0};
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					std::atomic<std::size_t> numberOfAllocations{0};
+				#endif
+
+				// Outstanding retains, the buffer cannot be cleared before this drops back to 0
+				alignas(cacheLineSize) std::atomic<std::uint32_t> pendingReleases{0};
+			};
+
+			FrameBuffer buffers[maximumNumberOfBuffers];
+			std::atomic<std::size_t> activeBuffer;
+			std::size_t numberOfBuffers;
+			std::size_t sizeOfBuffers;
+			std::size_t sizeOfAllBuffers;
+			std::uint8_t* startOfBuffer;
+			BufferBacking backing;
+			VirtualMemoryPolicy virtualMemoryPolicy;
+			std::mutex commitMutex;
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				AllocationStats stats;
+			#endif
+
+			inline std::uint8_t* GetStartOfBuffer(std::size_t buffer)
+			{
+				return startOfBuffer + buffer * sizeOfBuffers;
+			}
+
+			bool CommitBufferUpTo(std::size_t buffer, std::size_t size);
+
+			void ClearBuffer(std::size_t buffer);
+
+			inline void* Allocate(std::size_t size, std::uint8_t align)
+			{
+				std::size_t bufferIndex = activeBuffer.load(std::memory_order_acquire);
+				FrameBuffer& buffer = buffers[bufferIndex];
+
+				// Reserve the worst case padding up front so the allocation stays a single atomic add
+				std::size_t reservedSize = size + align - 1;
+				std::size_t offset = buffer.offset.fetch_add(reservedSize, std::memory_order_relaxed);
+
+				if (offset + reservedSize > sizeOfBuffers)
+				{
+					return nullptr; // assert out of memory error
+				}
+
+				if (offset + reservedSize > buffer.committedSize.load(std::memory_order_acquire) && !CommitBufferUpTo(bufferIndex, offset + reservedSize))
+				{
+					return nullptr; // assert out of memory error
+				}
+
+				#ifdef VISAGE_MEMORY_TRACKING
+					buffer.numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+				#endif
+
+				return AlignPointer(GetStartOfBuffer(bufferIndex) + offset, align);
+			}
+
+			// Frame memory is released in bulk when its buffer is cleared
+			inline void Deallocate(void* pointer)
+			{ }
+
+		public:
+			FrameAllocator() = delete;
+
+			FrameAllocator(std::size_t sizeOfBuffers, std::size_t numberOfBuffers = 2);
+
+			// Reserves the buffers only, pages are committed as allocations reach them
+			FrameAllocator(std::size_t sizeOfBuffers, std::size_t numberOfBuffers, const VirtualMemoryPolicy& policy);
+
+			FrameAllocator(const FrameAllocator& allocator) = delete;
+			FrameAllocator& operator=(const FrameAllocator& allocator) = delete;
+
+			~FrameAllocator();
+
+			// Moves allocation to the next buffer, waiting for every retain of that buffer to be released before
+			// clearing it. Called once per frame by the thread driving the frame loop, while no thread is
+			// allocating memory meant for the frame that ends.
+			void AdvanceFrame();
+
+			// Same as AdvanceFrame but returns false instead of waiting when the next buffer is still retained
+			bool TryAdvanceFrame();
+
+			// Keeps the current frame's buffer from being cleared until ReleaseFrame is called with the handle,
+			// e.g. when the frame's data is submitted to the GPU. Has to be called during the frame.
+			inline FrameHandle RetainCurrentFrame()
+			{
+				FrameHandle frame = activeBuffer.load(std::memory_order_acquire);
+				buffers[frame].pendingReleases.fetch_add(1, std::memory_order_relaxed);
+				return frame;
+			}
+
+			// Signals that work retaining the frame has finished with its memory, may be called from any thread
+			// (a GPU fence callback, the last job of the frame)
+			inline void ReleaseFrame(FrameHandle frame)
+			{
+				assert(frame < numberOfBuffers && buffers[frame].pendingReleases.load(std::memory_order_relaxed) > 0);
+				buffers[frame].pendingReleases.fetch_sub(1, std::memory_order_release);
+			}
+
+			inline std::size_t GetNumberOfBuffers()
+			{
+				return numberOfBuffers;
+			}
+
+			inline FrameHandle GetCurrentFrame()
+			{
+				return activeBuffer.load(std::memory_order_acquire);
+			}
+
+			// Bytes handed out from every buffer that has not been cleared yet, including alignment padding
+			std::size_t GetMemoryUsed();
+
+			// Only counted when memory tracking is compiled in, 0 otherwise
+			std::size_t GetNumberOfAllocations();
+
+			std::size_t GetCommittedSize();
+
+			inline BufferBacking GetBacking()
+			{
+				return backing;
+			}
+
+			inline void SetName(const char* name)
+			{
+				#ifdef VISAGE_MEMORY_TRACKING
+					stats.SetName(name);
+				#endif
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::SetAllocatorName(this, name);
+				#endif
+			}
+		};
+	}
+}
@@ -7,36 +7,179 @@ namespace Visage
 	namespace Core
 	{
 		Visage::Core::FreeListAllocator::FreeListAllocator(std::size_t size)
-			: AbstractAllocator(size) 
+			: AbstractAllocator(size), freeHandleSlot(pinnedAllocation)
 		{
-			assert(size >= listNodeSize);
+			InitializeFreeList();
+		}
+
+		FreeListAllocator::FreeListAllocator(std::size_t size, const PhysicalMemoryPolicy& policy)
+			: AbstractAllocator(size, policy), freeHandleSlot(pinnedAllocation)
+		{
+			InitializeFreeList();
+		}
+
+		void FreeListAllocator::InitializeFreeList()
+		{
+			assert(sizeOfBuffer >= listNodeSize);
 
 			freeListHead = reinterpret_cast<ListNode*>(startOfBuffer);
-			freeListHead->size = size;
+			freeListHead->size = sizeOfBuffer;
 			freeListHead->nextListNode = nullptr;
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				stats.SetFragmentationSource(this, [](void* allocator) { return static_cast<FreeListAllocator*>(allocator)->GetFragmentation(); });
+			#endif
 		}
 
-		void FreeListAllocator::Defragment()
+		std::size_t FreeListAllocator::GetLargestFreeBlockSize()
 		{
-			if (freeListHead != nullptr && AddToPointer(freeListHead, freeListHead->size) < AddToPointer(startOfBuffer, sizeOfBuffer))
+			std::size_t largestFreeBlockSize = 0;
+
+			for (ListNode* currentNode = freeListHead; currentNode != nullptr; currentNode = currentNode->nextListNode)
 			{
-				ListNode* nextFreeNode = freeListHead->nextListNode;
-				AllocatonHeader* headerOfAllocatedElement = reinterpret_cast<AllocatonHeader*>(AddToPointer(freeListHead, freeListHead->size));
-				std::size_t sizeOfAllocatedElement = headerOfAllocatedElement->size;
-				std::uint8_t adjustmentForAllocatedElement = headerOfAllocatedElement->adjustment;
-				AddToPointer(std::memcpy(freeListHead, headerOfAllocatedElement, sizeOfAllocatedElement), adjustmentForAllocatedElement);
-
-				std::size_t sizeOfFreeListHead = freeListHead->size;
-				freeListHead = reinterpret_cast<ListNode*>(AddToPointer(freeListHead, sizeOfAllocatedElement));
-				freeListHead->size = sizeOfFreeListHead;
-				freeListHead->nextListNode = nullptr;
+				if (currentNode->size > largestFreeBlockSize)
+				{
+					largestFreeBlockSize = currentNode->size;
+				}
+			}
+
+			return largestFreeBlockSize;
+		}
 
-				if (nextFreeNode != nullptr)
+		float FreeListAllocator::GetFragmentation()
+		{
+			std::size_t freeMemory = sizeOfBuffer - memoryUsed;
+
+			if (freeMemory == 0)
+			{
+				return 0.0f;
+			}
+
+			return 1.0f - static_cast<float>(GetLargestFreeBlockSize()) / static_cast<float>(freeMemory);
+		}
+
+		FreeListAllocator::Handle FreeListAllocator::AllocateRelocatable(std::size_t size, std::uint8_t align)
+		{
+			void* alignedAddress = Allocate(size, align);
+
+			if (alignedAddress == nullptr)
+			{
+				return { 0 }; // assert out of memory error
+			}
+
+			std::uint32_t slotIndex = freeHandleSlot;
+
+			if (slotIndex != pinnedAllocation)
+			{
+				freeHandleSlot = handleSlots[slotIndex].nextFreeSlot;
+			}
+			else
+			{
+				assert(handleSlots.size() <= handleIndexMask);
+				slotIndex = static_cast<std::uint32_t>(handleSlots.size());
+				handleSlots.push_back({ nullptr, 1, pinnedAllocation });
+			}
+
+			handleSlots[slotIndex].address = alignedAddress;
+			GetHeader(alignedAddress)->handleIndex = slotIndex;
+
+			return { slotIndex | (handleSlots[slotIndex].generation << handleIndexBits) };
+		}
+
+		void FreeListAllocator::DeallocateRelocatable(Handle handle)
+		{
+			void* alignedAddress = Resolve(handle);
+			assert(alignedAddress != nullptr);
+
+			std::uint32_t slotIndex = handle.value & handleIndexMask;
+			HandleSlot& slot = handleSlots[slotIndex];
+
+			// Generation 0 is never used so the zero handle never resolves
+			slot.generation = (slot.generation == maximumGeneration) ? 1 : slot.generation + 1;
+			slot.address = nullptr;
+			slot.nextFreeSlot = freeHandleSlot;
+			freeHandleSlot = slotIndex;
+
+			GetHeader(alignedAddress)->handleIndex = pinnedAllocation;
+			Deallocate(alignedAddress);
+		}
+
+		bool FreeListAllocator::Defragment(std::size_t budgetBytes)
+		{
+			const void* endOfBuffer = AddToPointer(startOfBuffer, sizeOfBuffer);
+			std::size_t movedBytes = 0;
+			ListNode* previousNode = nullptr;
+			ListNode* freeNode = freeListHead;
+
+			// Free blocks are coalesced, so the block right after a free one is allocated or the end of the buffer
+			while (freeNode != nullptr && AddToPointer(freeNode, freeNode->size) != endOfBuffer)
+			{
+				AllocatonHeader* header = reinterpret_cast<AllocatonHeader*>(AddToPointer(freeNode, freeNode->size));
+
+				std::size_t freeSize = freeNode->size;
+				std::size_t blockSize = header->size;
+				std::size_t payloadSize = blockSize - header->adjustment;
+				std::uint8_t newAdjustment = AlignedPointerWithHeaderAdjustment(freeNode, header->align, allocationHeaderSize);
+				std::size_t newBlockSize = newAdjustment + payloadSize;
+
+				// Raw allocations pin the free block in front of them, as do moves the alignment does not leave room for
+				if (header->handleIndex == pinnedAllocation || newBlockSize > freeSize + blockSize)
+				{
+					previousNode = freeNode;
+					freeNode = freeNode->nextListNode;
+					continue;
+				}
+
+				if (movedBytes >= budgetBytes)
+				{
+					return false;
+				}
+
+				ListNode* nextFreeNode = freeNode->nextListNode;
+				std::uint32_t handleIndex = header->handleIndex;
+				std::uint8_t align = header->align;
+				void* oldAddress = AddToPointer(header, header->adjustment);
+				void* newAddress = AddToPointer(freeNode, newAdjustment);
+
+				// The old and new place of the allocation may overlap, the header is written after the move since it
+				// may lie inside the old one
+				std::memmove(newAddress, oldAddress, payloadSize);
+
+				std::size_t remainingSize = freeSize + blockSize - newBlockSize;
+				if (remainingSize < listNodeSize)
 				{
-					freeListHead->size += nextFreeNode->size;
-					freeListHead->nextListNode = nextFreeNode->nextListNode;
+					newBlockSize += remainingSize;
+					remainingSize = 0;
 				}
+
+				new (freeNode) AllocatonHeader(newBlockSize, newAdjustment, align, handleIndex);
+				*(reinterpret_cast<std::uint8_t*>(newAddress) - 1) = newAdjustment;
+
+				handleSlots[handleIndex].address = newAddress;
+				RecordMove(oldAddress, newAddress, blockSize, newBlockSize);
+				movedBytes += payloadSize;
+
+				ListNode* remainingNode = nullptr;
+				if (remainingSize > 0)
+				{
+					remainingNode = new (AddToPointer(freeNode, newBlockSize)) ListNode(remainingSize, nextFreeNode);
+					MergeWithRightNode(remainingNode);
+				}
+
+				ListNode* replacementNode = (remainingNode != nullptr) ? remainingNode : nextFreeNode;
+				if (previousNode == nullptr)
+				{
+					freeListHead = replacementNode;
+				}
+				else
+				{
+					previousNode->nextListNode = replacementNode;
+				}
+
+				freeNode = replacementNode;
 			}
+
+			return true;
 		}
 
 		void* FreeListAllocator::Allocate(std::size_t size, std::uint8_t align)
@@ -48,6 +191,7 @@ namespace Visage
 				std::size_t sizeOfNewElement = size + allocationHeaderSize; // replace align with adjustment
 
 				std::uint8_t adjustmentForHeader = 0;
+				std::size_t totalSizeNeededForNewElement = 0;
 				ListNode* freeNode = nullptr;
 				ListNode* previousNode = nullptr;
 				ListNode* currentNode = freeListHead;
@@ -56,7 +200,7 @@ namespace Visage
 					if (sizeOfNewElement <= currentNode->size)
 					{
 						adjustmentForHeader = AlignedPointerWithHeaderAdjustment(currentNode, align, allocationHeaderSize);
-						std::size_t totalSizeNeededForNewElement = (adjustmentForHeader - allocationHeaderSize) + sizeOfNewElement;
+						totalSizeNeededForNewElement = (adjustmentForHeader - allocationHeaderSize) + sizeOfNewElement;
 						if (totalSizeNeededForNewElement <= currentNode->size)
 						{
 							freeNode = currentNode;
@@ -73,7 +217,8 @@ namespace Visage
 					alignedAddress = AddToPointer(freeNode, adjustmentForHeader);
 					void* headerAddress = freeNode;
 					std::size_t totalAllocationSize = 0;
-					if (freeNode->size >= sizeOfNewElement + listNodeSize)
+					// The rest of the block has to hold a list node, alignment padding included
+					if (freeNode->size >= totalSizeNeededForNewElement + listNodeSize)
 					{
 						totalAllocationSize = size + adjustmentForHeader;
 						ListNode* newListNode = new (AddToPointer(alignedAddress, size)) ListNode(freeNode->size - totalAllocationSize, nullptr);
@@ -103,24 +248,27 @@ namespace Visage
 						}
 					}
 
-					AllocatonHeader* header = new (headerAddress) AllocatonHeader(totalAllocationSize, adjustmentForHeader);
+					AllocatonHeader* header = new (headerAddress) AllocatonHeader(totalAllocationSize, adjustmentForHeader, align, pinnedAllocation);
 
 					*(reinterpret_cast<std::uint8_t*>(alignedAddress) - 1) = header->adjustment;
 
-					memoryUsed += totalAllocationSize;
-					numberOfAllocations++;
+					RecordAllocation(alignedAddress, totalAllocationSize, size);
 				}
 			}
 
 			return alignedAddress;
 		}
 
-		void FreeListAllocator::Deallocate(void*& pointer)
+		void FreeListAllocator::Deallocate(void* pointer)
 		{
 			std::uint8_t adjustmentForHeader = *(reinterpret_cast<std::uint8_t*>(pointer) - 1);
+
+			#ifdef DEBUG
+				assert(GetHeader(pointer)->handleIndex == pinnedAllocation); // relocatable allocations go through DeallocateRelocatable
+			#endif
+
 			std::size_t sizeOfAllocatedElement = *reinterpret_cast<std::size_t*>(SubtractFromPointer(pointer, adjustmentForHeader));
-			memoryUsed -= sizeOfAllocatedElement;
-			numberOfAllocations--;
+			RecordDeallocation(pointer, sizeOfAllocatedElement);
 
 			ListNode* newNode = reinterpret_cast<ListNode*>(SubtractFromPointer(pointer, adjustmentForHeader));
 			AddNodeAndMergeRight(newNode);
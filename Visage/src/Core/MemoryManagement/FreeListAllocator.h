@@ -2,14 +2,34 @@
 
 #include "AbstractAllocator.h"
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Visage
 {
 	namespace Core
 	{
-		class FreeListAllocator : public AbstractAllocator
+		// General purpose heap with a first fit, address ordered free list. Besides raw pointers it hands out
+		// relocatable allocations through handles, which Defragment may move to compact the heap.
+		class FreeListAllocator : public AbstractAllocator<FreeListAllocator>
 		{
+			friend class AllocatorInterface<FreeListAllocator>;
+			friend class SmallObjectAllocator;
+
+		public:
+			// Generation checked reference to a relocatable allocation. The low bits index the handle table, the high
+			// bits hold the generation of the table slot so handles to freed allocations stop resolving.
+			struct Handle {
+				std::uint32_t value;
+
+				inline bool IsValid() const
+				{
+					return value != 0;
+				}
+			};
+
 		private:
 			struct ListNode {
 				std::size_t size;
@@ -22,88 +42,122 @@ namespace Visage
 
 			struct AllocatonHeader {
 				std::size_t size;
+
+				// Handle table slot of relocatable allocations, pinnedAllocation for raw ones
+				std::uint32_t handleIndex;
 				std::uint8_t adjustment;
+				std::uint8_t align;
 
-				AllocatonHeader(std::size_t size, std::uint8_t adjustment)
-					: size(size), adjustment(adjustment)
+				AllocatonHeader(std::size_t size, std::uint8_t adjustment, std::uint8_t align, std::uint32_t handleIndex)
+					: size(size), handleIndex(handleIndex), adjustment(adjustment), align(align)
 				{ }
 			};
+
+			struct HandleSlot {
+				void* address;
+				std::uint32_t generation;
+				std::uint32_t nextFreeSlot;
+			};
 			
 			ListNode* freeListHead;
 
+			std::vector<HandleSlot> handleSlots;
+			std::uint32_t freeHandleSlot;
+
+			static const std::uint32_t handleIndexBits = 20;
+			static const std::uint32_t handleIndexMask = (1u << handleIndexBits) - 1;
+			static const std::uint32_t maximumGeneration = (1u << (32 - handleIndexBits)) - 1;
+			static const std::uint32_t pinnedAllocation = ~0u;
+
 			static const std::size_t allocationHeaderSize = sizeof(AllocatonHeader);
 
 			static const std::size_t listNodeSize = sizeof(ListNode);
 
+			void InitializeFreeList();
+
 			void AddNodeAndMergeRight(ListNode* newNode);
 
 			void MergeWithRightNode(ListNode* listNode);
 
+			static inline AllocatonHeader* GetHeader(void* alignedAddress)
+			{
+				return reinterpret_cast<AllocatonHeader*>(SubtractFromPointer(alignedAddress, *(reinterpret_cast<std::uint8_t*>(alignedAddress) - 1)));
+			}
+
 		protected:
-			void* Allocate(std::size_t size, std::uint8_t align) override;
+			void* Allocate(std::size_t size, std::uint8_t align);
 			
-			void Deallocate(void*& pointer) override;
+			void Deallocate(void* pointer);
 
 		public:
 			FreeListAllocator() = delete;
 
 			FreeListAllocator(std::size_t size);
 
-			void Defragment();
-
-			template <typename T>
-			T* New()
-			{
-				return new (Allocate(sizeof(T), alignof(T))) T;
-			}
+			FreeListAllocator(std::size_t size, const PhysicalMemoryPolicy& policy);
 
-			template <typename T, typename... Args>
-			T* NewWithArgs(Args&&... args)
-			{
-				return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
-			}
-
-			template <typename T>
-			T* NewArray(std::size_t arrayLength)
-			{
-				std::uint8_t numberOfElementsForOneWord = sizeof(size_t) / sizeof(T);
-
-				if (sizeof(size_t) - (static_cast<std::size_t>(numberOfElementsForOneWord) * sizeof(T)) > 0)
+			#ifdef VISAGE_MEMORY_CHECKING
+				~FreeListAllocator()
 				{
-					numberOfElementsForOneWord += 1;
+					FlushQuarantine();
 				}
+			#endif
+
+			// Relocatable allocations may be moved by Defragment, so they are only reachable through Resolve. Returns an
+			// invalid handle when out of memory.
+			Handle AllocateRelocatable(std::size_t size, std::uint8_t align);
 
-				T* baseArrayAddress = reinterpret_cast<T*>(Allocate((arrayLength + numberOfElementsForOneWord) * sizeof(T), alignof(T))) + numberOfElementsForOneWord;
-				*(reinterpret_cast<std::size_t*>(baseArrayAddress) - 1) = arrayLength;
+			void DeallocateRelocatable(Handle handle);
+
+			// Current address of the allocation, nullptr if the handle is stale. Only valid until the next Defragment.
+			inline void* Resolve(Handle handle)
+			{
+				std::uint32_t index = handle.value & handleIndexMask;
 
-				for (std::size_t i = 0; i < arrayLength; i++)
+				if (index >= handleSlots.size() || handleSlots[index].generation != (handle.value >> handleIndexBits))
 				{
-					new (&baseArrayAddress[i]) T;
+					return nullptr;
 				}
 
-				return baseArrayAddress;
+				return handleSlots[index].address;
 			}
 
 			template <typename T>
-			void Delete(T* objectToDelete)
+			inline T* Resolve(Handle handle)
 			{
-				objectToDelete->~T();
-				Deallocate(reinterpret_cast<void*&>(objectToDelete));
+				return static_cast<T*>(Resolve(handle));
 			}
 
-			template <typename T>
-			void DeleteArray(T* arrayToDelete)
+			template <typename T, typename... Args>
+			Handle NewRelocatable(Args&&... args)
 			{
-				std::size_t arrayLength = *(reinterpret_cast<std::size_t*>(arrayToDelete) - 1);
+				static_assert(std::is_trivially_copyable<T>::value, "Relocatable objects are moved with memmove");
 
-				for (std::size_t i = 0; i < arrayLength; i++)
+				Handle handle = AllocateRelocatable(sizeof(T), alignof(T));
+				if (handle.IsValid())
 				{
-					arrayToDelete[i].~T();
+					new (Resolve(handle)) T(std::forward<Args>(args)...);
 				}
 
-				arrayToDelete = reinterpret_cast<T*>(reinterpret_cast<std::size_t*>(arrayToDelete) - 1);
-				Deallocate(reinterpret_cast<void*&>(arrayToDelete));
+				return handle;
 			}
+
+			template <typename T>
+			void DeleteRelocatable(Handle handle)
+			{
+				Resolve<T>(handle)->~T();
+				DeallocateRelocatable(handle);
+			}
+
+			// Slides relocatable allocations down into the free blocks in front of them, moving at most about
+			// budgetBytes so the work can be spread over frames. Raw allocations stay where they are. Returns
+			// true once nothing more can be moved.
+			bool Defragment(std::size_t budgetBytes);
+
+			std::size_t GetLargestFreeBlockSize();
+
+			// 0 when all free memory is one block, approaching 1 as it is split into many small ones
+			float GetFragmentation();
 		};
 	}
 }
@@ -10,33 +10,30 @@ namespace Visage
 			: AbstractAllocator(size)
 		{
 			currentPosition = startOfBuffer;
-			endOfBuffer = AddToPointer(startOfBuffer, sizeOfBuffer);
 		}
-		
-		void* Visage::Core::LinearAllocator::Allocate(std::size_t size, std::uint8_t align)
-		{
-			void* alignedAddress = AlignPointer(currentPosition, align);
-			currentPosition = AddToPointer(alignedAddress, size);
-
-			if (reinterpret_cast<std::uintptr_t>(currentPosition) > reinterpret_cast<std::uintptr_t>(endOfBuffer))
-			{
-				return nullptr; // assert out of memory error
-			}
-
-			numberOfAllocations++;
-			memoryUsed += size;
 
-			return alignedAddress;
+		LinearAllocator::LinearAllocator(std::size_t size, const VirtualMemoryPolicy& policy)
+			: AbstractAllocator(size, policy)
+		{
+			currentPosition = startOfBuffer;
 		}
 
-		void LinearAllocator::Deallocate(void*& pointer)
-		{ }
+		LinearAllocator::LinearAllocator(std::size_t size, const PhysicalMemoryPolicy& policy)
+			: AbstractAllocator(size, policy)
+		{
+			currentPosition = startOfBuffer;
+		}
 
 		void LinearAllocator::Reset()
 		{
-			memoryUsed = 0;
-			numberOfAllocations = 0;
+			RecordReset();
 			currentPosition = startOfBuffer;
+			DecommitBuffer();
+		}
+
+		void* LinearAllocator::GetCurrentPosition()
+		{
+			return currentPosition;
 		}
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AbstractAllocator.h"
+#include "MemoryUtils.h"
 #include <cstddef>
 #include <cstdint>
 
@@ -8,57 +9,45 @@ namespace Visage
 {
 	namespace Core
 	{
-		class LinearAllocator : public AbstractAllocator
+		class LinearAllocator : public AbstractAllocator<LinearAllocator>
 		{
+			friend class AllocatorInterface<LinearAllocator>;
+
 		private:
 			void* currentPosition;
-			void* endOfBuffer;
 
 		protected:
-			void* Allocate(std::size_t size, std::uint8_t align) override;
-
-			void Deallocate(void*& pointer) override;
-
-		public:
-			LinearAllocator() = delete;
+			inline void* Allocate(std::size_t size, std::uint8_t align)
+			{
+				void* alignedAddress = AlignPointer(currentPosition, align);
+				void* newPosition = AddToPointer(alignedAddress, size);
 
-			LinearAllocator(std::size_t size);
+				if (reinterpret_cast<std::uintptr_t>(newPosition) > reinterpret_cast<std::uintptr_t>(endOfCommittedBuffer) && !CommitBufferUpTo(newPosition))
+				{
+					return nullptr; // assert out of memory error
+				}
 
-			void Reset();
+				currentPosition = newPosition;
+				RecordAllocation(alignedAddress, size, size);
 
-			template <typename T>
-			T* New()
-			{
-				return new (Allocate(sizeof(T), alignof(T))) T;
+				return alignedAddress;
 			}
 
-			template <typename T, typename... Args>
-			T* NewWithArgs(Args&&... args)
-			{
-				return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
-			}
+			inline void Deallocate(void* pointer)
+			{ }
 
-			template <typename T>
-			T* NewArray(std::size_t arrayLength)
-			{
-				std::uint8_t numberOfElementsForOneWord = sizeof(size_t) / sizeof(T);
+		public:
+			LinearAllocator() = delete;
 
-				if (sizeof(size_t) > (static_cast<std::size_t>(numberOfElementsForOneWord) * sizeof(T)))
-				{
-					numberOfElementsForOneWord += 1;
-				}
+			LinearAllocator(std::size_t size);
 
-				T* baseArrayAddress = reinterpret_cast<T*>(Allocate((arrayLength + numberOfElementsForOneWord) * sizeof(T), alignof(T))) + numberOfElementsForOneWord;
-				*(reinterpret_cast<std::size_t*>(baseArrayAddress) - 1) = arrayLength;
+			LinearAllocator(std::size_t size, const VirtualMemoryPolicy& policy);
 
-				for (std::size_t i = 0; i < arrayLength; i++)
-				{
-					new (&baseArrayAddress[i]) T;
-				}
+			LinearAllocator(std::size_t size, const PhysicalMemoryPolicy& policy);
 
-				return baseArrayAddress;
-			}
+			void Reset();
+
+			void* GetCurrentPosition();
 		};
 	}
 }
-
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "ThreadUtils.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Lock free pool that any number of threads can allocate from and free to concurrently. The free list
+		// is a Treiber stack of chunk indices whose head carries a version tag, so a chunk that is popped and
+		// pushed back between another thread's load and compare exchange cannot cause an ABA corruption.
+		template <typename T>
+		class LockFreePoolAllocator
+		{
+		private:
+			struct ChunkNode {
+				std::atomic<std::uint32_t> nextFreeChunk;
+			};
+
+			static const std::uint32_t nullChunkIndex = 0xFFFFFFFF;
+
+			std::size_t chunksPerBlock;
+			std::uint8_t* startOfBuffer;
+			void* firstChunk;
+
+			// Low 32 bits hold the index of the first free chunk, high 32 bits hold the version tag
+			alignas(cacheLineSize) std::atomic<std::uint64_t> freeChunkListHead;
+			alignas(cacheLineSize) std::atomic<std::size_t> numberOfAllocations;
+
+			static inline std::uint64_t PackListHead(std::uint32_t chunkIndex, std::uint32_t tag)
+			{
+				return (static_cast<std::uint64_t>(tag) << 32) | chunkIndex;
+			}
+
+			static inline std::uint32_t GetListHeadChunkIndex(std::uint64_t listHead)
+			{
+				return static_cast<std::uint32_t>(listHead);
+			}
+
+			static inline std::uint32_t GetListHeadTag(std::uint64_t listHead)
+			{
+				return static_cast<std::uint32_t>(listHead >> 32);
+			}
+
+			ChunkNode* GetChunk(std::uint32_t chunkIndex);
+
+			std::uint32_t GetChunkIndex(const void* pointer);
+
+			void* Allocate();
+
+			void Deallocate(void* pointer);
+
+		public:
+			LockFreePoolAllocator() = delete;
+
+			LockFreePoolAllocator(std::size_t objectsPerBlock);
+
+			LockFreePoolAllocator(const LockFreePoolAllocator& allocator) = delete;
+			LockFreePoolAllocator& operator=(const LockFreePoolAllocator& allocator) = delete;
+
+			~LockFreePoolAllocator();
+
+			inline std::size_t GetNumberOfAllocations()
+			{
+				return numberOfAllocations.load(std::memory_order_relaxed);
+			}
+
+			inline std::size_t GetMemoryUsed()
+			{
+				return GetNumberOfAllocations() * sizeof(T);
+			}
+
+			T* New()
+			{
+				return new (Allocate()) T;
+			}
+
+			template <typename... Args>
+			T* NewWithArgs(Args&&... args)
+			{
+				return new (Allocate()) T(std::forward<Args>(args)...);
+			}
+
+			void Delete(T* objectToDelete)
+			{
+				objectToDelete->~T();
+				Deallocate(objectToDelete);
+			}
+		};
+	}
+}
+
+#include "LockFreePoolAllocator.inl"
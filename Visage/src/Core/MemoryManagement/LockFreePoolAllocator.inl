@@ -0,0 +1,126 @@
+#pragma once
+
+#include "LockFreePoolAllocator.h"
+#include "AllocationTrace.h"
+#include "MemoryChecking.h"
+#include "MemoryUtils.h"
+#include <cstring>
+
+namespace Visage
+{
+	namespace Core
+	{
+		template <typename T>
+		LockFreePoolAllocator<T>::LockFreePoolAllocator(std::size_t objectsPerBlock)
+			: chunksPerBlock(objectsPerBlock), freeChunkListHead(PackListHead(nullChunkIndex, 0)), numberOfAllocations(0)
+		{
+			assert(sizeof(T) >= sizeof(ChunkNode));
+			assert(objectsPerBlock > 0 && objectsPerBlock < nullChunkIndex);
+
+			startOfBuffer = new std::uint8_t[(objectsPerBlock * sizeof(T)) + alignof(T)];
+
+			std::uint8_t adjustment = AlignedPointerAdjustment(startOfBuffer, alignof(T));
+			firstChunk = AddToPointer(startOfBuffer, adjustment);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				std::memset(firstChunk, MemoryChecker::freedFill, objectsPerBlock * sizeof(T));
+			#endif
+
+			for (std::uint32_t i = 0; i < objectsPerBlock; i++)
+			{
+				std::uint32_t nextChunkIndex = (i + 1 < objectsPerBlock) ? i + 1 : nullChunkIndex;
+				new (GetChunk(i)) ChunkNode{ { nextChunkIndex } };
+			}
+
+			freeChunkListHead.store(PackListHead(0, 0), std::memory_order_release);
+		}
+
+		template <typename T>
+		LockFreePoolAllocator<T>::~LockFreePoolAllocator()
+		{
+			#ifdef DEBUG
+				assert(GetNumberOfAllocations() == 0);
+			#endif
+
+			delete[] startOfBuffer;
+		}
+
+		template <typename T>
+		typename LockFreePoolAllocator<T>::ChunkNode* LockFreePoolAllocator<T>::GetChunk(std::uint32_t chunkIndex)
+		{
+			return reinterpret_cast<ChunkNode*>(AddToPointer(firstChunk, static_cast<std::size_t>(chunkIndex) * sizeof(T)));
+		}
+
+		template <typename T>
+		std::uint32_t LockFreePoolAllocator<T>::GetChunkIndex(const void* pointer)
+		{
+			std::uintptr_t offset = PointerDiff(pointer, firstChunk);
+			assert(offset % sizeof(T) == 0 && offset / sizeof(T) < chunksPerBlock);
+
+			return static_cast<std::uint32_t>(offset / sizeof(T));
+		}
+
+		template <typename T>
+		void* LockFreePoolAllocator<T>::Allocate()
+		{
+			std::uint64_t listHead = freeChunkListHead.load(std::memory_order_acquire);
+			std::uint32_t chunkIndex;
+
+			do
+			{
+				chunkIndex = GetListHeadChunkIndex(listHead);
+
+				if (chunkIndex == nullChunkIndex)
+				{
+					return nullptr;
+				}
+
+				// The chunk may already have been handed out by another thread, in which case the tag check below fails
+				std::uint32_t nextChunkIndex = GetChunk(chunkIndex)->nextFreeChunk.load(std::memory_order_relaxed);
+				std::uint64_t newListHead = PackListHead(nextChunkIndex, GetListHeadTag(listHead) + 1);
+
+				if (freeChunkListHead.compare_exchange_weak(listHead, newListHead, std::memory_order_acquire, std::memory_order_acquire))
+				{
+					break;
+				}
+			} while (true);
+
+			numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				MemoryChecker::CheckPoisonedChunk(GetChunk(chunkIndex), sizeof(T), sizeof(ChunkNode));
+			#endif
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				AllocationTrace::RecordAllocation(this, GetChunk(chunkIndex), sizeof(T), alignof(T));
+			#endif
+
+			return GetChunk(chunkIndex);
+		}
+
+		template <typename T>
+		void LockFreePoolAllocator<T>::Deallocate(void* pointer)
+		{
+			std::uint32_t chunkIndex = GetChunkIndex(pointer);
+			ChunkNode* newChunkNode = reinterpret_cast<ChunkNode*>(pointer);
+			std::uint64_t listHead = freeChunkListHead.load(std::memory_order_relaxed);
+			std::uint64_t newListHead;
+
+			#ifdef VISAGE_ALLOCATION_TRACING
+				AllocationTrace::RecordDeallocation(this, pointer);
+			#endif
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				MemoryChecker::PoisonChunk(pointer, sizeof(T), sizeof(ChunkNode));
+			#endif
+
+			do
+			{
+				newChunkNode->nextFreeChunk.store(GetListHeadChunkIndex(listHead), std::memory_order_relaxed);
+				newListHead = PackListHead(chunkIndex, GetListHeadTag(listHead) + 1);
+			} while (!freeChunkListHead.compare_exchange_weak(listHead, newListHead, std::memory_order_release, std::memory_order_relaxed));
+
+			numberOfAllocations.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+}
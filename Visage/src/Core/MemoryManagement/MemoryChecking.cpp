@@ -0,0 +1,246 @@
+#include "MemoryChecking.h"
+
+#ifdef VISAGE_MEMORY_CHECKING
+	#include "MemoryUtils.h"
+	#include <cstdio>
+	#include <cstdlib>
+	#include <cstring>
+	#include <thread>
+#endif
+
+namespace Visage
+{
+	namespace Core
+	{
+		#ifdef VISAGE_MEMORY_CHECKING
+			static bool IsFilledWith(const void* address, std::size_t size, std::uint8_t value)
+			{
+				const std::uint8_t* bytes = static_cast<const std::uint8_t*>(address);
+
+				for (std::size_t i = 0; i < size; i++)
+				{
+					if (bytes[i] != value)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			void MemoryChecker::ReportError(const char* error, const void* pointer)
+			{
+				std::fprintf(stderr, "Visage memory check failed: %s (block %p)\n", error, pointer);
+				std::fflush(stderr);
+				std::abort();
+			}
+
+			MemoryChecker::GuardHeader* MemoryChecker::GetHeader(void* pointer)
+			{
+				return reinterpret_cast<GuardHeader*>(SubtractFromPointer(pointer, guardSize + sizeof(GuardHeader)));
+			}
+
+			std::uint8_t MemoryChecker::GetGuardedAlign(std::uint8_t align)
+			{
+				return (align < alignof(GuardHeader)) ? static_cast<std::uint8_t>(alignof(GuardHeader)) : align;
+			}
+
+			std::size_t MemoryChecker::GetGuardedSize(std::size_t size, std::uint8_t align)
+			{
+				std::size_t guardedAlign = GetGuardedAlign(align);
+				std::size_t prefixSize = (sizeof(GuardHeader) + guardSize + guardedAlign - 1) & ~(guardedAlign - 1);
+
+				return prefixSize + size + guardSize;
+			}
+
+			void* MemoryChecker::GuardAllocation(void* blockAddress, std::size_t size, std::uint8_t align)
+			{
+				std::size_t guardedAlign = GetGuardedAlign(align);
+				std::size_t prefixSize = (sizeof(GuardHeader) + guardSize + guardedAlign - 1) & ~(guardedAlign - 1);
+				void* pointer = AddToPointer(blockAddress, prefixSize);
+
+				GuardHeader* header = GetHeader(pointer);
+				header->size = size;
+				header->state = allocatedState;
+				header->prefixSize = static_cast<std::uint32_t>(prefixSize);
+
+				std::memset(SubtractFromPointer(pointer, guardSize), guardFill, guardSize);
+				std::memset(pointer, allocatedFill, size);
+				std::memset(AddToPointer(pointer, size), guardFill, guardSize);
+
+				return pointer;
+			}
+
+			void* MemoryChecker::CheckDeallocation(void* pointer)
+			{
+				GuardHeader* header = GetHeader(pointer);
+
+				if (header->state == freedState)
+				{
+					ReportError("double free", pointer);
+				}
+
+				if (header->state != allocatedState)
+				{
+					ReportError("freeing a pointer that was not allocated or whose header was overwritten", pointer);
+				}
+
+				if (!IsFilledWith(SubtractFromPointer(pointer, guardSize), guardSize, guardFill))
+				{
+					ReportError("buffer underrun, front guard overwritten", pointer);
+				}
+
+				if (!IsFilledWith(AddToPointer(pointer, header->size), guardSize, guardFill))
+				{
+					ReportError("buffer overrun, back guard overwritten", pointer);
+				}
+
+				header->state = freedState;
+				std::memset(pointer, freedFill, header->size);
+
+				return SubtractFromPointer(pointer, header->prefixSize);
+			}
+
+			void* MemoryChecker::CheckQuarantinedBlock(void* pointer)
+			{
+				GuardHeader* header = GetHeader(pointer);
+
+				if (header->state != freedState || !IsFilledWith(pointer, header->size, freedFill) ||
+					!IsFilledWith(SubtractFromPointer(pointer, guardSize), guardSize, guardFill) || !IsFilledWith(AddToPointer(pointer, header->size), guardSize, guardFill))
+				{
+					ReportError("use after free, block was written to while in quarantine", pointer);
+				}
+
+				return SubtractFromPointer(pointer, header->prefixSize);
+			}
+
+			std::size_t MemoryChecker::GetGuardedBlockSize(void* pointer)
+			{
+				GuardHeader* header = GetHeader(pointer);
+				return header->prefixSize + header->size + guardSize;
+			}
+
+			void MemoryChecker::PoisonChunk(void* chunk, std::size_t chunkSize, std::size_t linkSize)
+			{
+				// Chunks no larger than the link cannot be told apart from live ones
+				if (chunkSize > linkSize && IsFilledWith(AddToPointer(chunk, linkSize), chunkSize - linkSize, freedFill))
+				{
+					ReportError("double free of a pool chunk", chunk);
+				}
+
+				std::memset(chunk, freedFill, chunkSize);
+			}
+
+			void MemoryChecker::CheckPoisonedChunk(void* chunk, std::size_t chunkSize, std::size_t linkSize)
+			{
+				if (!IsFilledWith(AddToPointer(chunk, linkSize), chunkSize - linkSize, freedFill))
+				{
+					ReportError("use after free, pool chunk was written to after it was freed", chunk);
+				}
+
+				std::memset(chunk, allocatedFill, chunkSize);
+			}
+
+			MemoryQuarantine::MemoryQuarantine()
+				: entries(nullptr), head(0), count(0), numberOfBytes(0), byteLimit(0), locked(false)
+			{ }
+
+			MemoryQuarantine::MemoryQuarantine(const MemoryQuarantine& quarantine)
+				: MemoryQuarantine()
+			{
+				byteLimit = quarantine.byteLimit;
+			}
+
+			MemoryQuarantine& MemoryQuarantine::operator=(const MemoryQuarantine& quarantine)
+			{
+				return *this;
+			}
+
+			MemoryQuarantine::~MemoryQuarantine()
+			{
+				std::free(entries);
+			}
+
+			void MemoryQuarantine::Lock()
+			{
+				while (locked.exchange(true, std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			void MemoryQuarantine::Unlock()
+			{
+				locked.store(false, std::memory_order_release);
+			}
+
+			void MemoryQuarantine::SetByteLimit(std::size_t limit)
+			{
+				Lock();
+				byteLimit = limit;
+				Unlock();
+			}
+
+			bool MemoryQuarantine::Push(void* pointer, std::size_t size)
+			{
+				Lock();
+
+				// malloc rather than new, the quarantine of the default heap must not allocate from the heap itself
+				if (entries == nullptr)
+				{
+					entries = static_cast<Entry*>(std::malloc(VISAGE_MEMORY_QUARANTINE_SIZE * sizeof(Entry)));
+				}
+
+				// Without storage for the entries the block is released right away, PopExcess keeps room for the next one
+				if (entries == nullptr || count == VISAGE_MEMORY_QUARANTINE_SIZE)
+				{
+					Unlock();
+					return false;
+				}
+
+				entries[(head + count) % VISAGE_MEMORY_QUARANTINE_SIZE] = { pointer, size };
+				count++;
+				numberOfBytes += size;
+
+				Unlock();
+				return true;
+			}
+
+			void* MemoryQuarantine::PopExcess()
+			{
+				Lock();
+
+				void* pointer = nullptr;
+
+				if (count == VISAGE_MEMORY_QUARANTINE_SIZE || (byteLimit != 0 && numberOfBytes > byteLimit && count > 0))
+				{
+					pointer = entries[head].pointer;
+					numberOfBytes -= entries[head].size;
+					head = (head + 1) % VISAGE_MEMORY_QUARANTINE_SIZE;
+					count--;
+				}
+
+				Unlock();
+				return pointer;
+			}
+
+			void* MemoryQuarantine::Pop()
+			{
+				Lock();
+
+				void* pointer = nullptr;
+
+				if (count > 0)
+				{
+					pointer = entries[head].pointer;
+					numberOfBytes -= entries[head].size;
+					head = (head + 1) % VISAGE_MEMORY_QUARANTINE_SIZE;
+					count--;
+				}
+
+				Unlock();
+				return pointer;
+			}
+		#endif
+	}
+}
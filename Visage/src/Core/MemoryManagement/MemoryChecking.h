@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Opt-in checking of every allocation made through the allocators, for soak tests that should exercise the
+// engine's own allocators rather than the sanitizers' replacement heap. Define VISAGE_MEMORY_CHECKING for the
+// whole build, blocks then get guard bands and fill patterns, frees are checked and delayed in a quarantine.
+#ifdef VISAGE_MEMORY_CHECKING
+	#ifndef VISAGE_MEMORY_QUARANTINE_SIZE
+		// Most freed blocks each allocator holds back before actually releasing them
+		#define VISAGE_MEMORY_QUARANTINE_SIZE 1024
+	#endif
+
+	#ifndef VISAGE_MEMORY_QUARANTINE_FRACTION
+		// The quarantine also holds back at most 1/VISAGE_MEMORY_QUARANTINE_FRACTION of the allocator's capacity in bytes
+		#define VISAGE_MEMORY_QUARANTINE_FRACTION 8
+	#endif
+#endif
+
+namespace Visage
+{
+	namespace Core
+	{
+		class AllocatorRef;
+		class StackAllocator;
+		class DoubleEndedStackAllocator;
+		class LinearAllocator;
+		class ConcurrentLinearAllocator;
+		class FrameAllocator;
+
+		template <typename T>
+		class PoolAllocator;
+
+		enum class MemoryCheckLevel : std::uint8_t
+		{
+			// Forwarding allocators whose target does the checking, and pools which poison their chunks themselves
+			None,
+
+			// Allocators that must free in order or release in bulk, so freed blocks cannot be held back
+			Guards,
+
+			GuardsAndQuarantine
+		};
+
+		template <typename Allocator>
+		struct MemoryCheckTraits
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::GuardsAndQuarantine;
+		};
+
+		template <>
+		struct MemoryCheckTraits<AllocatorRef>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::None;
+		};
+
+		template <typename T>
+		struct MemoryCheckTraits<PoolAllocator<T>>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::None;
+		};
+
+		template <>
+		struct MemoryCheckTraits<StackAllocator>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::Guards;
+		};
+
+		template <>
+		struct MemoryCheckTraits<DoubleEndedStackAllocator>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::Guards;
+		};
+
+		template <>
+		struct MemoryCheckTraits<LinearAllocator>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::Guards;
+		};
+
+		template <>
+		struct MemoryCheckTraits<ConcurrentLinearAllocator>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::Guards;
+		};
+
+		template <>
+		struct MemoryCheckTraits<FrameAllocator>
+		{
+			static const MemoryCheckLevel level = MemoryCheckLevel::Guards;
+		};
+
+		#ifdef VISAGE_MEMORY_CHECKING
+			// Guarded block layout: [padding][GuardHeader][front guard][user data][back guard]. The user data keeps the
+			// requested alignment, the header sits right in front of the front guard so it is found from the pointer.
+			class MemoryChecker
+			{
+			private:
+				struct GuardHeader {
+					std::size_t size;
+					std::uint32_t state;
+					std::uint32_t prefixSize;
+				};
+
+				static const std::size_t guardSize = 16;
+
+				static const std::uint32_t allocatedState = 0xA110CA7E;
+				static const std::uint32_t freedState = 0xF4EED0FF;
+
+				static GuardHeader* GetHeader(void* pointer);
+
+			public:
+				static const std::uint8_t guardFill = 0xFD;
+				static const std::uint8_t allocatedFill = 0xCD;
+				static const std::uint8_t freedFill = 0xDD;
+
+				// Writes the error and the block address to stderr and aborts, checks stay active with NDEBUG
+				[[noreturn]] static void ReportError(const char* error, const void* pointer);
+
+				static std::uint8_t GetGuardedAlign(std::uint8_t align);
+
+				static std::size_t GetGuardedSize(std::size_t size, std::uint8_t align);
+
+				// Lays the guards around a block returned by the allocator, returns the pointer handed to the caller
+				static void* GuardAllocation(void* blockAddress, std::size_t size, std::uint8_t align);
+
+				// Verifies the state and guards of a block being freed, fills it with the freed pattern and returns the
+				// address the allocator handed out
+				static void* CheckDeallocation(void* pointer);
+
+				// Verifies a block leaving the quarantine was not written to after it was freed
+				static void* CheckQuarantinedBlock(void* pointer);
+
+				// Bytes the allocator handed out for the guarded block of a pointer returned by GuardAllocation
+				static std::size_t GetGuardedBlockSize(void* pointer);
+
+				// Fills a freed pool chunk after its free list link and reports a chunk freed twice
+				static void PoisonChunk(void* chunk, std::size_t chunkSize, std::size_t linkSize);
+
+				// Verifies the poison of a chunk about to be reused and fills it with the allocated pattern
+				static void CheckPoisonedChunk(void* chunk, std::size_t chunkSize, std::size_t linkSize);
+			};
+
+			// FIFO of freed blocks that are not given back to their allocator yet, so stale pointers keep pointing at
+			// the freed pattern for a while. Bounded by VISAGE_MEMORY_QUARANTINE_SIZE blocks and by a byte limit set from
+			// the allocator's capacity. Thread safe, copies start out empty with the same byte limit.
+			class MemoryQuarantine
+			{
+			private:
+				struct Entry {
+					void* pointer;
+					std::size_t size;
+				};
+
+				Entry* entries;
+				std::size_t head;
+				std::size_t count;
+				std::size_t numberOfBytes;
+				std::size_t byteLimit;
+				std::atomic<bool> locked;
+
+				void Lock();
+
+				void Unlock();
+
+			public:
+				MemoryQuarantine();
+
+				MemoryQuarantine(const MemoryQuarantine& quarantine);
+				MemoryQuarantine& operator=(const MemoryQuarantine& quarantine);
+
+				~MemoryQuarantine();
+
+				// 0 leaves only the limit on the number of blocks, for allocators without a fixed capacity
+				void SetByteLimit(std::size_t limit);
+
+				// Queues the block, false if there is no room to track it and it has to be released right away
+				bool Push(void* pointer, std::size_t size);
+
+				// The oldest block while the quarantine is over one of its limits, nullptr otherwise
+				void* PopExcess();
+
+				// nullptr once the quarantine is empty
+				void* Pop();
+			};
+		#endif
+	}
+}
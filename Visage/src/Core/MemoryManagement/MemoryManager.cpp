@@ -1,23 +1,340 @@
-
+#include "MemoryManager.h"
+#include <cstdlib>
+#include <new>
 
 namespace Visage
 {
-    namespace Core
-    {
-        class MemoryManager
-        {
-            public:
-                MemoryManager& GetInstance();
+	namespace Core
+	{
+		// Constant initialized, operator new may run before any dynamic initialization
+		std::atomic<MemoryManager*> MemoryManager::manager(nullptr);
+
+		std::atomic<ConcurrentFreeListAllocator*> MemoryManager::defaultHeap(nullptr);
+
+		std::atomic<std::size_t> MemoryManager::numberOfFallbackAllocations(0);
+
+		// Set while a thread is inside the default heap, whose own bookkeeping allocations must not re-enter it
+		static thread_local bool insideDefaultHeap = false;
+
+		static void* AllocateFallback(std::size_t size, std::size_t align)
+		{
+			// operator new must hand out a unique pointer even for zero sized requests
+			if (size == 0)
+			{
+				size = 1;
+			}
+
+			if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				return std::malloc(size);
+			}
+
+			#ifdef _MSC_VER
+				return _aligned_malloc(size, align);
+			#else
+				return std::aligned_alloc(align, (size + align - 1) & ~(align - 1));
+			#endif
+		}
+
+		static void DeallocateFallback(void* pointer, std::size_t align)
+		{
+			if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				std::free(pointer);
+				return;
+			}
+
+			#ifdef _MSC_VER
+				_aligned_free(pointer);
+			#else
+				std::free(pointer);
+			#endif
+		}
+
+		MemoryManager::MemoryManager(const MemoryManagerConfig& config)
+			: frameArena(config.frameArenaSize, config.numberOfFrameBuffers, config.scratchArenaPolicy), levelArena(config.levelArenaSize, config.scratchArenaPolicy),
+			  persistentArena(config.persistentArenaSize, config.persistentArenaPolicy), audioArena(config.audioArenaSize),
+			  renderStagingArena(config.renderStagingArenaSize, config.scratchArenaPolicy), frameIndex(0)
+		{
+			frameArena.SetName(GetArenaName(MemoryArena::Frame));
+			levelArena.SetName(GetArenaName(MemoryArena::Level));
+			persistentArena.SetName(GetArenaName(MemoryArena::Persistent));
+			audioArena.SetName(GetArenaName(MemoryArena::Audio));
+			renderStagingArena.SetName(GetArenaName(MemoryArena::RenderStaging));
+		}
+
+		void MemoryManager::Initialize(const MemoryManagerConfig& config)
+		{
+			assert(manager.load(std::memory_order_relaxed) == nullptr);
+
+			// Nothing is routed yet, so the arenas and their buffers come from malloc
+			if (defaultHeap.load(std::memory_order_relaxed) == nullptr)
+			{
+				ConcurrentFreeListAllocator* heap = new ConcurrentFreeListAllocator(config.defaultHeapSize);
+				heap->SetName("DefaultHeap");
+				defaultHeap.store(heap, std::memory_order_release);
+			}
+
+			// Other threads that see the manager also see the constructed heap and arenas
+			manager.store(new MemoryManager(config), std::memory_order_release);
+		}
+
+		void MemoryManager::Shutdown()
+		{
+			assert(manager.load(std::memory_order_relaxed) != nullptr);
+
+			MemoryManager* managerToDelete = manager.load(std::memory_order_relaxed);
+			manager.store(nullptr, std::memory_order_release);
+			delete managerToDelete;
+
+			// The heap stays published, a thread that saw the manager before the store above may still be allocating
+			// from it and global objects return their memory to it as they are destroyed
+			ConcurrentFreeListAllocator* heap = defaultHeap.load(std::memory_order_relaxed);
+			assert(heap != nullptr);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				heap->FlushQuarantine();
+			#endif
+		}
+
+		AllocatorRef MemoryManager::GetArena(MemoryArena arena)
+		{
+			switch (arena)
+			{
+				case MemoryArena::Frame:
+					return AllocatorRef(frameArena);
+				case MemoryArena::Level:
+					return AllocatorRef(levelArena);
+				case MemoryArena::Persistent:
+					return AllocatorRef(persistentArena);
+				case MemoryArena::Audio:
+					return AllocatorRef(audioArena);
+				default:
+					assert(arena == MemoryArena::RenderStaging);
+					return AllocatorRef(renderStagingArena);
+			}
+		}
+
+		std::size_t MemoryManager::GetArenaMemoryUsed(MemoryArena arena)
+		{
+			switch (arena)
+			{
+				case MemoryArena::Frame:
+					return frameArena.GetMemoryUsed();
+				case MemoryArena::Level:
+					return levelArena.GetMemoryUsed();
+				case MemoryArena::Persistent:
+					return persistentArena.GetMemoryUsed();
+				case MemoryArena::Audio:
+					return audioArena.GetMemoryUsed();
+				default:
+					assert(arena == MemoryArena::RenderStaging);
+					return renderStagingArena.GetMemoryUsed();
+			}
+		}
+
+		std::size_t MemoryManager::GetArenaNumberOfAllocations(MemoryArena arena)
+		{
+			switch (arena)
+			{
+				case MemoryArena::Frame:
+					return frameArena.GetNumberOfAllocations();
+				case MemoryArena::Level:
+					return levelArena.GetNumberOfAllocations();
+				case MemoryArena::Persistent:
+					return persistentArena.GetNumberOfAllocations();
+				case MemoryArena::Audio:
+					return audioArena.GetNumberOfAllocations();
+				default:
+					assert(arena == MemoryArena::RenderStaging);
+					return renderStagingArena.GetNumberOfAllocations();
+			}
+		}
+
+		const char* MemoryManager::GetArenaName(MemoryArena arena)
+		{
+			static const char* const arenaNames[] = { "Frame", "Level", "Persistent", "Audio", "RenderStaging" };
+			static_assert(sizeof(arenaNames) / sizeof(arenaNames[0]) == static_cast<std::size_t>(MemoryArena::Count), "Missing arena name");
+
+			assert(arena < MemoryArena::Count);
+			return arenaNames[static_cast<std::size_t>(arena)];
+		}
+
+		void* MemoryManager::AllocateUntagged(std::size_t size, std::size_t align)
+		{
+			void* alignedAddress = nullptr;
+
+			if (manager.load(std::memory_order_acquire) != nullptr && !insideDefaultHeap && align <= 128)
+			{
+				ConcurrentFreeListAllocator* heap = defaultHeap.load(std::memory_order_acquire);
+
+				if (heap != nullptr)
+				{
+					insideDefaultHeap = true;
+					alignedAddress = heap->AllocateBytes(size, static_cast<std::uint8_t>(align));
+					insideDefaultHeap = false;
+				}
+			}
+
+			if (alignedAddress == nullptr)
+			{
+				numberOfFallbackAllocations.fetch_add(1, std::memory_order_relaxed);
+				alignedAddress = AllocateFallback(size, align);
+			}
+
+			return alignedAddress;
+		}
+
+		void MemoryManager::DeallocateUntagged(void* pointer, std::size_t align)
+		{
+			if (pointer == nullptr)
+			{
+				return;
+			}
+
+			ConcurrentFreeListAllocator* heap = defaultHeap.load(std::memory_order_acquire);
+
+			if (heap != nullptr && heap->Owns(pointer))
+			{
+				bool wasInsideDefaultHeap = insideDefaultHeap;
+				insideDefaultHeap = true;
+				heap->DeallocateBytes(pointer);
+				insideDefaultHeap = wasInsideDefaultHeap;
+			}
+			else
+			{
+				DeallocateFallback(pointer, align);
+			}
+		}
+
+		std::size_t MemoryManager::GetNumberOfUntaggedAllocations()
+		{
+			ConcurrentFreeListAllocator* heap = defaultHeap.load(std::memory_order_acquire);
+			return (heap != nullptr) ? heap->GetNumberOfAllocations() : 0;
+		}
+
+		std::size_t MemoryManager::GetUntaggedMemoryUsed()
+		{
+			ConcurrentFreeListAllocator* heap = defaultHeap.load(std::memory_order_acquire);
+			return (heap != nullptr) ? heap->GetMemoryUsed() : 0;
+		}
+	}
+}
+
+#ifndef VISAGE_DISABLE_GLOBAL_NEW
+
+void* operator new(std::size_t size)
+{
+	void* pointer = Visage::Core::MemoryManager::AllocateUntagged(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+	if (pointer == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Visage::Core::MemoryManager::AllocateUntagged(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Visage::Core::MemoryManager::AllocateUntagged(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+	void* pointer = Visage::Core::MemoryManager::AllocateUntagged(size, static_cast<std::size_t>(align));
 
-                
+	if (pointer == nullptr)
+	{
+		throw std::bad_alloc();
+	}
 
-            private:
-                MemoryManager();
-                MemoryManager(const MemoryManager& manager) = delete;
-                MemoryManager& operator=(const MemoryManager& manager) = delete;
+	return pointer;
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+	return operator new(size, align);
+}
 
-                static MemoryManager* manager;
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+	return Visage::Core::MemoryManager::AllocateUntagged(size, static_cast<std::size_t>(align));
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+	return Visage::Core::MemoryManager::AllocateUntagged(size, static_cast<std::size_t>(align));
+}
+
+void operator delete(void* pointer) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::size_t size) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, std::size_t size) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t align) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, static_cast<std::size_t>(align));
+}
+
+void operator delete[](void* pointer, std::align_val_t align) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, static_cast<std::size_t>(align));
+}
+
+void operator delete(void* pointer, std::size_t size, std::align_val_t align) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, static_cast<std::size_t>(align));
+}
+
+void operator delete[](void* pointer, std::size_t size, std::align_val_t align) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, static_cast<std::size_t>(align));
+}
+
+void operator delete(void* pointer, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, static_cast<std::size_t>(align));
+}
+
+void operator delete[](void* pointer, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+	Visage::Core::MemoryManager::DeallocateUntagged(pointer, static_cast<std::size_t>(align));
+}
 
-        };
-    }
-}
\ No newline at end of file
+#endif
\ No newline at end of file
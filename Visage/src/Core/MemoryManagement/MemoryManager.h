@@ -0,0 +1,161 @@
+#pragma once
+
+#include "AllocatorRef.h"
+#include "ConcurrentFreeListAllocator.h"
+#include "FrameAllocator.h"
+#include "FreeListAllocator.h"
+#include "LinearAllocator.h"
+#include "SegregatedFreeListAllocator.h"
+#include "StackAllocator.h"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+
+namespace Visage
+{
+	namespace Core
+	{
+		enum class MemoryArena
+		{
+			Frame,
+			Level,
+			Persistent,
+			Audio,
+			RenderStaging,
+			Count
+		};
+
+		// Arena sizes in bytes, read once by MemoryManager::Initialize
+		struct MemoryManagerConfig
+		{
+			// Size of each frame buffer, more buffers let the GPU and jobs hold on to a frame's memory for longer
+			std::size_t frameArenaSize = 16 * 1024 * 1024;
+			std::size_t numberOfFrameBuffers = 3;
+			std::size_t levelArenaSize = 256 * 1024 * 1024;
+			std::size_t persistentArenaSize = 64 * 1024 * 1024;
+			std::size_t audioArenaSize = 32 * 1024 * 1024;
+			std::size_t renderStagingArenaSize = 64 * 1024 * 1024;
+
+			// The frame, level and render staging arenas only reserve their size and commit pages as they fill up
+			VirtualMemoryPolicy scratchArenaPolicy;
+
+			// The persistent arena lives for the whole run, so it is mapped up front on huge pages where available
+			PhysicalMemoryPolicy persistentArenaPolicy;
+
+			// Backs the global operator new/delete, requests that do not fit fall back to malloc
+			std::size_t defaultHeapSize = 256 * 1024 * 1024;
+		};
+
+		// Owns the engine's named arenas and the default heap that global operator new/delete are routed to.
+		// Apart from the frame arena the named arenas are not thread safe, each one belongs to the subsystem that
+		// allocates from it. Allocations made before Initialize, re-entrant ones from inside the heap and ones
+		// the heap cannot satisfy go to malloc and are counted as fallback allocations.
+		class MemoryManager
+		{
+		private:
+			FrameAllocator frameArena;
+			StackAllocator levelArena;
+			FreeListAllocator persistentArena;
+			SegregatedFreeListAllocator audioArena;
+			LinearAllocator renderStagingArena;
+			std::size_t frameIndex;
+
+			// Read by global operator new and delete on every thread, Initialize and Shutdown publish them with release
+			// stores and the untagged paths read them with acquire loads
+			static std::atomic<MemoryManager*> manager;
+
+			// Created by the first Initialize and never deleted, other threads may still be inside it or hold its
+			// memory when Shutdown runs. A later Initialize reuses it.
+			static std::atomic<ConcurrentFreeListAllocator*> defaultHeap;
+
+			static std::atomic<std::size_t> numberOfFallbackAllocations;
+
+			MemoryManager(const MemoryManagerConfig& config);
+
+		public:
+			MemoryManager() = delete;
+			MemoryManager(const MemoryManager& manager) = delete;
+			MemoryManager& operator=(const MemoryManager& manager) = delete;
+
+			// Creates the arenas and starts routing global operator new to the default heap
+			static void Initialize(const MemoryManagerConfig& config = MemoryManagerConfig());
+
+			// Destroys the arenas, no other thread may use them any more. Global operator new goes to malloc from here
+			// on, threads still allocating may finish in the default heap, which stays alive for the blocks it holds.
+			static void Shutdown();
+
+			static inline bool IsInitialized()
+			{
+				return manager.load(std::memory_order_acquire) != nullptr;
+			}
+
+			static inline MemoryManager& GetInstance()
+			{
+				MemoryManager* instance = manager.load(std::memory_order_acquire);
+				assert(instance != nullptr);
+				return *instance;
+			}
+
+			// Moves the frame arena to its next buffer, waiting until the frame that last used it has been released
+			inline void EndFrame()
+			{
+				frameArena.AdvanceFrame();
+				frameIndex++;
+			}
+
+			inline std::size_t GetFrameIndex()
+			{
+				return frameIndex;
+			}
+
+			inline FrameAllocator& GetFrameArena()
+			{
+				return frameArena;
+			}
+
+			inline StackAllocator& GetLevelArena()
+			{
+				return levelArena;
+			}
+
+			inline FreeListAllocator& GetPersistentArena()
+			{
+				return persistentArena;
+			}
+
+			inline SegregatedFreeListAllocator& GetAudioArena()
+			{
+				return audioArena;
+			}
+
+			inline LinearAllocator& GetRenderStagingArena()
+			{
+				return renderStagingArena;
+			}
+
+			AllocatorRef GetArena(MemoryArena arena);
+
+			std::size_t GetArenaMemoryUsed(MemoryArena arena);
+
+			std::size_t GetArenaNumberOfAllocations(MemoryArena arena);
+
+			static const char* GetArenaName(MemoryArena arena);
+
+			// Entry points of the global operator new/delete, align has to match between the two calls
+			static void* AllocateUntagged(std::size_t size, std::size_t align);
+
+			static void DeallocateUntagged(void* pointer, std::size_t align);
+
+			// Global operator new traffic served by the default heap
+			static std::size_t GetNumberOfUntaggedAllocations();
+
+			static std::size_t GetUntaggedMemoryUsed();
+
+			// Total number of global operator new calls that went to malloc instead
+			static inline std::size_t GetNumberOfFallbackAllocations()
+			{
+				return numberOfFallbackAllocations.load(std::memory_order_relaxed);
+			}
+		};
+	}
+}
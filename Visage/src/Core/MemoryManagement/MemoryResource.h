@@ -0,0 +1,65 @@
+#pragma once
+
+#include "AllocatorInterface.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// std::pmr::memory_resource bridge to a Visage allocator, so std::pmr containers can be pointed at an
+		// allocator at runtime without changing their type, e.g. std::pmr::vector<int> vector(&memoryResource).
+		// Allocations through the resource go through one virtual call on top of the allocator itself.
+		template <typename Allocator>
+		class MemoryResource : public std::pmr::memory_resource
+		{
+		private:
+			AllocatorInterface<Allocator>* allocator;
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override
+			{
+				// Visage allocators take the alignment as a std::uint8_t, larger ones would wrap around to a smaller one
+				if (alignment > 128)
+				{
+					throw std::bad_alloc();
+				}
+
+				void* alignedAddress = allocator->AllocateBytes(bytes, static_cast<std::uint8_t>(alignment));
+
+				if (alignedAddress == nullptr)
+				{
+					throw std::bad_alloc(); // Containers have no way to handle a null allocation
+				}
+
+				return alignedAddress;
+			}
+
+			void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+			{
+				allocator->DeallocateBytes(pointer);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				const MemoryResource* otherResource = dynamic_cast<const MemoryResource*>(&other);
+				return otherResource != nullptr && otherResource->allocator == allocator;
+			}
+
+		public:
+			MemoryResource() = delete;
+
+			MemoryResource(AllocatorInterface<Allocator>& allocator)
+				: allocator(&allocator)
+			{ }
+
+			inline AllocatorInterface<Allocator>* GetAllocator() const
+			{
+				return allocator;
+			}
+		};
+	}
+}
@@ -0,0 +1,291 @@
+#include "MemoryTracking.h"
+#include "MemoryUtils.h"
+
+#ifdef VISAGE_MEMORY_TRACKING
+	#include <algorithm>
+	#include <map>
+	#include <mutex>
+	#include <utility>
+#endif
+
+namespace Visage
+{
+	namespace Core
+	{
+		#ifdef VISAGE_MEMORY_TRACKING
+			static std::mutex& GetRegistryMutex()
+			{
+				static std::mutex registryMutex;
+				return registryMutex;
+			}
+
+			static AllocationStats*& GetRegistryHead()
+			{
+				static AllocationStats* registryHead = nullptr;
+				return registryHead;
+			}
+
+			static thread_local AllocationCallsite currentCallsite = { nullptr, 0 };
+
+			static void WriteJsonString(std::ostream& stream, const char* string)
+			{
+				stream << '"';
+
+				for (; string != nullptr && *string != '\0'; string++)
+				{
+					if (*string == '"' || *string == '\\')
+					{
+						stream << '\\';
+					}
+
+					stream << *string;
+				}
+
+				stream << '"';
+			}
+
+			static void WriteCsvString(std::ostream& stream, const char* string)
+			{
+				stream << '"';
+
+				for (; string != nullptr && *string != '\0'; string++)
+				{
+					if (*string == '"')
+					{
+						stream << '"';
+					}
+
+					stream << *string;
+				}
+
+				stream << '"';
+			}
+
+			AllocationStats::AllocationStats(const std::size_t* capacity)
+				: previousStats(nullptr), nextStats(nullptr), name("Unnamed"), capacity(capacity), allocator(nullptr), getFragmentation(nullptr),
+				  backing(BufferBacking::Heap), numaNode(-1),
+				  memoryUsed(0), peakMemoryUsed(0), highWaterMark(0), numberOfAllocations(0), peakNumberOfAllocations(0),
+				  totalNumberOfAllocations(0), sizeHistogram{}
+			{
+				std::lock_guard<std::mutex> lock(GetRegistryMutex());
+				AllocationStats*& registryHead = GetRegistryHead();
+
+				nextStats = registryHead;
+				if (registryHead != nullptr)
+				{
+					registryHead->previousStats = this;
+				}
+				registryHead = this;
+			}
+
+			AllocationStats::~AllocationStats()
+			{
+				std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+				if (previousStats != nullptr)
+				{
+					previousStats->nextStats = nextStats;
+				}
+				else
+				{
+					GetRegistryHead() = nextStats;
+				}
+
+				if (nextStats != nullptr)
+				{
+					nextStats->previousStats = previousStats;
+				}
+			}
+
+			void AllocationStats::RecordAllocation(const void* address, std::size_t size, std::size_t requestedSize, std::size_t endOffset)
+			{
+				memoryUsed += size;
+				numberOfAllocations++;
+				totalNumberOfAllocations++;
+
+				if (memoryUsed > peakMemoryUsed)
+				{
+					peakMemoryUsed = memoryUsed;
+				}
+
+				if (numberOfAllocations > peakNumberOfAllocations)
+				{
+					peakNumberOfAllocations = numberOfAllocations;
+				}
+
+				if (endOffset > highWaterMark)
+				{
+					highWaterMark = endOffset;
+				}
+
+				std::size_t histogramBucket = (requestedSize > 0) ? FindLastSetBit(requestedSize) : 0;
+				sizeHistogram[(histogramBucket < numberOfHistogramBuckets) ? histogramBucket : numberOfHistogramBuckets - 1]++;
+
+				liveAllocations[address] = { size, currentCallsite };
+			}
+
+			void AllocationStats::RecordDeallocation(const void* address, std::size_t size)
+			{
+				memoryUsed -= size;
+				numberOfAllocations--;
+				liveAllocations.erase(address);
+			}
+
+			void AllocationStats::RecordReset()
+			{
+				memoryUsed = 0;
+				numberOfAllocations = 0;
+				liveAllocations.clear();
+			}
+
+			void AllocationStats::RecordMove(const void* oldAddress, const void* newAddress, std::size_t oldSize, std::size_t newSize)
+			{
+				memoryUsed = memoryUsed - oldSize + newSize;
+				peakMemoryUsed = std::max(peakMemoryUsed, memoryUsed);
+
+				auto liveAllocation = liveAllocations.find(oldAddress);
+				if (liveAllocation != liveAllocations.end())
+				{
+					LiveAllocation movedAllocation = { newSize, liveAllocation->second.callsite };
+					liveAllocations.erase(liveAllocation);
+					liveAllocations[newAddress] = movedAllocation;
+				}
+			}
+
+			void AllocationStats::RecordUsage(std::size_t bulkMemoryUsed, std::size_t bulkNumberOfAllocations)
+			{
+				memoryUsed = bulkMemoryUsed;
+				numberOfAllocations = bulkNumberOfAllocations;
+				totalNumberOfAllocations += bulkNumberOfAllocations;
+
+				peakMemoryUsed = std::max(peakMemoryUsed, memoryUsed);
+				peakNumberOfAllocations = std::max(peakNumberOfAllocations, numberOfAllocations);
+				highWaterMark = std::max(highWaterMark, memoryUsed);
+			}
+
+			void AllocationStats::RecordRewind(const void* begin, const void* end, std::size_t previousMemoryUsed, std::size_t previousNumberOfAllocations)
+			{
+				memoryUsed = previousMemoryUsed;
+				numberOfAllocations = previousNumberOfAllocations;
+
+				for (auto liveAllocation = liveAllocations.begin(); liveAllocation != liveAllocations.end();)
+				{
+					std::uintptr_t address = reinterpret_cast<std::uintptr_t>(liveAllocation->first);
+
+					if (address >= reinterpret_cast<std::uintptr_t>(begin) && address < reinterpret_cast<std::uintptr_t>(end))
+					{
+						liveAllocation = liveAllocations.erase(liveAllocation);
+					}
+					else
+					{
+						++liveAllocation;
+					}
+				}
+			}
+
+			AllocationCallsiteScope::AllocationCallsiteScope(const char* file, int line)
+				: previousCallsite(currentCallsite)
+			{
+				currentCallsite = { file, line };
+			}
+
+			AllocationCallsiteScope::~AllocationCallsiteScope()
+			{
+				currentCallsite = previousCallsite;
+			}
+		#endif
+
+		void MemoryTracker::WriteJson(std::ostream& stream, std::size_t frameIndex)
+		{
+			stream << "{\"frame\":" << frameIndex << ",\"tags\":[";
+
+			#ifdef VISAGE_MEMORY_TRACKING
+				std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+				for (AllocationStats* stats = GetRegistryHead(); stats != nullptr; stats = stats->nextStats)
+				{
+					stream << "{\"name\":";
+					WriteJsonString(stream, stats->name);
+					stream << ",\"backing\":\"" << GetBufferBackingName(stats->backing) << "\""
+						<< ",\"numaNode\":" << stats->numaNode
+						<< ",\"capacity\":" << *stats->capacity
+						<< ",\"memoryUsed\":" << stats->memoryUsed
+						<< ",\"peakMemoryUsed\":" << stats->peakMemoryUsed
+						<< ",\"highWaterMark\":" << stats->highWaterMark
+						<< ",\"numberOfAllocations\":" << stats->numberOfAllocations
+						<< ",\"peakNumberOfAllocations\":" << stats->peakNumberOfAllocations
+						<< ",\"totalNumberOfAllocations\":" << stats->totalNumberOfAllocations;
+
+					if (stats->getFragmentation != nullptr)
+					{
+						stream << ",\"fragmentation\":" << stats->getFragmentation(stats->allocator);
+					}
+
+					stream << ",\"sizeHistogram\":[";
+					for (std::size_t i = 0; i < AllocationStats::numberOfHistogramBuckets; i++)
+					{
+						stream << ((i > 0) ? "," : "") << stats->sizeHistogram[i];
+					}
+
+					// Live allocations grouped by the place they were made, unattributed ones end up under a null file
+					std::map<std::pair<const char*, int>, std::pair<std::size_t, std::size_t>> callsites;
+					for (const auto& liveAllocation : stats->liveAllocations)
+					{
+						std::pair<std::size_t, std::size_t>& callsite = callsites[{ liveAllocation.second.callsite.file, liveAllocation.second.callsite.line }];
+						callsite.first++;
+						callsite.second += liveAllocation.second.size;
+					}
+
+					stream << "],\"callsites\":[";
+					for (auto callsite = callsites.begin(); callsite != callsites.end(); ++callsite)
+					{
+						stream << ((callsite != callsites.begin()) ? ",{\"file\":" : "{\"file\":");
+						if (callsite->first.first != nullptr)
+						{
+							WriteJsonString(stream, callsite->first.first);
+						}
+						else
+						{
+							stream << "null";
+						}
+						stream << ",\"line\":" << callsite->first.second
+							<< ",\"numberOfAllocations\":" << callsite->second.first
+							<< ",\"memoryUsed\":" << callsite->second.second << "}";
+					}
+
+					stream << "]}" << ((stats->nextStats != nullptr) ? "," : "");
+				}
+			#endif
+
+			stream << "]}\n";
+		}
+
+		void MemoryTracker::WriteCsvHeader(std::ostream& stream)
+		{
+			stream << "frame,name,backing,numaNode,capacity,memoryUsed,peakMemoryUsed,highWaterMark,numberOfAllocations,peakNumberOfAllocations,totalNumberOfAllocations,fragmentation\n";
+		}
+
+		void MemoryTracker::WriteCsv(std::ostream& stream, std::size_t frameIndex)
+		{
+			#ifdef VISAGE_MEMORY_TRACKING
+				std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+				for (AllocationStats* stats = GetRegistryHead(); stats != nullptr; stats = stats->nextStats)
+				{
+					stream << frameIndex << ',';
+					WriteCsvString(stream, stats->name);
+					stream << ',' << GetBufferBackingName(stats->backing) << ',' << stats->numaNode << ',' << *stats->capacity << ',' << stats->memoryUsed << ','
+						<< stats->peakMemoryUsed << ',' << stats->highWaterMark << ',' << stats->numberOfAllocations << ','
+						<< stats->peakNumberOfAllocations << ',' << stats->totalNumberOfAllocations << ',';
+
+					if (stats->getFragmentation != nullptr)
+					{
+						stream << stats->getFragmentation(stats->allocator);
+					}
+
+					stream << '\n';
+				}
+			#endif
+		}
+	}
+}
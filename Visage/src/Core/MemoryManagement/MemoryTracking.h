@@ -0,0 +1,169 @@
+#pragma once
+
+#include "VirtualMemory.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Tracking is on in debug builds and can be forced on for profiling builds, in release none of it is compiled
+#if defined(DEBUG) && !defined(VISAGE_MEMORY_TRACKING)
+	#define VISAGE_MEMORY_TRACKING
+#endif
+
+#ifdef VISAGE_MEMORY_TRACKING
+	#include <unordered_map>
+
+	// Attributes the allocations made by the expression to this file and line, e.g. VISAGE_TRACK_CALLSITE(arena.New<Mesh>()).
+	// Allocations the expression triggers inside other allocators, like a pool growing, are attributed to it as well.
+	#define VISAGE_TRACK_CALLSITE(...) (::Visage::Core::AllocationCallsiteScope(__FILE__, __LINE__), (__VA_ARGS__))
+#else
+	#define VISAGE_TRACK_CALLSITE(...) (__VA_ARGS__)
+#endif
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Writes the statistics of every live allocator, one record per allocator tag. Meant to be called once per
+		// frame from the main thread, allocators used by other threads should be quiet while their stats are read.
+		class MemoryTracker
+		{
+		public:
+			static void WriteJson(std::ostream& stream, std::size_t frameIndex);
+
+			static void WriteCsvHeader(std::ostream& stream);
+
+			static void WriteCsv(std::ostream& stream, std::size_t frameIndex);
+		};
+
+		#ifdef VISAGE_MEMORY_TRACKING
+			struct AllocationCallsite {
+				const char* file;
+				int line;
+			};
+
+			// Sets the callsite recorded for allocations made by this thread until the scope ends
+			class AllocationCallsiteScope
+			{
+			private:
+				AllocationCallsite previousCallsite;
+
+			public:
+				AllocationCallsiteScope(const char* file, int line);
+
+				AllocationCallsiteScope(const AllocationCallsiteScope& scope) = delete;
+				AllocationCallsiteScope& operator=(const AllocationCallsiteScope& scope) = delete;
+
+				~AllocationCallsiteScope();
+			};
+
+			// Per allocator statistics, registered with the MemoryTracker for as long as the allocator lives
+			class AllocationStats
+			{
+				friend class MemoryTracker;
+
+			public:
+				// Bucket i counts requests of [2^i, 2^(i+1)) bytes, the last bucket also counts everything larger
+				static const std::size_t numberOfHistogramBuckets = 32;
+
+			private:
+				struct LiveAllocation {
+					std::size_t size;
+					AllocationCallsite callsite;
+				};
+
+				AllocationStats* previousStats;
+				AllocationStats* nextStats;
+
+				const char* name;
+				const std::size_t* capacity;
+				void* allocator;
+				float (*getFragmentation)(void* allocator);
+				BufferBacking backing;
+				int numaNode;
+
+				std::size_t memoryUsed;
+				std::size_t peakMemoryUsed;
+				std::size_t highWaterMark;
+				std::size_t numberOfAllocations;
+				std::size_t peakNumberOfAllocations;
+				std::size_t totalNumberOfAllocations;
+				std::size_t sizeHistogram[numberOfHistogramBuckets];
+
+				std::unordered_map<const void*, LiveAllocation> liveAllocations;
+
+			public:
+				AllocationStats(const std::size_t* capacity);
+
+				AllocationStats(const AllocationStats& stats) = delete;
+				AllocationStats& operator=(const AllocationStats& stats) = delete;
+
+				~AllocationStats();
+
+				inline void SetName(const char* newName)
+				{
+					name = newName;
+				}
+
+				inline const char* GetName() const
+				{
+					return name;
+				}
+
+				inline void SetBacking(BufferBacking newBacking, int newNumaNode)
+				{
+					backing = newBacking;
+					numaNode = newNumaNode;
+				}
+
+				// Lets the tracker report how fragmented the allocator's free memory is
+				inline void SetFragmentationSource(void* owner, float (*fragmentationFunction)(void* allocator))
+				{
+					allocator = owner;
+					getFragmentation = fragmentationFunction;
+				}
+
+				// size is what the allocator charged, requestedSize what the caller asked for and endOffset
+				// how far into the allocator's buffer the allocation reaches
+				void RecordAllocation(const void* address, std::size_t size, std::size_t requestedSize, std::size_t endOffset);
+
+				void RecordDeallocation(const void* address, std::size_t size);
+
+				void RecordReset();
+
+				void RecordMove(const void* oldAddress, const void* newAddress, std::size_t oldSize, std::size_t newSize);
+
+				// For allocators that cannot afford per allocation records, reports usage in bulk (e.g. once per frame)
+				void RecordUsage(std::size_t bulkMemoryUsed, std::size_t bulkNumberOfAllocations);
+
+				// For allocators that release every allocation in [begin, end) at once
+				void RecordRewind(const void* begin, const void* end, std::size_t previousMemoryUsed, std::size_t previousNumberOfAllocations);
+
+				inline std::size_t GetPeakMemoryUsed() const
+				{
+					return peakMemoryUsed;
+				}
+
+				inline std::size_t GetHighWaterMark() const
+				{
+					return highWaterMark;
+				}
+
+				inline std::size_t GetPeakNumberOfAllocations() const
+				{
+					return peakNumberOfAllocations;
+				}
+
+				inline std::size_t GetTotalNumberOfAllocations() const
+				{
+					return totalNumberOfAllocations;
+				}
+
+				inline const std::size_t* GetSizeHistogram() const
+				{
+					return sizeHistogram;
+				}
+			};
+		#endif
+	}
+}
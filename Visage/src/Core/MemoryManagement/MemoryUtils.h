@@ -4,6 +4,10 @@
 #include <cstddef>
 #include <cassert>
 
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
 namespace Visage
 {
 	namespace Core
@@ -63,5 +67,31 @@ namespace Visage
 		{
 			return reinterpret_cast<std::uintptr_t>(firstPointer) - reinterpret_cast<std::uintptr_t>(secondPointer);
 		}
+
+		inline std::uint32_t FindFirstSetBit(const std::uint32_t value)
+		{
+			assert(value != 0);
+
+			#ifdef _MSC_VER
+				unsigned long index;
+				_BitScanForward(&index, value);
+				return static_cast<std::uint32_t>(index);
+			#else
+				return static_cast<std::uint32_t>(__builtin_ctz(value));
+			#endif
+		}
+
+		inline std::uint32_t FindLastSetBit(const std::uint64_t value)
+		{
+			assert(value != 0);
+
+			#ifdef _MSC_VER
+				unsigned long index;
+				_BitScanReverse64(&index, value);
+				return static_cast<std::uint32_t>(index);
+			#else
+				return static_cast<std::uint32_t>(63 - __builtin_clzll(value));
+			#endif
+		}
 	}
 }
\ No newline at end of file
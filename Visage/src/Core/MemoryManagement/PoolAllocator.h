@@ -3,48 +3,118 @@
 #include "AbstractAllocator.h"
 #include <cstddef>
 #include <cstdint>
+#include <new>
 
 namespace Visage
 {
 	namespace Core
 	{
+		struct PoolGrowthPolicy
+		{
+			// Number of blocks to add each time every chunk is in use
+			std::size_t blocksPerGrowth = 1;
+
+			// Upper bound on the number of blocks, 0 means the pool may grow without limit
+			std::size_t maximumNumberOfBlocks = 0;
+
+			// Number of blocks ReleaseEmptyBlocks keeps around even when they are empty
+			std::size_t numberOfBlocksToRetain = 1;
+		};
+
 		template <typename T>
-		class PoolAllocator : public AbstractAllocator
+		class PoolAllocator : public AbstractAllocator<PoolAllocator<T>>
 		{
+			friend class AllocatorInterface<PoolAllocator<T>>;
+
 		private:
 			struct ChunkNode {
 				ChunkNode* nextFreeChunk;
 			};
 
+			// Blocks are aligned to their own power of two size so the owning block of a chunk is found by masking its address
+			struct BlockHeader {
+				BlockHeader* nextBlock;
+				std::size_t numberOfFreeChunks;
+			};
+
+			PoolGrowthPolicy growthPolicy;
+			std::size_t blockSize;
+			std::size_t firstChunkOffset;
 			std::size_t chunksPerBlock;
+			std::size_t numberOfBlocks;
+			BlockHeader* blockList;
 			ChunkNode* freeChunkNodeList;
 
+			inline BlockHeader* GetBlock(const void* pointer)
+			{
+				return reinterpret_cast<BlockHeader*>(reinterpret_cast<std::uintptr_t>(pointer) & ~(blockSize - 1));
+			}
+
+			bool Grow();
+
+			void AllocateBlock();
+
 		protected:
-			void* Allocate(std::size_t size, std::uint8_t align) override;
+			void* Allocate(std::size_t size, std::uint8_t align);
 
-			void Deallocate(void*& pointer) override;
+			void Deallocate(void* pointer);
 
 		public:
 			PoolAllocator() = delete;
 
-			PoolAllocator(std::size_t objectsPerBlock);
+			PoolAllocator(std::size_t objectsPerBlock, const PoolGrowthPolicy& growthPolicy = PoolGrowthPolicy());
+
+			PoolAllocator(const PoolAllocator& allocator) = delete;
+			PoolAllocator& operator=(const PoolAllocator& allocator) = delete;
+
+			~PoolAllocator();
 
+			// Returns blocks whose chunks are all free to the OS, in O(free chunks + blocks)
+			void ReleaseEmptyBlocks();
+
+			inline std::size_t GetNumberOfBlocks()
+			{
+				return numberOfBlocks;
+			}
+
+			inline std::size_t GetChunksPerBlock()
+			{
+				return chunksPerBlock;
+			}
+
+			// The typed calls skip AllocatorInterface, so they record the trace events themselves
 			T* New()
 			{
-				return new (Allocate(sizeof(T), alignof(T))) T;
+				void* chunk = Allocate(sizeof(T), alignof(T));
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::RecordAllocation(this, chunk, sizeof(T), alignof(T));
+				#endif
+
+				return (chunk != nullptr) ? new (chunk) T : nullptr;
 			}
 
 			template <typename... Args>
 			T* NewWithArgs(Args&&... args)
 			{
-				return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+				void* chunk = Allocate(sizeof(T), alignof(T));
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::RecordAllocation(this, chunk, sizeof(T), alignof(T));
+				#endif
+
+				return (chunk != nullptr) ? new (chunk) T(std::forward<Args>(args)...) : nullptr;
 			}
 
-			template <typename... Args>
 			void Delete(T* objectToDelete)
 			{
 				objectToDelete->~T();
-				Deallocate(reinterpret_cast<void*&>(objectToDelete));
+
+				#ifdef VISAGE_ALLOCATION_TRACING
+					AllocationTrace::RecordDeallocation(this, objectToDelete);
+				#endif
+
+				Deallocate(objectToDelete);
 			}
 		};
 	}
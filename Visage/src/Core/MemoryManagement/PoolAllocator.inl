@@ -1,60 +1,190 @@
 #pragma once
 
 #include "PoolAllocator.h"
+#include "MemoryChecking.h"
 #include "MemoryUtils.h"
+#include <cstring>
 
 namespace Visage
 {
 	namespace Core
 	{
 		template <typename T>
-		PoolAllocator<T>::PoolAllocator(std::size_t objectsPerBlock)
-			: chunksPerBlock(objectsPerBlock)
-		{ 
+		PoolAllocator<T>::PoolAllocator(std::size_t objectsPerBlock, const PoolGrowthPolicy& growthPolicy)
+			: growthPolicy(growthPolicy), numberOfBlocks(0), blockList(nullptr), freeChunkNodeList(nullptr)
+		{
 			assert(sizeof(T) >= sizeof(ChunkNode));
+			assert(objectsPerBlock > 0 && growthPolicy.blocksPerGrowth > 0);
+
+			firstChunkOffset = AlignAddress(sizeof(BlockHeader), alignof(T));
+
+			blockSize = 1;
+			while (blockSize < firstChunkOffset + objectsPerBlock * sizeof(T))
+			{
+				blockSize <<= 1;
+			}
+
+			// Rounding the block up to a power of two usually leaves room for a few more chunks
+			chunksPerBlock = (blockSize - firstChunkOffset) / sizeof(T);
+
+			AllocateBlock();
+		}
+
+		template <typename T>
+		PoolAllocator<T>::~PoolAllocator()
+		{
+			while (blockList != nullptr)
+			{
+				BlockHeader* nextBlock = blockList->nextBlock;
+				operator delete(blockList, std::align_val_t(blockSize));
+				blockList = nextBlock;
+			}
+		}
+
+		template <typename T>
+		void PoolAllocator<T>::ReleaseEmptyBlocks()
+		{
+			const std::size_t blockReleaseMarker = ~static_cast<std::size_t>(0);
+
+			if (numberOfBlocks <= growthPolicy.numberOfBlocksToRetain)
+			{
+				return;
+			}
+
+			for (BlockHeader* block = blockList; block != nullptr; block = block->nextBlock)
+			{
+				block->numberOfFreeChunks = 0;
+			}
 
-			sizeOfBuffer = (objectsPerBlock * sizeof(T)) + alignof(T);
-			startOfBuffer = new std::uint8_t[sizeOfBuffer];
-			
-			std::uint8_t adjustment = AlignedPointerAdjustment(startOfBuffer, alignof(T));
-			freeChunkNodeList = reinterpret_cast<ChunkNode*>(AddToPointer(startOfBuffer, adjustment));
-			
-			ChunkNode* currentChunkNode = freeChunkNodeList;
-			for (int i = 1; i < objectsPerBlock; i++)
+			for (ChunkNode* chunk = freeChunkNodeList; chunk != nullptr; chunk = chunk->nextFreeChunk)
+			{
+				GetBlock(chunk)->numberOfFreeChunks++;
+			}
+
+			std::size_t numberOfBlocksToRelease = 0;
+			for (BlockHeader* block = blockList; block != nullptr && numberOfBlocks - numberOfBlocksToRelease > growthPolicy.numberOfBlocksToRetain; block = block->nextBlock)
+			{
+				if (block->numberOfFreeChunks == chunksPerBlock)
+				{
+					block->numberOfFreeChunks = blockReleaseMarker;
+					numberOfBlocksToRelease++;
+				}
+			}
+
+			if (numberOfBlocksToRelease == 0)
+			{
+				return;
+			}
+
+			// Unlink the chunks of released blocks before their memory goes away
+			ChunkNode** nextChunkLink = &freeChunkNodeList;
+			while (*nextChunkLink != nullptr)
+			{
+				if (GetBlock(*nextChunkLink)->numberOfFreeChunks == blockReleaseMarker)
+				{
+					*nextChunkLink = (*nextChunkLink)->nextFreeChunk;
+				}
+				else
+				{
+					nextChunkLink = &(*nextChunkLink)->nextFreeChunk;
+				}
+			}
+
+			BlockHeader** nextBlockLink = &blockList;
+			while (*nextBlockLink != nullptr)
+			{
+				BlockHeader* block = *nextBlockLink;
+
+				if (block->numberOfFreeChunks == blockReleaseMarker)
+				{
+					*nextBlockLink = block->nextBlock;
+					operator delete(block, std::align_val_t(blockSize));
+					numberOfBlocks--;
+					this->sizeOfBuffer -= blockSize;
+				}
+				else
+				{
+					nextBlockLink = &block->nextBlock;
+				}
+			}
+		}
+
+		template <typename T>
+		bool PoolAllocator<T>::Grow()
+		{
+			for (std::size_t i = 0; i < growthPolicy.blocksPerGrowth; i++)
+			{
+				if (growthPolicy.maximumNumberOfBlocks != 0 && numberOfBlocks >= growthPolicy.maximumNumberOfBlocks)
+				{
+					break;
+				}
+
+				AllocateBlock();
+			}
+
+			return freeChunkNodeList != nullptr;
+		}
+
+		template <typename T>
+		void PoolAllocator<T>::AllocateBlock()
+		{
+			BlockHeader* block = reinterpret_cast<BlockHeader*>(operator new(blockSize, std::align_val_t(blockSize)));
+			block->nextBlock = blockList;
+			blockList = block;
+
+			ChunkNode* firstChunkNode = reinterpret_cast<ChunkNode*>(AddToPointer(block, firstChunkOffset));
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				std::memset(firstChunkNode, MemoryChecker::freedFill, chunksPerBlock * sizeof(T));
+			#endif
+
+			ChunkNode* currentChunkNode = firstChunkNode;
+			for (std::size_t i = 1; i < chunksPerBlock; i++)
 			{
 				ChunkNode* nextChunk = reinterpret_cast<ChunkNode*>(AddToPointer(currentChunkNode, sizeof(T)));
 				currentChunkNode->nextFreeChunk = nextChunk;
 				currentChunkNode = nextChunk;
 			}
-			currentChunkNode->nextFreeChunk = nullptr;
+			currentChunkNode->nextFreeChunk = freeChunkNodeList;
+			freeChunkNodeList = firstChunkNode;
+
+			numberOfBlocks++;
+			this->sizeOfBuffer += blockSize;
 		}
 
 		template <typename T>
-		void* PoolAllocator<T>::Allocate(std::size_t size, std::uint8_t align)
+		inline void* PoolAllocator<T>::Allocate(std::size_t size, std::uint8_t align)
 		{
 			assert(size == sizeof(T) && align == alignof(T));
 
 			void* alignedAddress = nullptr;
-			
-			if (freeChunkNodeList != nullptr)
+
+			if (freeChunkNodeList != nullptr || Grow())
 			{
 				alignedAddress = freeChunkNodeList;
 				freeChunkNodeList = freeChunkNodeList->nextFreeChunk;
-				memoryUsed += sizeof(T);
-				numberOfAllocations++;
+
+				#ifdef VISAGE_MEMORY_CHECKING
+					MemoryChecker::CheckPoisonedChunk(alignedAddress, sizeof(T), sizeof(ChunkNode));
+				#endif
+
+				this->RecordAllocation(alignedAddress, sizeof(T), sizeof(T));
 			}
 
 			return alignedAddress;
 		}
-		
+
 		template <typename T>
-		void PoolAllocator<T>::Deallocate(void*& pointer)
+		inline void PoolAllocator<T>::Deallocate(void* pointer)
 		{
+			#ifdef VISAGE_MEMORY_CHECKING
+				MemoryChecker::PoisonChunk(pointer, sizeof(T), sizeof(ChunkNode));
+			#endif
+
 			ChunkNode* newChunkNode = reinterpret_cast<ChunkNode*>(pointer);
 			newChunkNode->nextFreeChunk = freeChunkNodeList;
 			freeChunkNodeList = newChunkNode;
-			memoryUsed -= sizeof(T);
-			numberOfAllocations--;
+			this->RecordDeallocation(pointer, sizeof(T));
 		}
 	}
-}
\ No newline at end of file
+}
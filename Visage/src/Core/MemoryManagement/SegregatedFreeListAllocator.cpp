@@ -0,0 +1,290 @@
+#include "SegregatedFreeListAllocator.h"
+#include "MemoryUtils.h"
+
+namespace Visage
+{
+	namespace Core
+	{
+		SegregatedFreeListAllocator::SegregatedFreeListAllocator(std::size_t size)
+			: AbstractAllocator(size), firstLevelBitmap(0), secondLevelBitmaps{}, freeBlocks{}
+		{
+			std::uint8_t adjustment = AlignedPointerAdjustment(startOfBuffer, alignmentSize);
+			assert(size >= adjustment + blockHeaderOverhead * 2 + minimumBlockSize);
+
+			// The first block spans the whole buffer, followed by a zero sized used block that stops coalescing past the end
+			std::size_t firstBlockSize = (size - adjustment - blockHeaderOverhead * 2) & ~(alignmentSize - 1);
+			assert(firstBlockSize < maximumBlockSize);
+
+			BlockHeader* firstBlock = reinterpret_cast<BlockHeader*>(AddToPointer(startOfBuffer, adjustment));
+			firstBlock->previousPhysicalBlock = nullptr;
+			firstBlock->sizeAndFlags = firstBlockSize;
+
+			BlockHeader* sentinelBlock = GetNextPhysicalBlock(firstBlock);
+			sentinelBlock->previousPhysicalBlock = firstBlock;
+			sentinelBlock->sizeAndFlags = 0;
+
+			MarkBlockFree(firstBlock);
+			InsertFreeBlock(firstBlock);
+		}
+
+		void* SegregatedFreeListAllocator::GetBlockData(const BlockHeader* block)
+		{
+			return AddToPointer(block, blockHeaderOverhead);
+		}
+
+		SegregatedFreeListAllocator::BlockHeader* SegregatedFreeListAllocator::GetBlockFromData(const void* pointer)
+		{
+			return reinterpret_cast<BlockHeader*>(SubtractFromPointer(pointer, blockHeaderOverhead));
+		}
+
+		SegregatedFreeListAllocator::BlockHeader* SegregatedFreeListAllocator::GetNextPhysicalBlock(const BlockHeader* block)
+		{
+			return reinterpret_cast<BlockHeader*>(AddToPointer(GetBlockData(block), GetBlockSize(block)));
+		}
+
+		void SegregatedFreeListAllocator::MapSizeToIndices(std::size_t size, std::size_t& firstLevelIndex, std::size_t& secondLevelIndex)
+		{
+			if (size < smallBlockSize)
+			{
+				// Small blocks are split linearly across the second level of the first bin
+				firstLevelIndex = 0;
+				secondLevelIndex = size / (smallBlockSize / secondLevelIndexCount);
+			}
+			else
+			{
+				std::size_t mostSignificantBit = FindLastSetBit(size);
+				secondLevelIndex = (size >> (mostSignificantBit - secondLevelIndexCountLog2)) ^ secondLevelIndexCount;
+				firstLevelIndex = mostSignificantBit - (firstLevelIndexShift - 1);
+			}
+		}
+
+		void SegregatedFreeListAllocator::MapSizeToSearchIndices(std::size_t size, std::size_t& firstLevelIndex, std::size_t& secondLevelIndex)
+		{
+			// Round up to the next size class so that any block found in it is guaranteed to fit
+			if (size >= smallBlockSize)
+			{
+				size += (static_cast<std::size_t>(1) << (FindLastSetBit(size) - secondLevelIndexCountLog2)) - 1;
+			}
+
+			MapSizeToIndices(size, firstLevelIndex, secondLevelIndex);
+		}
+
+		SegregatedFreeListAllocator::BlockHeader* SegregatedFreeListAllocator::FindSuitableBlock(std::size_t& firstLevelIndex, std::size_t& secondLevelIndex)
+		{
+			if (firstLevelIndex >= firstLevelIndexCount)
+			{
+				return nullptr;
+			}
+
+			std::uint32_t secondLevelMap = secondLevelBitmaps[firstLevelIndex] & (~0U << secondLevelIndex);
+
+			if (secondLevelMap == 0)
+			{
+				if (firstLevelIndex + 1 >= firstLevelIndexCount)
+				{
+					return nullptr;
+				}
+
+				std::uint32_t firstLevelMap = firstLevelBitmap & (~0U << (firstLevelIndex + 1));
+
+				if (firstLevelMap == 0)
+				{
+					return nullptr; // Out of memory
+				}
+
+				firstLevelIndex = FindFirstSetBit(firstLevelMap);
+				secondLevelMap = secondLevelBitmaps[firstLevelIndex];
+			}
+
+			secondLevelIndex = FindFirstSetBit(secondLevelMap);
+
+			return freeBlocks[firstLevelIndex][secondLevelIndex];
+		}
+
+		void SegregatedFreeListAllocator::InsertFreeBlock(BlockHeader* block)
+		{
+			std::size_t firstLevelIndex, secondLevelIndex;
+			MapSizeToIndices(GetBlockSize(block), firstLevelIndex, secondLevelIndex);
+
+			BlockHeader* currentHead = freeBlocks[firstLevelIndex][secondLevelIndex];
+			block->nextFreeBlock = currentHead;
+			block->previousFreeBlock = nullptr;
+
+			if (currentHead != nullptr)
+			{
+				currentHead->previousFreeBlock = block;
+			}
+
+			freeBlocks[firstLevelIndex][secondLevelIndex] = block;
+			firstLevelBitmap |= 1U << firstLevelIndex;
+			secondLevelBitmaps[firstLevelIndex] |= 1U << secondLevelIndex;
+		}
+
+		void SegregatedFreeListAllocator::RemoveFreeBlock(BlockHeader* block)
+		{
+			std::size_t firstLevelIndex, secondLevelIndex;
+			MapSizeToIndices(GetBlockSize(block), firstLevelIndex, secondLevelIndex);
+			RemoveFreeBlock(block, firstLevelIndex, secondLevelIndex);
+		}
+
+		void SegregatedFreeListAllocator::RemoveFreeBlock(BlockHeader* block, std::size_t firstLevelIndex, std::size_t secondLevelIndex)
+		{
+			BlockHeader* previousFreeBlock = block->previousFreeBlock;
+			BlockHeader* nextFreeBlock = block->nextFreeBlock;
+
+			if (nextFreeBlock != nullptr)
+			{
+				nextFreeBlock->previousFreeBlock = previousFreeBlock;
+			}
+
+			if (previousFreeBlock != nullptr)
+			{
+				previousFreeBlock->nextFreeBlock = nextFreeBlock;
+			}
+			else
+			{
+				freeBlocks[firstLevelIndex][secondLevelIndex] = nextFreeBlock;
+
+				if (nextFreeBlock == nullptr)
+				{
+					secondLevelBitmaps[firstLevelIndex] &= ~(1U << secondLevelIndex);
+
+					if (secondLevelBitmaps[firstLevelIndex] == 0)
+					{
+						firstLevelBitmap &= ~(1U << firstLevelIndex);
+					}
+				}
+			}
+		}
+
+		void SegregatedFreeListAllocator::MarkBlockFree(BlockHeader* block)
+		{
+			block->sizeAndFlags |= blockFreeBit;
+
+			BlockHeader* nextBlock = GetNextPhysicalBlock(block);
+			nextBlock->previousPhysicalBlock = block;
+			nextBlock->sizeAndFlags |= previousBlockFreeBit;
+		}
+
+		void SegregatedFreeListAllocator::MarkBlockUsed(BlockHeader* block)
+		{
+			block->sizeAndFlags &= ~blockFreeBit;
+			GetNextPhysicalBlock(block)->sizeAndFlags &= ~previousBlockFreeBit;
+		}
+
+		SegregatedFreeListAllocator::BlockHeader* SegregatedFreeListAllocator::SplitBlock(BlockHeader* block, std::size_t size)
+		{
+			BlockHeader* remainingBlock = reinterpret_cast<BlockHeader*>(AddToPointer(GetBlockData(block), size));
+			remainingBlock->previousPhysicalBlock = block;
+			remainingBlock->sizeAndFlags = GetBlockSize(block) - size - blockHeaderOverhead;
+			SetBlockSize(block, size);
+
+			MarkBlockFree(remainingBlock);
+
+			return remainingBlock;
+		}
+
+		SegregatedFreeListAllocator::BlockHeader* SegregatedFreeListAllocator::MergeWithPreviousBlock(BlockHeader* block)
+		{
+			if (IsPreviousBlockFree(block))
+			{
+				BlockHeader* previousBlock = block->previousPhysicalBlock;
+				RemoveFreeBlock(previousBlock);
+				SetBlockSize(previousBlock, GetBlockSize(previousBlock) + GetBlockSize(block) + blockHeaderOverhead);
+				GetNextPhysicalBlock(previousBlock)->previousPhysicalBlock = previousBlock;
+				block = previousBlock;
+			}
+
+			return block;
+		}
+
+		SegregatedFreeListAllocator::BlockHeader* SegregatedFreeListAllocator::MergeWithNextBlock(BlockHeader* block)
+		{
+			BlockHeader* nextBlock = GetNextPhysicalBlock(block);
+
+			if (IsBlockFree(nextBlock))
+			{
+				RemoveFreeBlock(nextBlock);
+				SetBlockSize(block, GetBlockSize(block) + GetBlockSize(nextBlock) + blockHeaderOverhead);
+				GetNextPhysicalBlock(block)->previousPhysicalBlock = block;
+			}
+
+			return block;
+		}
+
+		void* SegregatedFreeListAllocator::Allocate(std::size_t size, std::uint8_t align)
+		{
+			std::size_t adjustedSize = AlignAddress(size, alignmentSize);
+			if (adjustedSize < minimumBlockSize)
+			{
+				adjustedSize = minimumBlockSize;
+			}
+
+			// Over aligned requests need room to split off a free block in front of the aligned address
+			const std::size_t minimumGapSize = blockHeaderOverhead + minimumBlockSize;
+			std::size_t searchSize = (align > alignmentSize) ? adjustedSize + align + minimumGapSize : adjustedSize;
+
+			if (searchSize >= maximumBlockSize)
+			{
+				return nullptr;
+			}
+
+			std::size_t firstLevelIndex, secondLevelIndex;
+			MapSizeToSearchIndices(searchSize, firstLevelIndex, secondLevelIndex);
+
+			BlockHeader* block = FindSuitableBlock(firstLevelIndex, secondLevelIndex);
+
+			if (block == nullptr)
+			{
+				return nullptr; // assert out of memory error
+			}
+
+			RemoveFreeBlock(block, firstLevelIndex, secondLevelIndex);
+
+			if (align > alignmentSize)
+			{
+				void* blockData = GetBlockData(block);
+				void* alignedAddress = AlignPointer(blockData, align);
+
+				if (alignedAddress != blockData && PointerDiff(alignedAddress, blockData) < minimumGapSize)
+				{
+					alignedAddress = AlignPointer(AddToPointer(blockData, minimumGapSize), align);
+				}
+
+				if (alignedAddress != blockData)
+				{
+					std::size_t gapSize = PointerDiff(alignedAddress, blockData);
+					BlockHeader* alignedBlock = SplitBlock(block, gapSize - blockHeaderOverhead);
+					alignedBlock->sizeAndFlags |= previousBlockFreeBit;
+					InsertFreeBlock(block);
+					block = alignedBlock;
+				}
+			}
+
+			if (GetBlockSize(block) >= adjustedSize + minimumGapSize)
+			{
+				BlockHeader* remainingBlock = SplitBlock(block, adjustedSize);
+				InsertFreeBlock(remainingBlock);
+			}
+
+			MarkBlockUsed(block);
+
+			RecordAllocation(GetBlockData(block), GetBlockSize(block) + blockHeaderOverhead, size);
+
+			return GetBlockData(block);
+		}
+
+		void SegregatedFreeListAllocator::Deallocate(void* pointer)
+		{
+			BlockHeader* block = GetBlockFromData(pointer);
+			assert(!IsBlockFree(block)); // Double free
+
+			RecordDeallocation(pointer, GetBlockSize(block) + blockHeaderOverhead);
+
+			MarkBlockFree(block);
+			block = MergeWithPreviousBlock(block);
+			block = MergeWithNextBlock(block);
+			InsertFreeBlock(block);
+		}
+	}
+}
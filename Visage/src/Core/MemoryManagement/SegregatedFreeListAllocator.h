@@ -0,0 +1,119 @@
+#pragma once
+
+#include "AbstractAllocator.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Two-level segregated fit (TLSF) allocator. Free blocks are binned by size class and indexed by
+		// two levels of bitmaps, so finding a good fit and freeing a block are both O(1) regardless of how
+		// fragmented the heap is. Boundary tags let freed blocks coalesce with both neighbours immediately.
+		class SegregatedFreeListAllocator : public AbstractAllocator<SegregatedFreeListAllocator>
+		{
+			friend class AllocatorInterface<SegregatedFreeListAllocator>;
+			friend class ConcurrentFreeListAllocator;
+
+		private:
+			struct BlockHeader {
+				BlockHeader* previousPhysicalBlock;
+				std::size_t sizeAndFlags;
+
+				// Only valid while the block is free, overlaps the user data otherwise
+				BlockHeader* nextFreeBlock;
+				BlockHeader* previousFreeBlock;
+			};
+
+			static const std::size_t alignmentSizeLog2 = 4;
+			static const std::size_t alignmentSize = static_cast<std::size_t>(1) << alignmentSizeLog2;
+
+			static const std::size_t secondLevelIndexCountLog2 = 5;
+			static const std::size_t secondLevelIndexCount = static_cast<std::size_t>(1) << secondLevelIndexCountLog2;
+
+			static const std::size_t firstLevelIndexMax = 40;
+			static const std::size_t firstLevelIndexShift = secondLevelIndexCountLog2 + alignmentSizeLog2;
+			static const std::size_t firstLevelIndexCount = firstLevelIndexMax - firstLevelIndexShift + 1;
+
+			static const std::size_t smallBlockSize = static_cast<std::size_t>(1) << firstLevelIndexShift;
+
+			static const std::size_t blockHeaderOverhead = sizeof(BlockHeader*) + sizeof(std::size_t);
+			static const std::size_t minimumBlockSize = sizeof(BlockHeader) - blockHeaderOverhead;
+			static const std::size_t maximumBlockSize = static_cast<std::size_t>(1) << firstLevelIndexMax;
+
+			static const std::size_t blockFreeBit = 1;
+			static const std::size_t previousBlockFreeBit = 2;
+			static const std::size_t blockFlagsMask = blockFreeBit | previousBlockFreeBit;
+
+			std::uint32_t firstLevelBitmap;
+			std::uint32_t secondLevelBitmaps[firstLevelIndexCount];
+			BlockHeader* freeBlocks[firstLevelIndexCount][secondLevelIndexCount];
+
+			static inline std::size_t GetBlockSize(const BlockHeader* block)
+			{
+				return block->sizeAndFlags & ~blockFlagsMask;
+			}
+
+			static inline void SetBlockSize(BlockHeader* block, std::size_t size)
+			{
+				block->sizeAndFlags = size | (block->sizeAndFlags & blockFlagsMask);
+			}
+
+			static inline bool IsBlockFree(const BlockHeader* block)
+			{
+				return (block->sizeAndFlags & blockFreeBit) != 0;
+			}
+
+			static inline bool IsPreviousBlockFree(const BlockHeader* block)
+			{
+				return (block->sizeAndFlags & previousBlockFreeBit) != 0;
+			}
+
+			static void* GetBlockData(const BlockHeader* block);
+
+			static BlockHeader* GetBlockFromData(const void* pointer);
+
+			static BlockHeader* GetNextPhysicalBlock(const BlockHeader* block);
+
+			static void MapSizeToIndices(std::size_t size, std::size_t& firstLevelIndex, std::size_t& secondLevelIndex);
+
+			static void MapSizeToSearchIndices(std::size_t size, std::size_t& firstLevelIndex, std::size_t& secondLevelIndex);
+
+			BlockHeader* FindSuitableBlock(std::size_t& firstLevelIndex, std::size_t& secondLevelIndex);
+
+			void InsertFreeBlock(BlockHeader* block);
+
+			void RemoveFreeBlock(BlockHeader* block);
+
+			void RemoveFreeBlock(BlockHeader* block, std::size_t firstLevelIndex, std::size_t secondLevelIndex);
+
+			void MarkBlockFree(BlockHeader* block);
+
+			void MarkBlockUsed(BlockHeader* block);
+
+			BlockHeader* SplitBlock(BlockHeader* block, std::size_t size);
+
+			BlockHeader* MergeWithPreviousBlock(BlockHeader* block);
+
+			BlockHeader* MergeWithNextBlock(BlockHeader* block);
+
+		protected:
+			void* Allocate(std::size_t size, std::uint8_t align);
+
+			void Deallocate(void* pointer);
+
+		public:
+			SegregatedFreeListAllocator() = delete;
+
+			SegregatedFreeListAllocator(std::size_t size);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				~SegregatedFreeListAllocator()
+				{
+					FlushQuarantine();
+				}
+			#endif
+		};
+	}
+}
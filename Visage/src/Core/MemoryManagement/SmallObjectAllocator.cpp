@@ -0,0 +1,167 @@
+#include "SmallObjectAllocator.h"
+#include "MemoryUtils.h"
+
+namespace Visage
+{
+	namespace Core
+	{
+		SmallObjectAllocator::SmallObjectAllocator(std::size_t smallObjectMemory, std::size_t largeObjectMemory)
+			: AbstractAllocator(smallObjectMemory), numberOfInitializedPages(0), numberOfPagesInUse(0), freePageList(nullptr), availablePages(),
+			  largeObjectAllocator(largeObjectMemory)
+		{
+			// Pages are aligned to their size so a chunk finds its header by masking, the buffer itself is not
+			std::uintptr_t startAddress = reinterpret_cast<std::uintptr_t>(startOfBuffer);
+			std::uintptr_t firstPageAddress = (startAddress + pageSize - 1) & ~static_cast<std::uintptr_t>(pageSize - 1);
+
+			firstPage = reinterpret_cast<std::uint8_t*>(firstPageAddress);
+			numberOfPages = (firstPageAddress - startAddress < sizeOfBuffer) ? (sizeOfBuffer - (firstPageAddress - startAddress)) / pageSize : 0;
+
+			assert(numberOfPages > 0);
+		}
+
+		SmallObjectAllocator::PageHeader* SmallObjectAllocator::AcquirePage(std::size_t sizeClass)
+		{
+			PageHeader* page = freePageList;
+
+			if (page != nullptr)
+			{
+				freePageList = page->nextPage;
+			}
+			else if (numberOfInitializedPages < numberOfPages)
+			{
+				page = reinterpret_cast<PageHeader*>(firstPage + numberOfInitializedPages * pageSize);
+				numberOfInitializedPages++;
+			}
+			else
+			{
+				return nullptr;
+			}
+
+			page->freeChunkNodeList = nullptr;
+			page->firstUnusedChunk = reinterpret_cast<std::uint8_t*>(page) + firstChunkOffset;
+			page->sizeClass = static_cast<std::uint32_t>(sizeClass);
+			page->numberOfUsedChunks = 0;
+
+			LinkPage(page);
+			numberOfPagesInUse++;
+
+			return page;
+		}
+
+		void SmallObjectAllocator::ReleasePage(PageHeader* page)
+		{
+			UnlinkPage(page);
+
+			page->nextPage = freePageList;
+			freePageList = page;
+			numberOfPagesInUse--;
+		}
+
+		void SmallObjectAllocator::LinkPage(PageHeader* page)
+		{
+			PageHeader*& listHead = availablePages[page->sizeClass];
+
+			page->previousPage = nullptr;
+			page->nextPage = listHead;
+
+			if (listHead != nullptr)
+			{
+				listHead->previousPage = page;
+			}
+
+			listHead = page;
+		}
+
+		void SmallObjectAllocator::UnlinkPage(PageHeader* page)
+		{
+			if (page->previousPage != nullptr)
+			{
+				page->previousPage->nextPage = page->nextPage;
+			}
+			else
+			{
+				availablePages[page->sizeClass] = page->nextPage;
+			}
+
+			if (page->nextPage != nullptr)
+			{
+				page->nextPage->previousPage = page->previousPage;
+			}
+		}
+
+		void* SmallObjectAllocator::Allocate(std::size_t size, std::uint8_t align)
+		{
+			if (size <= maximumSmallObjectSize && align <= largeSizeClassGranularity)
+			{
+				// Every chunk size that is a multiple of the alignment is also aligned to it within the page
+				std::size_t sizeClass = GetSizeClass((size + align - 1) & ~static_cast<std::size_t>(align - 1));
+				PageHeader* page = availablePages[sizeClass];
+
+				if (page == nullptr)
+				{
+					page = AcquirePage(sizeClass);
+				}
+
+				if (page != nullptr)
+				{
+					std::size_t chunkSize = GetChunkSize(sizeClass);
+					void* chunk = page->freeChunkNodeList;
+
+					if (chunk != nullptr)
+					{
+						page->freeChunkNodeList = page->freeChunkNodeList->nextFreeChunk;
+					}
+					else
+					{
+						chunk = page->firstUnusedChunk;
+						page->firstUnusedChunk += chunkSize;
+					}
+
+					page->numberOfUsedChunks++;
+
+					if (page->freeChunkNodeList == nullptr && PointerDiff(page->firstUnusedChunk, page) + chunkSize > pageSize)
+					{
+						UnlinkPage(page);
+					}
+
+					RecordAllocation(chunk, chunkSize, size);
+					return chunk;
+				}
+			}
+
+			// Large and over aligned requests, and small ones once every page is taken
+			return largeObjectAllocator.Allocate(size, align);
+		}
+
+		void SmallObjectAllocator::Deallocate(void* pointer)
+		{
+			if (!OwnsSmallObject(pointer))
+			{
+				largeObjectAllocator.Deallocate(pointer);
+				return;
+			}
+
+			PageHeader* page = GetPage(pointer);
+			std::size_t chunkSize = GetChunkSize(page->sizeClass);
+			bool wasFull = page->freeChunkNodeList == nullptr && PointerDiff(page->firstUnusedChunk, page) + chunkSize > pageSize;
+
+			ChunkNode* newChunkNode = reinterpret_cast<ChunkNode*>(pointer);
+			newChunkNode->nextFreeChunk = page->freeChunkNodeList;
+			page->freeChunkNodeList = newChunkNode;
+			page->numberOfUsedChunks--;
+
+			RecordDeallocation(pointer, chunkSize);
+
+			if (wasFull)
+			{
+				LinkPage(page);
+			}
+
+			// Empty pages go back to be shared with the other classes, except the last one of a class to avoid thrashing
+			if (page->numberOfUsedChunks == 0 && (page->nextPage != nullptr || page->previousPage != nullptr))
+			{
+				ReleasePage(page);
+			}
+		}
+	}
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "AbstractAllocator.h"
+#include "FreeListAllocator.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Untyped pools for objects up to 256 bytes. Requests are rounded up to a size class (8 byte steps up to 64,
+		// 16 byte steps above) and served from pages holding chunks of a single class. The class and the free list
+		// live in the page header, found by masking the address, so chunks carry no per-object header. Larger or
+		// over aligned requests fall through to a FreeListAllocator.
+		class SmallObjectAllocator : public AbstractAllocator<SmallObjectAllocator>
+		{
+			friend class AllocatorInterface<SmallObjectAllocator>;
+
+		public:
+			static const std::size_t pageSize = 16 * 1024;
+			static const std::size_t maximumSmallObjectSize = 256;
+
+		private:
+			struct ChunkNode {
+				ChunkNode* nextFreeChunk;
+			};
+
+			struct PageHeader {
+				PageHeader* nextPage;
+				PageHeader* previousPage;
+				ChunkNode* freeChunkNodeList;
+
+				// Chunks past this address were never handed out, pages are carved lazily so untouched memory stays untouched
+				std::uint8_t* firstUnusedChunk;
+				std::uint32_t sizeClass;
+				std::uint32_t numberOfUsedChunks;
+			};
+
+			static const std::size_t smallSizeClassGranularity = 8;
+			static const std::size_t largeSizeClassGranularity = 16;
+			static const std::size_t smallSizeClassLimit = 64;
+			static const std::size_t numberOfSizeClasses = smallSizeClassLimit / smallSizeClassGranularity + (maximumSmallObjectSize - smallSizeClassLimit) / largeSizeClassGranularity;
+
+			static const std::size_t firstChunkOffset = (sizeof(PageHeader) + largeSizeClassGranularity - 1) & ~(largeSizeClassGranularity - 1);
+
+			std::uint8_t* firstPage;
+			std::size_t numberOfPages;
+			std::size_t numberOfInitializedPages;
+			std::size_t numberOfPagesInUse;
+			PageHeader* freePageList;
+
+			// Pages of each class with at least one free chunk, full pages are unlinked until a chunk comes back
+			PageHeader* availablePages[numberOfSizeClasses];
+
+			FreeListAllocator largeObjectAllocator;
+
+			static inline std::size_t GetSizeClass(std::size_t size)
+			{
+				return (size <= smallSizeClassLimit) ? ((size > 0) ? (size - 1) / smallSizeClassGranularity : 0)
+					: smallSizeClassLimit / smallSizeClassGranularity + (size - smallSizeClassLimit - 1) / largeSizeClassGranularity;
+			}
+
+			static inline std::size_t GetChunkSize(std::size_t sizeClass)
+			{
+				const std::size_t numberOfSmallSizeClasses = smallSizeClassLimit / smallSizeClassGranularity;
+
+				return (sizeClass < numberOfSmallSizeClasses) ? (sizeClass + 1) * smallSizeClassGranularity
+					: smallSizeClassLimit + (sizeClass - numberOfSmallSizeClasses + 1) * largeSizeClassGranularity;
+			}
+
+			inline PageHeader* GetPage(const void* pointer)
+			{
+				return reinterpret_cast<PageHeader*>(reinterpret_cast<std::uintptr_t>(pointer) & ~(pageSize - 1));
+			}
+
+			PageHeader* AcquirePage(std::size_t sizeClass);
+
+			void ReleasePage(PageHeader* page);
+
+			void LinkPage(PageHeader* page);
+
+			void UnlinkPage(PageHeader* page);
+
+		protected:
+			void* Allocate(std::size_t size, std::uint8_t align);
+
+			void Deallocate(void* pointer);
+
+		public:
+			SmallObjectAllocator() = delete;
+
+			// smallObjectMemory is split into pages shared by all size classes, largeObjectMemory backs the fall through heap
+			SmallObjectAllocator(std::size_t smallObjectMemory, std::size_t largeObjectMemory);
+
+			#ifdef VISAGE_MEMORY_CHECKING
+				~SmallObjectAllocator()
+				{
+					FlushQuarantine();
+				}
+			#endif
+
+			// Includes the allocations that fell through to the large object heap
+			inline std::size_t GetNumberOfAllocations()
+			{
+				return numberOfAllocations + largeObjectAllocator.GetNumberOfAllocations();
+			}
+
+			inline std::size_t GetMemoryUsed()
+			{
+				return memoryUsed + largeObjectAllocator.GetMemoryUsed();
+			}
+
+			inline FreeListAllocator& GetLargeObjectAllocator()
+			{
+				return largeObjectAllocator;
+			}
+
+			// Number of pages currently assigned to a size class
+			inline std::size_t GetNumberOfPagesInUse()
+			{
+				return numberOfPagesInUse;
+			}
+
+			// True if the pointer lies in one of the small object pages
+			inline bool OwnsSmallObject(const void* pointer)
+			{
+				return PointerDiff(pointer, firstPage) < numberOfPages * pageSize;
+			}
+		};
+	}
+}
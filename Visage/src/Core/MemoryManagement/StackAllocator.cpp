@@ -15,50 +15,25 @@ namespace Visage
 			#endif
 		}
 
-		void* StackAllocator::Allocate(std::size_t size, std::uint8_t align)
+		StackAllocator::StackAllocator(std::size_t size, const VirtualMemoryPolicy& policy)
+			: AbstractAllocator(size, policy)
 		{
-			void* alignedAddress = nullptr;
-			std::uint8_t adjustment = AlignedPointerWithHeaderAdjustment(topOfStackMarker, align, allocationHeaderSize);
-
-			if (memoryUsed + size + adjustment <= sizeOfBuffer)
-			{
-				alignedAddress = AddToPointer(topOfStackMarker, adjustment);
-
-				AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubtractFromPointer(alignedAddress, allocationHeaderSize));
-				header->adjustment = adjustment;
-
-				topOfStackMarker = AddToPointer(alignedAddress, size);
-				memoryUsed += size + adjustment;
-				numberOfAllocations++;
-
-				#ifdef DEBUG
-					header->previousAddress = previousAddress;
-					previousAddress = alignedAddress;
-				#endif
-			}
-
-			return alignedAddress;
-		}
-
-		void StackAllocator::Deallocate(void*& pointer)
-		{
-			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubtractFromPointer(pointer, allocationHeaderSize));
+			topOfStackMarker = startOfBuffer;
 
 			#ifdef DEBUG
-				assert(previousAddress == pointer);
-				previousAddress = header->previousAddress;
+				previousAddress = nullptr;
 			#endif
-				
-			memoryUsed -= PointerDiff(topOfStackMarker, pointer) + header->adjustment;
-			numberOfAllocations--;	
-			topOfStackMarker = SubtractFromPointer(pointer, header->adjustment);
 		}
 
 		void StackAllocator::ClearStack()
 		{
-			memoryUsed = 0;
-			numberOfAllocations = 0;
+			RecordReset();
 			topOfStackMarker = startOfBuffer;
+			DecommitBuffer();
+
+			#ifdef DEBUG
+				previousAddress = nullptr;
+			#endif
 		}
 
 		void* StackAllocator::GetTopOfStack()
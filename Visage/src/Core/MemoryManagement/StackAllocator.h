@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AbstractAllocator.h"
+#include "MemoryUtils.h"
 #include <cstddef>
 #include <cstdint>
 
@@ -8,8 +9,10 @@ namespace Visage
 {
 	namespace Core
 	{
-		class StackAllocator : public AbstractAllocator
+		class StackAllocator : public AbstractAllocator<StackAllocator>
 		{
+			friend class AllocatorInterface<StackAllocator>;
+
 		private:
 			struct AllocationHeader {
 				std::uint8_t adjustment;
@@ -28,73 +31,121 @@ namespace Visage
 			static const std::size_t allocationHeaderSize = sizeof(AllocationHeader);
 
 		protected:
-			void* Allocate(std::size_t size, std::uint8_t align) override;
+			inline void* Allocate(std::size_t size, std::uint8_t align)
+			{
+				void* alignedAddress = nullptr;
+				std::uint8_t adjustment = AlignedPointerWithHeaderAdjustment(topOfStackMarker, align, allocationHeaderSize);
+
+				if (memoryUsed + size + adjustment <= sizeOfBuffer)
+				{
+					alignedAddress = AddToPointer(topOfStackMarker, adjustment);
+					void* newTopOfStackMarker = AddToPointer(alignedAddress, size);
+
+					if (reinterpret_cast<std::uintptr_t>(newTopOfStackMarker) > reinterpret_cast<std::uintptr_t>(endOfCommittedBuffer) && !CommitBufferUpTo(newTopOfStackMarker))
+					{
+						return nullptr; // assert out of memory error
+					}
+
+					AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubtractFromPointer(alignedAddress, allocationHeaderSize));
+					header->adjustment = adjustment;
+
+					topOfStackMarker = newTopOfStackMarker;
+					RecordAllocation(alignedAddress, size + adjustment, size);
+
+					#ifdef DEBUG
+						header->previousAddress = previousAddress;
+						previousAddress = alignedAddress;
+					#endif
+				}
+
+				return alignedAddress;
+			}
 
-			void Deallocate(void*& pointer) override;
+			inline void Deallocate(void* pointer)
+			{
+				AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubtractFromPointer(pointer, allocationHeaderSize));
+
+				#ifdef DEBUG
+					assert(previousAddress == pointer);
+					previousAddress = header->previousAddress;
+				#endif
+
+				RecordDeallocation(pointer, PointerDiff(topOfStackMarker, pointer) + header->adjustment);
+				topOfStackMarker = SubtractFromPointer(pointer, header->adjustment);
+			}
 
 		public:
+			// Saved state of the stack, everything allocated after the marker was taken is freed by FreeToMarker
+			struct Marker {
+				void* topOfStack;
+				std::size_t memoryUsed;
+				std::size_t numberOfAllocations;
+
+				#ifdef DEBUG
+					void* previousAddress;
+				#endif
+			};
+
 			StackAllocator() = delete;
 
 			StackAllocator(std::size_t size);
 
+			StackAllocator(std::size_t size, const VirtualMemoryPolicy& policy);
+
 			void ClearStack();
 
 			void* GetTopOfStack();
 
-			template <typename T>
-			T* New()
+			inline Marker GetMarker() const
 			{
-				return new (Allocate(sizeof(T), alignof(T))) T;
+				#ifdef DEBUG
+					return { topOfStackMarker, memoryUsed, numberOfAllocations, previousAddress };
+				#else
+					return { topOfStackMarker, memoryUsed, numberOfAllocations };
+				#endif
 			}
 
-			template <typename T, typename... Args>
-			T* NewWithArgs(Args&&... args)
+			// Releases every allocation made since the marker in one step, destructors of the objects are not called.
+			// Markers have to be freed in the reverse order they were taken.
+			inline void FreeToMarker(const Marker& marker)
 			{
-				return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+				assert(reinterpret_cast<std::uintptr_t>(marker.topOfStack) >= reinterpret_cast<std::uintptr_t>(startOfBuffer) &&
+					reinterpret_cast<std::uintptr_t>(marker.topOfStack) <= reinterpret_cast<std::uintptr_t>(topOfStackMarker));
+
+				RecordRewind(marker.topOfStack, topOfStackMarker, marker.memoryUsed, marker.numberOfAllocations);
+				topOfStackMarker = marker.topOfStack;
+
+				#ifdef DEBUG
+					previousAddress = marker.previousAddress;
+				#endif
 			}
+		};
 
-			template <typename T>
-			T* NewArray(std::size_t arrayLength)
-			{
-				std::uint8_t numberOfElementsForOneWord = sizeof(size_t) / sizeof(T);
+		// Rewinds the stack to where it was when the frame was created once the frame goes out of scope, e.g.
+		// { ScopedStackFrame frame(stack); ... allocate temporaries ... }
+		class ScopedStackFrame
+		{
+		private:
+			StackAllocator& stack;
+			StackAllocator::Marker marker;
 
-				if (sizeof(size_t) > (static_cast<std::size_t>(numberOfElementsForOneWord) * sizeof(T)))
-				{
-					numberOfElementsForOneWord += 1;
-				}
-				
-				T* baseArrayAddress = reinterpret_cast<T*>(Allocate((arrayLength + numberOfElementsForOneWord) * sizeof(T), alignof(T))) + numberOfElementsForOneWord;
-				*(reinterpret_cast<std::size_t*>(baseArrayAddress) - 1) = arrayLength;
+		public:
+			explicit ScopedStackFrame(StackAllocator& stack)
+				: stack(stack), marker(stack.GetMarker())
+			{ }
 
-				for (std::size_t i = 0; i < arrayLength; i++)
-				{
-					new (&baseArrayAddress[i]) T;
-				}
-				
-				return baseArrayAddress;
-			}
+			ScopedStackFrame(const ScopedStackFrame& frame) = delete;
+			ScopedStackFrame& operator=(const ScopedStackFrame& frame) = delete;
 
-			template <typename T>
-			void Delete(T* objectToDelete)
+			~ScopedStackFrame()
 			{
-				objectToDelete->~T();
-				Deallocate(reinterpret_cast<void*&>(objectToDelete));
+				stack.FreeToMarker(marker);
 			}
 
-			template <typename T>
-			void DeleteArray(T* arrayToDelete)
+			inline const StackAllocator::Marker& GetMarker() const
 			{
-				std::size_t arrayLength = *(reinterpret_cast<std::size_t*>(arrayToDelete) - 1);
-
-				for (std::size_t i = 0; i < arrayLength; i++)
-				{
-					arrayToDelete[i].~T();
-				}
-
-				arrayToDelete = reinterpret_cast<T*>(reinterpret_cast<std::size_t*>(arrayToDelete) - 1);
-				Deallocate(reinterpret_cast<void*&>(arrayToDelete));
+				return marker;
 			}
 		};
 	}
 }
-
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "AllocatorInterface.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// std::allocator compatible adapter that lets standard containers draw their memory from any Visage
+		// allocator, e.g. std::vector<int, StlAllocator<int, FreeListAllocator>> vector(freeListAllocator).
+		// The adapter only holds a pointer, copies and rebinds share the same allocator. Containers free memory
+		// in any order, so a StackAllocator is only usable for containers that never grow after being filled.
+		template <typename T, typename Allocator>
+		class StlAllocator
+		{
+		private:
+			AllocatorInterface<Allocator>* allocator;
+
+		public:
+			using value_type = T;
+
+			StlAllocator() = delete;
+
+			StlAllocator(AllocatorInterface<Allocator>& allocator)
+				: allocator(&allocator)
+			{ }
+
+			template <typename U>
+			StlAllocator(const StlAllocator<U, Allocator>& stlAllocator)
+				: allocator(stlAllocator.GetAllocator())
+			{ }
+
+			T* allocate(std::size_t numberOfElements)
+			{
+				static_assert(alignof(T) <= 128, "Visage allocators take the alignment as a std::uint8_t");
+
+				void* alignedAddress = allocator->AllocateBytes(numberOfElements * sizeof(T), alignof(T));
+
+				if (alignedAddress == nullptr)
+				{
+					throw std::bad_alloc(); // Containers have no way to handle a null allocation
+				}
+
+				return static_cast<T*>(alignedAddress);
+			}
+
+			void deallocate(T* pointer, std::size_t numberOfElements)
+			{
+				allocator->DeallocateBytes(pointer);
+			}
+
+			inline AllocatorInterface<Allocator>* GetAllocator() const
+			{
+				return allocator;
+			}
+		};
+
+		template <typename T, typename U, typename Allocator>
+		inline bool operator==(const StlAllocator<T, Allocator>& leftAllocator, const StlAllocator<U, Allocator>& rightAllocator)
+		{
+			return leftAllocator.GetAllocator() == rightAllocator.GetAllocator();
+		}
+
+		template <typename T, typename U, typename Allocator>
+		inline bool operator!=(const StlAllocator<T, Allocator>& leftAllocator, const StlAllocator<U, Allocator>& rightAllocator)
+		{
+			return !(leftAllocator == rightAllocator);
+		}
+	}
+}
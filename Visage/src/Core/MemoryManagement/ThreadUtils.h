@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace Visage
+{
+	namespace Core
+	{
+		static const std::size_t cacheLineSize = 64;
+
+		static const std::size_t maximumNumberOfThreads = 64;
+
+		// Hands every live thread a small dense index so allocators can keep per-thread state in flat arrays.
+		// Indices of threads that have exited are recycled for new threads. More than maximumNumberOfThreads live
+		// threads would index past those arrays, so that aborts in release builds too.
+		class ThreadIndex
+		{
+		private:
+			std::size_t index;
+
+			static std::mutex& GetRegistryMutex()
+			{
+				static std::mutex registryMutex;
+				return registryMutex;
+			}
+
+			static std::vector<std::size_t>& GetFreeIndices()
+			{
+				static std::vector<std::size_t> freeIndices;
+				return freeIndices;
+			}
+
+			static std::size_t& GetNextIndex()
+			{
+				static std::size_t nextIndex = 0;
+				return nextIndex;
+			}
+
+		public:
+			ThreadIndex()
+			{
+				std::lock_guard<std::mutex> lock(GetRegistryMutex());
+				std::vector<std::size_t>& freeIndices = GetFreeIndices();
+
+				if (!freeIndices.empty())
+				{
+					index = freeIndices.back();
+					freeIndices.pop_back();
+				}
+				else
+				{
+					index = GetNextIndex()++;
+				}
+
+				if (index >= maximumNumberOfThreads)
+				{
+					std::fprintf(stderr, "Visage thread index %zu exceeds the limit of %zu live threads\n", index, maximumNumberOfThreads);
+					std::abort();
+				}
+			}
+
+			~ThreadIndex()
+			{
+				std::lock_guard<std::mutex> lock(GetRegistryMutex());
+				GetFreeIndices().push_back(index);
+			}
+
+			ThreadIndex(const ThreadIndex& threadIndex) = delete;
+			ThreadIndex& operator=(const ThreadIndex& threadIndex) = delete;
+
+			inline std::size_t Get() const
+			{
+				return index;
+			}
+		};
+
+		inline std::size_t GetCurrentThreadIndex()
+		{
+			thread_local ThreadIndex threadIndex;
+			return threadIndex.Get();
+		}
+	}
+}
@@ -0,0 +1,259 @@
+#include "VirtualMemory.h"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace Visage
+{
+	namespace Core
+	{
+		std::size_t GetPageSize()
+		{
+			#ifdef _WIN32
+				static const std::size_t pageSize = []() {
+					SYSTEM_INFO systemInfo;
+					GetSystemInfo(&systemInfo);
+					return static_cast<std::size_t>(systemInfo.dwPageSize);
+				}();
+			#else
+				static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+			#endif
+
+			return pageSize;
+		}
+
+		void* ReserveVirtualMemory(std::size_t size)
+		{
+			#ifdef _WIN32
+				return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+			#else
+				void* address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+				return (address != MAP_FAILED) ? address : nullptr;
+			#endif
+		}
+
+		bool CommitVirtualMemory(void* address, std::size_t size)
+		{
+			#ifdef _WIN32
+				return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+			#else
+				return mprotect(address, size, PROT_READ | PROT_WRITE) == 0;
+			#endif
+		}
+
+		void DecommitVirtualMemory(void* address, std::size_t size)
+		{
+			#ifdef _WIN32
+				VirtualFree(address, size, MEM_DECOMMIT);
+			#else
+				madvise(address, size, MADV_DONTNEED);
+				mprotect(address, size, PROT_NONE);
+			#endif
+		}
+
+		void ReleaseVirtualMemory(void* address, std::size_t size)
+		{
+			#ifdef _WIN32
+				VirtualFree(address, 0, MEM_RELEASE);
+			#else
+				munmap(address, size);
+			#endif
+		}
+
+		#ifdef _WIN32
+			void* MapPhysicalMemory(std::size_t& size, const PhysicalMemoryPolicy& policy, BufferBacking& backing, int& numaNode)
+			{
+				const DWORD preferredNode = (policy.numaNode >= 0) ? static_cast<DWORD>(policy.numaNode) : NUMA_NO_PREFERRED_NODE;
+				void* address = nullptr;
+
+				// Large pages need the SeLockMemoryPrivilege, without it the request fails and regular pages are used
+				std::size_t largePageSize = GetLargePageMinimum();
+				if (policy.hugePages != HugePageMode::None && largePageSize != 0)
+				{
+					std::size_t largePageBufferSize = (size + largePageSize - 1) & ~(largePageSize - 1);
+					address = VirtualAllocExNuma(GetCurrentProcess(), nullptr, largePageBufferSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, preferredNode);
+
+					if (address != nullptr)
+					{
+						size = largePageBufferSize;
+						backing = BufferBacking::ExplicitHugePages;
+					}
+				}
+
+				if (address == nullptr)
+				{
+					size = RoundUpToPageSize(size);
+					address = VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, preferredNode);
+					backing = BufferBacking::Pages;
+				}
+
+				// The node is only a preference on Windows
+				numaNode = (address != nullptr) ? policy.numaNode : -1;
+
+				return address;
+			}
+		#else
+			static const std::size_t hugePageSize = 2 * 1024 * 1024;
+
+			static bool BindToNumaNode(void* address, std::size_t size, int numaNode)
+			{
+				#ifdef SYS_mbind
+					const int bindPolicy = 2; // MPOL_BIND
+					const std::size_t bitsPerMaskWord = sizeof(unsigned long) * 8;
+					unsigned long nodeMask[4] = {};
+
+					if (numaNode < 0 || static_cast<std::size_t>(numaNode) >= sizeof(nodeMask) * 8)
+					{
+						return false;
+					}
+
+					nodeMask[numaNode / bitsPerMaskWord] = 1UL << (numaNode % bitsPerMaskWord);
+
+					// The kernel expects one more than the number of bits in the mask
+					return syscall(SYS_mbind, address, size, bindPolicy, nodeMask, sizeof(nodeMask) * 8 + 1, 0) == 0;
+				#else
+					return false;
+				#endif
+			}
+
+			// madvise accepts MADV_HUGEPAGE even when transparent huge pages are turned off, so the kernel setting
+			// decides what the buffer is backed by
+			static BufferBacking GetTransparentHugePageBacking()
+			{
+				std::FILE* file = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+				if (file == nullptr)
+				{
+					return BufferBacking::HugePagesRequested;
+				}
+
+				// The active mode is the bracketed one, e.g. "always [madvise] never"
+				char modes[64] = {};
+				bool read = std::fgets(modes, sizeof(modes), file) != nullptr;
+				std::fclose(file);
+
+				if (read && (std::strstr(modes, "[always]") != nullptr || std::strstr(modes, "[madvise]") != nullptr))
+				{
+					return BufferBacking::TransparentHugePages;
+				}
+
+				return (read && std::strstr(modes, "[never]") != nullptr) ? BufferBacking::Pages : BufferBacking::HugePagesRequested;
+			}
+
+			static void* MapHugePageAligned(std::size_t size)
+			{
+				// Over map so the buffer can start on a huge page boundary, then trim both ends
+				void* address = mmap(nullptr, size + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if (address == MAP_FAILED)
+				{
+					return nullptr;
+				}
+
+				std::uintptr_t start = reinterpret_cast<std::uintptr_t>(address);
+				std::uintptr_t alignedStart = (start + hugePageSize - 1) & ~(hugePageSize - 1);
+
+				if (alignedStart > start)
+				{
+					munmap(address, alignedStart - start);
+				}
+
+				munmap(reinterpret_cast<void*>(alignedStart + size), (start + size + hugePageSize) - (alignedStart + size));
+
+				return reinterpret_cast<void*>(alignedStart);
+			}
+
+			void* MapPhysicalMemory(std::size_t& size, const PhysicalMemoryPolicy& policy, BufferBacking& backing, int& numaNode)
+			{
+				void* address = nullptr;
+
+				if (policy.hugePages == HugePageMode::Explicit)
+				{
+					#ifdef MAP_HUGETLB
+						std::size_t hugePageBufferSize = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+						address = mmap(nullptr, hugePageBufferSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+						if (address != MAP_FAILED)
+						{
+							size = hugePageBufferSize;
+							backing = BufferBacking::ExplicitHugePages;
+						}
+						else
+						{
+							address = nullptr;
+						}
+					#endif
+				}
+
+				if (address == nullptr && policy.hugePages != HugePageMode::None)
+				{
+					std::size_t hugePageBufferSize = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+					address = MapHugePageAligned(hugePageBufferSize);
+
+					if (address != nullptr)
+					{
+						size = hugePageBufferSize;
+						backing = BufferBacking::Pages;
+
+						#ifdef MADV_HUGEPAGE
+							if (madvise(address, size, MADV_HUGEPAGE) == 0)
+							{
+								backing = GetTransparentHugePageBacking();
+							}
+						#endif
+					}
+				}
+
+				if (address == nullptr)
+				{
+					size = RoundUpToPageSize(size);
+					address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+					if (address == MAP_FAILED)
+					{
+						return nullptr;
+					}
+
+					backing = BufferBacking::Pages;
+				}
+
+				// Binding has to happen before the pages are first touched to place them on the node
+				numaNode = (policy.numaNode >= 0 && BindToNumaNode(address, size, policy.numaNode)) ? policy.numaNode : -1;
+
+				return address;
+			}
+		#endif
+
+		const char* GetBufferBackingName(BufferBacking backing)
+		{
+			switch (backing)
+			{
+				case BufferBacking::Heap:
+					return "Heap";
+				case BufferBacking::ReservedVirtualMemory:
+					return "ReservedVirtualMemory";
+				case BufferBacking::Pages:
+					return "Pages";
+				case BufferBacking::TransparentHugePages:
+					return "TransparentHugePages";
+				case BufferBacking::HugePagesRequested:
+					return "HugePagesRequested";
+				default:
+					assert(backing == BufferBacking::ExplicitHugePages);
+					return "ExplicitHugePages";
+			}
+		}
+	}
+}
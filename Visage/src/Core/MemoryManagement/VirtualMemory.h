@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Visage
+{
+	namespace Core
+	{
+		// Where an allocator's buffer comes from
+		enum class BufferBacking : std::uint8_t
+		{
+			Heap,
+			ReservedVirtualMemory,
+			Pages,
+
+			// madvise'd for huge pages with transparent huge pages enabled, faults may still get regular pages
+			TransparentHugePages,
+
+			// madvise'd for huge pages, but whether transparent huge pages are enabled could not be read
+			HugePagesRequested,
+
+			ExplicitHugePages
+		};
+
+		enum class HugePageMode : std::uint8_t
+		{
+			None,
+
+			// Ask the kernel to back the buffer with 2 MB pages when it can (Linux only)
+			Transparent,
+
+			// Reserved huge pages, falls back to transparent ones when none are available
+			Explicit
+		};
+
+		// For large long lived buffers where TLB misses and remote NUMA accesses matter
+		struct PhysicalMemoryPolicy
+		{
+			HugePageMode hugePages = HugePageMode::Transparent;
+
+			// NUMA node to bind the buffer to, -1 leaves placement to the OS
+			int numaNode = -1;
+		};
+
+		// For allocators that reserve their whole buffer up front and commit pages as they fill it
+		struct VirtualMemoryPolicy
+		{
+			// Committed memory grows by at least this many bytes at a time
+			std::size_t commitGranularity = 64 * 1024;
+
+			// Reset keeps this many bytes committed and returns the rest of the buffer to the OS
+			std::size_t decommitThreshold = 1024 * 1024;
+		};
+
+		// Thin wrappers over the OS virtual memory calls. Addresses and sizes passed to Commit/Decommit have to be
+		// page aligned, reserved ranges take up address space only until pages in them are committed.
+		std::size_t GetPageSize();
+
+		inline std::size_t RoundUpToPageSize(std::size_t size)
+		{
+			const std::size_t pageSize = GetPageSize();
+			return (size + pageSize - 1) & ~(pageSize - 1);
+		}
+
+		// Returns nullptr if the address range could not be reserved
+		void* ReserveVirtualMemory(std::size_t size);
+
+		bool CommitVirtualMemory(void* address, std::size_t size);
+
+		// Returns the pages to the OS, the range stays reserved and can be committed again
+		void DecommitVirtualMemory(void* address, std::size_t size);
+
+		void ReleaseVirtualMemory(void* address, std::size_t size);
+
+		// Maps committed read/write memory following the policy as closely as the system allows. size is rounded up
+		// to the page size that was used, backing and numaNode receive what was actually obtained (numaNode is -1
+		// when the memory is not bound). Returns nullptr on failure, release the memory with ReleaseVirtualMemory.
+		void* MapPhysicalMemory(std::size_t& size, const PhysicalMemoryPolicy& policy, BufferBacking& backing, int& numaNode);
+
+		const char* GetBufferBackingName(BufferBacking backing);
+	}
+}
@@ -4,6 +4,7 @@
 #include "Vec3.h"
 #include "Mat4.h"
 #include "Mat3x4.h"
+#include "VectorArrays.h"
 
 namespace Visage
 {
@@ -39,6 +40,9 @@ namespace Visage
 			static T Dot(const DualQuaternion<T>& leftDualQuat, const DualQuaternion<T>& rightDualQuat);
 			static DualQuaternion<T> Sclerp(const DualQuaternion<T>& leftDualQuat, const DualQuaternion<T>& rightDualQuat, const T t);
 			static Vec3<T> TransformVector(const DualQuaternion<T>& dualQuat, const Vec3<T>& vector);
+			// TransformVector for count vectors, results may be the vectors
+			static void TransformVectors(const DualQuaternion<T>& dualQuat, const Vec3<T>* vectors, Vec3<T>* results, const std::size_t count);
+			static void TransformVectors(const DualQuaternion<T>& dualQuat, const Vec3Arrays<const T>& vectors, const Vec3Arrays<T>& results, const std::size_t count);
 
 			DualQuaternion<T>& operator=(const DualQuaternion<T>& dualQuat);
 			DualQuaternion<T>& operator*=(const DualQuaternion<T>& dualQuat);
@@ -83,3 +87,4 @@ namespace Visage
 }
 
 #include "DualQuaternion.inl"
+#include "DualQuaternionSimd.inl"
@@ -244,16 +244,39 @@ namespace Visage
 		template <typename T>
 		Vec3<T> DualQuaternion<T>::TransformVector(const DualQuaternion<T>& dualQuat, const Vec3<T>& vector)
 		{
+			// The translation by the vector is 1 + e * vector / 2
 			DualQuaternion<T> vectorDualQuat;
-			vectorDualQuat.dual.x = vector.x;
-			vectorDualQuat.dual.y = vector.y;
-			vectorDualQuat.dual.z = vector.z;
+			vectorDualQuat.dual.x = vector.x * static_cast<T>(0.5);
+			vectorDualQuat.dual.y = vector.y * static_cast<T>(0.5);
+			vectorDualQuat.dual.z = vector.z * static_cast<T>(0.5);
 			
 			DualQuaternion<T> result = dualQuat * vectorDualQuat;
 
 			return result.GetTranslation();
 		}
 
+		template <typename T>
+		void DualQuaternion<T>::TransformVectors(const DualQuaternion<T>& dualQuat, const Vec3<T>* vectors, Vec3<T>* results, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				results[i] = TransformVector(dualQuat, vectors[i]);
+			}
+		}
+
+		template <typename T>
+		void DualQuaternion<T>::TransformVectors(const DualQuaternion<T>& dualQuat, const Vec3Arrays<const T>& vectors, const Vec3Arrays<T>& results, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				Vec3<T> result = TransformVector(dualQuat, Vec3<T>(vectors.x[i], vectors.y[i], vectors.z[i]));
+
+				results.x[i] = result.x;
+				results.y[i] = result.y;
+				results.z[i] = result.z;
+			}
+		}
+
 		template <typename T>
 		DualQuaternion<T>& DualQuaternion<T>::operator=(const DualQuaternion<T>& dualQuat)
 		{
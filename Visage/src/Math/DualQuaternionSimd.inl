@@ -0,0 +1,47 @@
+#pragma once
+
+#include "MathSimd.h"
+
+#ifdef VISAGE_MATH_SSE
+	namespace Visage
+	{
+		namespace Math
+		{
+			namespace Simd
+			{
+				// DualQuaternion::TransformVector on lanes of vectors, the rotation by the real part plus the translation
+				struct DualQuaternionKernel {
+					QuaternionKernel rotation;
+					float translation[3];
+
+					DualQuaternionKernel(const Quaternion<float>& real, const Vec3<float>& offset)
+						: rotation(real), translation{ offset.x, offset.y, offset.z }
+					{ }
+
+					template <typename L>
+					inline void Transform(typename L::Register& x, typename L::Register& y, typename L::Register& z) const
+					{
+						rotation.Transform<L>(x, y, z);
+						x = L::Add(x, L::Broadcast(translation[0]));
+						y = L::Add(y, L::Broadcast(translation[1]));
+						z = L::Add(z, L::Broadcast(translation[2]));
+					}
+				};
+			}
+
+			template <>
+			inline void DualQuaternion<float>::TransformVectors(const DualQuaternion<float>& dualQuat, const Vec3<float>* vectors, Vec3<float>* results, const std::size_t count)
+			{
+				Simd::DualQuaternionKernel kernel(dualQuat.real, dualQuat.GetTranslation());
+				Simd::TransformVec3s(kernel, reinterpret_cast<const float*>(vectors), reinterpret_cast<float*>(results), count);
+			}
+
+			template <>
+			inline void DualQuaternion<float>::TransformVectors(const DualQuaternion<float>& dualQuat, const Vec3Arrays<const float>& vectors, const Vec3Arrays<float>& results, const std::size_t count)
+			{
+				Simd::DualQuaternionKernel kernel(dualQuat.real, dualQuat.GetTranslation());
+				Simd::TransformVec3Arrays(kernel, vectors, results, count);
+			}
+		}
+	}
+#endif
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <utility>
-#include <cstring>
 #include <cmath>
 #include <cstdint>
 #include "MathFunctions.h"
@@ -11,13 +10,14 @@ namespace Visage
 	namespace Math
 	{
 		template <typename T>
-		Mat3<T>::Mat3()
+		constexpr Mat3<T>::Mat3()
 			: data{ 0 }
 		{
 		}
 
 		template<typename T>
-		Mat3<T>::Mat3(std::initializer_list<T> args)
+		constexpr Mat3<T>::Mat3(std::initializer_list<T> args)
+			: data{ 0 }
 		{
 			std::uint8_t column = 0, row = 0;
 			for (auto& element : args)
@@ -33,9 +33,10 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>::Mat3(const T m00, const T m01, const T m02,
+		constexpr Mat3<T>::Mat3(const T m00, const T m01, const T m02,
 				      const T m10, const T m11, const T m12, 
 				      const T m20, const T m21, const T m22)
+			: data{ 0 }
 		{
 			// Column-major ordering
 			data[0][0] = m00;
@@ -52,9 +53,10 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>::Mat3(const Vec3<T>& firstRow,
+		constexpr Mat3<T>::Mat3(const Vec3<T>& firstRow,
 				      const Vec3<T>& secondRow, 
 				      const Vec3<T>& thirdRow)
+			: data{ 0 }
 		{
 			// Column-major ordering
 			data[0][0] = firstRow.x;
@@ -71,7 +73,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>::Mat3(const T diagonal)
+		constexpr Mat3<T>::Mat3(const T diagonal)
 			: data{ 0 }
 		{
 			data[0][0] = diagonal;
@@ -80,17 +82,11 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>::Mat3(const Mat3<T>& matrix)
-		{
-			std::memcpy(data, matrix.data, sizeof(Mat3<T>));
-		}
-
-		template <typename T>
-		Mat3<T> Mat3<T>::Inverted() const
+		constexpr Mat3<T> Mat3<T>::Inverted() const
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
+			const Vec3<T> a = GetColumn(0);
+			const Vec3<T> b = GetColumn(1);
+			const Vec3<T> c = GetColumn(2);
 
 			Vec3<T> bCrossC = Vec3<T>::Cross(b, c);
 			Vec3<T> cCrossa = Vec3<T>::Cross(c, a);
@@ -104,11 +100,11 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>& Mat3<T>::Invert()
+		constexpr Mat3<T>& Mat3<T>::Invert()
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
+			const Vec3<T> a = GetColumn(0);
+			const Vec3<T> b = GetColumn(1);
+			const Vec3<T> c = GetColumn(2);
 
 			Vec3<T> bCrossC = Vec3<T>::Cross(b, c);
 			Vec3<T> cCrossa = Vec3<T>::Cross(c, a);
@@ -132,7 +128,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat3<T>::Transposed() const
+		constexpr Mat3<T> Mat3<T>::Transposed() const
 		{
 			return Mat3<T>(data[0][0], data[0][1], data[0][2], 
 						   data[1][0], data[1][1], data[1][2], 
@@ -140,7 +136,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>& Mat3<T>::Transpose()
+		constexpr Mat3<T>& Mat3<T>::Transpose()
 		{
 			Mat3<T> temp = *this;
 
@@ -157,7 +153,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		T Mat3<T>::Determinant() const
+		constexpr T Mat3<T>::Determinant() const
 		{
 			return data[0][0] * (data[1][1] * data[2][2] - data[2][1] * data[1][2])
 				   + data[1][0] * (data[2][1] * data[0][2] - data[0][1] * data[2][2])
@@ -165,19 +161,21 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec3<T> Mat3<T>::GetColumn(const int columnIndex) const
+		constexpr Vec3<T> Mat3<T>::GetColumn(const int columnIndex) const
 		{
-			return columns[columnIndex];
+			return Vec3<T>(data[columnIndex][0], data[columnIndex][1], data[columnIndex][2]);
 		}
 
 		template <typename T>
-		void Mat3<T>::SetColumn(const int columnIndex, const Vec3<T>& vector)
+		constexpr void Mat3<T>::SetColumn(const int columnIndex, const Vec3<T>& vector)
 		{
-			columns[columnIndex] = vector;
+			data[columnIndex][0] = vector.x;
+			data[columnIndex][1] = vector.y;
+			data[columnIndex][2] = vector.z;
 		}
 
 		template <typename T>
-		Vec3<T> Mat3<T>::GetRow(const int rowIndex) const
+		constexpr Vec3<T> Mat3<T>::GetRow(const int rowIndex) const
 		{
 			return Vec3<T>(data[0][rowIndex],
 						   data[1][rowIndex],
@@ -185,7 +183,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		void Mat3<T>::SetRow(const int rowIndex, const Vec3<T>& vector)
+		constexpr void Mat3<T>::SetRow(const int rowIndex, const Vec3<T>& vector)
 		{
 			data[0][rowIndex] = vector.x;
 			data[1][rowIndex] = vector.y;
@@ -249,7 +247,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat3<T>::MakeScale(const T uniformScale)
+		constexpr Mat3<T> Mat3<T>::MakeScale(const T uniformScale)
 		{
 			return Mat3<T>(uniformScale, 0, 0,
 						   0, uniformScale, 0,
@@ -257,7 +255,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat3<T>::MakeScale(const T scaleX, const T scaleY, const T scaleZ)
+		constexpr Mat3<T> Mat3<T>::MakeScale(const T scaleX, const T scaleY, const T scaleZ)
 		{
 			return Mat3<T>(scaleX, 0, 0,
 						   0, scaleY, 0,
@@ -265,7 +263,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat3<T>::MakeScale(const Vec3<T>& vector)
+		constexpr Mat3<T> Mat3<T>::MakeScale(const Vec3<T>& vector)
 		{
 			return Mat3<T>(vector.x, 0, 0,
 						   0, vector.y, 0,
@@ -273,32 +271,25 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat3<T>::Identity()
+		constexpr Mat3<T> Mat3<T>::Identity()
 		{
 			return Mat3<T>(1);
 		}
 
-		template <typename T>
-		Mat3<T>& Mat3<T>::operator=(const Mat3<T>& matrix)
-		{
-			std::memcpy(data, matrix.data, sizeof(Mat3<T>));
-			return *this;
-		}
-
 		template<typename T>
-		inline const T& Mat3<T>::operator()(const int rowIndex, const int columnIndex) const
+		constexpr const T& Mat3<T>::operator()(const int rowIndex, const int columnIndex) const
 		{
 			return data[columnIndex][rowIndex];
 		}
 
 		template<typename T>
-		inline T& Mat3<T>::operator()(const int rowIndex, const int columnIndex)
+		constexpr T& Mat3<T>::operator()(const int rowIndex, const int columnIndex)
 		{
 			return data[columnIndex][rowIndex];
 		}
 
 		template <typename T>
-		Mat3<T>& Mat3<T>::operator*=(const Mat3<T>& matrix)
+		constexpr Mat3<T>& Mat3<T>::operator*=(const Mat3<T>& matrix)
 		{
 			Mat3<T> temp = *this;
 
@@ -318,31 +309,32 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T>& Mat3<T>::operator*=(const T scalar)
+		constexpr Mat3<T>& Mat3<T>::operator*=(const T scalar)
 		{
-			columns[0] *= scalar;
-			columns[1] *= scalar;
-			columns[2] *= scalar;
-			
+			for (int column = 0; column < 3; column++)
+			{
+				SetColumn(column, GetColumn(column) * scalar);
+			}
+
 			return *this;
 		}
 
 		template <typename T>
-		Mat3<T> operator*(const Mat3<T>& leftMatrix, const Mat3<T>& rightMatrix)
+		constexpr Mat3<T> operator*(const Mat3<T>& leftMatrix, const Mat3<T>& rightMatrix)
 		{
 			Mat3<T> leftMatrixCopy = leftMatrix;
 			return leftMatrixCopy *= rightMatrix;
 		}
 
 		template <typename T>
-		Mat3<T> operator*(const Mat3<T>& matrix, const T scalar)
+		constexpr Mat3<T> operator*(const Mat3<T>& matrix, const T scalar)
 		{
 			Mat3<T> matrixCopy = matrix;
 			return matrixCopy *= scalar;
 		}
 
 		template<typename T>
-		Mat3<T> operator*(const T scalar, const Mat3<T>& matrix)
+		constexpr Mat3<T> operator*(const T scalar, const Mat3<T>& matrix)
 		{
 			Mat3<T> matrixCopy = matrix;
 			return matrixCopy *= scalar;
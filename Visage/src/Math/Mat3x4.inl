@@ -1,6 +1,5 @@
 #pragma once
 
-#include <cstring>
 #include <cstdint>
 #include "MathFunctions.h"
 
@@ -9,13 +8,14 @@ namespace Visage
 	namespace Math
 	{
 		template <typename T>
-		Mat3x4<T>::Mat3x4()
+		constexpr Mat3x4<T>::Mat3x4()
 			: data{ 0 }
 		{
 		}
 
 		template<typename T>
-		Mat3x4<T>::Mat3x4(std::initializer_list<T> args)
+		constexpr Mat3x4<T>::Mat3x4(std::initializer_list<T> args)
+			: data{ 0 }
 		{
 			std::uint8_t column = 0, row = 0;
 			for (auto& element : args)
@@ -31,9 +31,10 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T>::Mat3x4(const T m00, const T m01, const T m02, const T m03,
+		constexpr Mat3x4<T>::Mat3x4(const T m00, const T m01, const T m02, const T m03,
 					      const T m10, const T m11, const T m12, const T m13, 
 					      const T m20, const T m21, const T m22, const T m23)
+			: data{ 0 }
 		{
 			// Column-major ordering
 			data[0][0] = m00;
@@ -54,9 +55,10 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T>::Mat3x4(const Vec4<T>& firstRow,
+		constexpr Mat3x4<T>::Mat3x4(const Vec4<T>& firstRow,
 					      const Vec4<T>& secondRow, 
 					      const Vec4<T>& thirdRow)
+			: data{ 0 }
 		{
 			data[0][0] = firstRow.x;
 			data[1][0] = firstRow.y;
@@ -75,7 +77,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T>::Mat3x4(const T diagonal)
+		constexpr Mat3x4<T>::Mat3x4(const T diagonal)
 			: data{ 0 }
 		{
 			data[0][0] = diagonal;
@@ -84,23 +86,17 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T>::Mat3x4(const Mat3x4<T>& matrix)
-		{
-			std::memcpy(data, matrix.data, sizeof(Mat3x4<T>));
-		}
-
-		template <typename T>
-		Mat3x4<T> Mat3x4<T>::Inverted() const
+		constexpr Mat3x4<T> Mat3x4<T>::Inverted() const
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
-			const Vec3<T> d = reinterpret_cast<const Vec3<T>&>(data[3]);
+			const Vec3<T> a = GetColumn(0);
+			const Vec3<T> b = GetColumn(1);
+			const Vec3<T> c = GetColumn(2);
+			const Vec3<T> d = GetColumn(3);
 
 			Vec3<T> s = Vec3<T>::Cross(a, b);
 			Vec3<T> t = Vec3<T>::Cross(c, d);
 
-			float inverseDet = static_cast<T>(1) / Vec3<T>::Dot(s, c);
+			T inverseDet = static_cast<T>(1) / Vec3<T>::Dot(s, c);
 			s *= inverseDet;
 			t *= inverseDet;
 			Vec3<T> v = c * inverseDet;
@@ -110,49 +106,18 @@ namespace Visage
 
 
 			return Mat3x4<T>(firstRow.x, firstRow.y, firstRow.z, -Vec3<T>::Dot(b, t),
-						     secondRow.x, secondRow.y, secondRow.z, -Vec3<T>::Dot(a, t),
+						     secondRow.x, secondRow.y, secondRow.z, Vec3<T>::Dot(a, t),
 						     s.x, s.y, s.z, -Vec3<T>::Dot(d, s));
 		}
 
 		template <typename T>
-		Mat3x4<T>& Mat3x4<T>::Invert()
+		constexpr Mat3x4<T>& Mat3x4<T>::Invert()
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
-			const Vec3<T> d = reinterpret_cast<const Vec3<T>&>(data[3]);
-
-			Vec3<T> s = Vec3<T>::Cross(a, b);
-			Vec3<T> t = Vec3<T>::Cross(c, d);
-
-			float inverseDet = static_cast<T>(1) / Vec3<T>::Dot(s, c);
-			s *= inverseDet;
-			t *= inverseDet;
-			Vec3<T> v = c * inverseDet;
-
-			Vec3<T> firstRow = Vec3<T>::Cross(b, v);
-			Vec3<T> secondRow = Vec3<T>::Cross(v, a);
-
-			data[0][0] = firstRow.x;
-			data[1][0] = firstRow.y;
-			data[2][0] = firstRow.z;
-			data[3][0] = -Vec3<T>::Dot(b, t);
-
-			data[0][1] = secondRow.x;
-			data[1][1] = secondRow.y;
-			data[2][1] = secondRow.z;
-			data[3][1] = -Vec3<T>::Dot(a, t);
-
-			data[0][2] = s.x;
-			data[1][2] = s.y;
-			data[2][2] = s.z;
-			data[3][2] = -Vec3<T>::Dot(d, s);
-
-			return *this;
+			return *this = Inverted();
 		}
 
 		template <typename T>
-		Mat4<T> Mat3x4<T>::TransposeMatrix() const
+		constexpr Mat4<T> Mat3x4<T>::TransposeMatrix() const
 		{
 			return Mat4<T>(data[0][0], data[0][1], data[0][2], 0,
 						data[1][0], data[1][1], data[1][2], 0,
@@ -161,12 +126,12 @@ namespace Visage
 		}
 
 		template <typename T>
-		T Mat3x4<T>::Determinant() const
+		constexpr T Mat3x4<T>::Determinant() const
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
-			const Vec3<T> d = reinterpret_cast<const Vec3<T>&>(data[3]);
+			const Vec3<T> a = GetColumn(0);
+			const Vec3<T> b = GetColumn(1);
+			const Vec3<T> c = GetColumn(2);
+			const Vec3<T> d = GetColumn(3);
 
 			Vec3<T> s = Vec3<T>::Cross(a, b);
 			Vec3<T> t = Vec3<T>::Cross(c, d);
@@ -175,7 +140,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec3<T> Mat3x4<T>::GetColumn(const int columnIndex) const
+		constexpr Vec3<T> Mat3x4<T>::GetColumn(const int columnIndex) const
 		{
 			return Vec3<T>(data[columnIndex][0],
 						   data[columnIndex][1],
@@ -183,7 +148,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		void Mat3x4<T>::SetColumn(const int columnIndex, const Vec3<T>& vector)
+		constexpr void Mat3x4<T>::SetColumn(const int columnIndex, const Vec3<T>& vector)
 		{
 			data[columnIndex][0] = vector.x;
 			data[columnIndex][1] = vector.y;
@@ -191,7 +156,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T> Mat3x4<T>::GetRow(const int rowIndex) const
+		constexpr Vec4<T> Mat3x4<T>::GetRow(const int rowIndex) const
 		{
 			return Vec4<T>(data[0][rowIndex],
 						   data[1][rowIndex],
@@ -200,7 +165,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		void Mat3x4<T>::SetRow(const int rowIndex, const Vec4<T>& vector)
+		constexpr void Mat3x4<T>::SetRow(const int rowIndex, const Vec4<T>& vector)
 		{
 			data[0][rowIndex] = vector.x;
 			data[1][rowIndex] = vector.y;
@@ -209,19 +174,19 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec3<T> Mat3x4<T>::GetTranslation() const
+		constexpr Vec3<T> Mat3x4<T>::GetTranslation() const
 		{
-			return columns[3];
+			return GetColumn(3);
 		}
 
 		template <typename T>
-		void Mat3x4<T>::SetTranslation(const Vec3<T>& translation)
+		constexpr void Mat3x4<T>::SetTranslation(const Vec3<T>& translation)
 		{
-			columns[3] = translation;
+			SetColumn(3, translation);
 		}
 
 		template <typename T>
-		Mat3<T> Mat3x4<T>::AffineMatrix() const
+		constexpr Mat3<T> Mat3x4<T>::AffineMatrix() const
 		{
 			return Mat3<T>(data[0][0], data[1][0], data[2][0],
 						   data[0][1], data[1][1], data[2][1],
@@ -229,15 +194,15 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat3x4<T>::NormalMatrix() const
+		constexpr Mat3<T> Mat3x4<T>::NormalMatrix() const
 		{
 			return AffineMatrix().Inverted().Transposed();
 		}
 
 		template <typename T>
-		Mat4<T> Mat3x4<T>::ToMat4() const
+		constexpr Mat4<T> Mat3x4<T>::ToMat4() const
 		{
-			return Mat4<T>();
+			return Mat4<T>(GetRow(0), GetRow(1), GetRow(2), Vec4<T>(0, 0, 0, 1));
 		}
 
 		template <typename T>
@@ -297,7 +262,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::MakeScale(const T uniformScale)
+		constexpr Mat3x4<T> Mat3x4<T>::MakeScale(const T uniformScale)
 		{
 			return Mat3x4<T>(uniformScale, 0, 0, 0,
 						     0, uniformScale, 0, 0,
@@ -305,7 +270,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::MakeScale(const T scaleX, const T scaleY, const T scaleZ)
+		constexpr Mat3x4<T> Mat3x4<T>::MakeScale(const T scaleX, const T scaleY, const T scaleZ)
 		{
 			return Mat3x4<T>(scaleX, 0, 0, 0,
 						     0, scaleY, 0, 0,
@@ -313,7 +278,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::MakeScale(const Vec3<T>& vector)
+		constexpr Mat3x4<T> Mat3x4<T>::MakeScale(const Vec3<T>& vector)
 		{
 			return Mat3x4<T>(vector.x, 0, 0, 0,
 						     0, vector.y, 0, 0,
@@ -321,7 +286,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::MakeTranslation(const T uniformTranslation)
+		constexpr Mat3x4<T> Mat3x4<T>::MakeTranslation(const T uniformTranslation)
 		{
 			return Mat3x4<T>(1, 0, 0, uniformTranslation,
 						     0, 1, 0, uniformTranslation,
@@ -329,7 +294,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::MakeTranslation(const T translationX, const T translationY, const T translationZ)
+		constexpr Mat3x4<T> Mat3x4<T>::MakeTranslation(const T translationX, const T translationY, const T translationZ)
 		{
 			return Mat3x4<T>(1, 0, 0, translationX,
 						     0, 1, 0, translationY,
@@ -337,7 +302,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::MakeTranslation(const Vec3<T>& vector)
+		constexpr Mat3x4<T> Mat3x4<T>::MakeTranslation(const Vec3<T>& vector)
 		{
 			return Mat3x4<T>(1, 0, 0, vector.x,
 						     0, 1, 0, vector.y,
@@ -357,7 +322,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::Orthographic(const T left, const T right, const T bottom, const T top, const T near, const T far)
+		constexpr Mat3x4<T> Mat3x4<T>::Orthographic(const T left, const T right, const T bottom, const T top, const T near, const T far)
 		{
 			return Mat3x4<T>(static_cast<T>(2) / (right - left), 0, 0, (left + right) / (left - right),
 						     0, static_cast<T>(2) / (top - bottom), 0, (bottom + top) / (bottom - top),
@@ -365,90 +330,121 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> Mat3x4<T>::Identity()
+		constexpr Mat3x4<T> Mat3x4<T>::Identity()
 		{
 			return Mat3x4<T>(1);
 		}
 
 		template <typename T>
-		Mat3x4<T>& Mat3x4<T>::operator=(const Mat3x4<T>& matrix)
+		void Mat3x4<T>::TransformVectors(const Mat3x4<T>& matrix, const Vec3<T>* vectors, Vec3<T>* results, const std::size_t count)
 		{
-			std::memcpy(data, matrix.data, sizeof(Mat3x4<T>));
-			return *this;
+			for (std::size_t i = 0; i < count; i++)
+			{
+				results[i] = matrix * vectors[i];
+			}
+		}
+
+		template <typename T>
+		void Mat3x4<T>::TransformVectors(const Mat3x4<T>& matrix, const Vec3Arrays<const T>& vectors, const Vec3Arrays<T>& results, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				Vec3<T> result = matrix * Vec3<T>(vectors.x[i], vectors.y[i], vectors.z[i]);
+
+				results.x[i] = result.x;
+				results.y[i] = result.y;
+				results.z[i] = result.z;
+			}
 		}
 
 		template<typename T>
-		const T& Mat3x4<T>::operator()(const int rowIndex, const int columnIndex) const
+		constexpr const T& Mat3x4<T>::operator()(const int rowIndex, const int columnIndex) const
 		{
 			return data[columnIndex][rowIndex];
 		}
 
 		template<typename T>
-		T& Mat3x4<T>::operator()(const int rowIndex, const int columnIndex)
+		constexpr T& Mat3x4<T>::operator()(const int rowIndex, const int columnIndex)
 		{
 			return data[columnIndex][rowIndex];
 		}
 
 		template <typename T>
-		Mat3x4<T>& Mat3x4<T>::operator*=(const Mat3x4<T>& matrix)
+		constexpr Mat3x4<T>& Mat3x4<T>::operator*=(const Mat3x4<T>& matrix)
 		{
-			Mat3x4<T> temp = *this;
+			return *this = Multiply(*this, matrix);
+		}
 
-			data[0][0] = temp.data[0][0] * matrix.data[0][0] + temp.data[1][0] * matrix.data[0][1] + temp.data[2][0] * matrix.data[0][2];
-			data[1][0] = temp.data[0][0] * matrix.data[1][0] + temp.data[1][0] * matrix.data[1][1] + temp.data[2][0] * matrix.data[1][2];
-			data[2][0] = temp.data[0][0] * matrix.data[2][0] + temp.data[1][0] * matrix.data[2][1] + temp.data[2][0] * matrix.data[2][2];
-			data[3][0] = temp.data[0][0] * matrix.data[3][0] + temp.data[1][0] * matrix.data[3][1] + temp.data[2][0] * matrix.data[3][2] + temp.data[3][0];
+		template <typename T>
+		constexpr Mat3x4<T> Mat3x4<T>::Multiply(const Mat3x4<T>& leftMatrix, const Mat3x4<T>& rightMatrix)
+		{
+			Mat3x4<T> result;
 
-			data[0][1] = temp.data[0][1] * matrix.data[0][0] + temp.data[1][1] * matrix.data[0][1] + temp.data[2][1] * matrix.data[0][2];
-			data[1][1] = temp.data[0][1] * matrix.data[1][0] + temp.data[1][1] * matrix.data[1][1] + temp.data[2][1] * matrix.data[1][2];
-			data[2][1] = temp.data[0][1] * matrix.data[2][0] + temp.data[1][1] * matrix.data[2][1] + temp.data[2][1] * matrix.data[2][2];
-			data[3][1] = temp.data[0][1] * matrix.data[3][0] + temp.data[1][1] * matrix.data[3][1] + temp.data[2][1] * matrix.data[3][2] + temp.data[3][1];
+			result.data[0][0] = leftMatrix.data[0][0] * rightMatrix.data[0][0] + leftMatrix.data[1][0] * rightMatrix.data[0][1] + leftMatrix.data[2][0] * rightMatrix.data[0][2];
+			result.data[1][0] = leftMatrix.data[0][0] * rightMatrix.data[1][0] + leftMatrix.data[1][0] * rightMatrix.data[1][1] + leftMatrix.data[2][0] * rightMatrix.data[1][2];
+			result.data[2][0] = leftMatrix.data[0][0] * rightMatrix.data[2][0] + leftMatrix.data[1][0] * rightMatrix.data[2][1] + leftMatrix.data[2][0] * rightMatrix.data[2][2];
+			result.data[3][0] = leftMatrix.data[0][0] * rightMatrix.data[3][0] + leftMatrix.data[1][0] * rightMatrix.data[3][1] + leftMatrix.data[2][0] * rightMatrix.data[3][2] + leftMatrix.data[3][0];
 
-			data[0][2] = temp.data[0][2] * matrix.data[0][0] + temp.data[1][2] * matrix.data[0][1] + temp.data[2][2] * matrix.data[0][2];
-			data[1][2] = temp.data[0][2] * matrix.data[1][0] + temp.data[1][2] * matrix.data[1][1] + temp.data[2][2] * matrix.data[1][2];
-			data[2][2] = temp.data[0][2] * matrix.data[2][0] + temp.data[1][2] * matrix.data[2][1] + temp.data[2][2] * matrix.data[2][2];
-			data[3][2] = temp.data[0][2] * matrix.data[3][0] + temp.data[1][2] * matrix.data[3][1] + temp.data[2][2] * matrix.data[3][2] + temp.data[3][2];
+			result.data[0][1] = leftMatrix.data[0][1] * rightMatrix.data[0][0] + leftMatrix.data[1][1] * rightMatrix.data[0][1] + leftMatrix.data[2][1] * rightMatrix.data[0][2];
+			result.data[1][1] = leftMatrix.data[0][1] * rightMatrix.data[1][0] + leftMatrix.data[1][1] * rightMatrix.data[1][1] + leftMatrix.data[2][1] * rightMatrix.data[1][2];
+			result.data[2][1] = leftMatrix.data[0][1] * rightMatrix.data[2][0] + leftMatrix.data[1][1] * rightMatrix.data[2][1] + leftMatrix.data[2][1] * rightMatrix.data[2][2];
+			result.data[3][1] = leftMatrix.data[0][1] * rightMatrix.data[3][0] + leftMatrix.data[1][1] * rightMatrix.data[3][1] + leftMatrix.data[2][1] * rightMatrix.data[3][2] + leftMatrix.data[3][1];
 
-			return *this;
+			result.data[0][2] = leftMatrix.data[0][2] * rightMatrix.data[0][0] + leftMatrix.data[1][2] * rightMatrix.data[0][1] + leftMatrix.data[2][2] * rightMatrix.data[0][2];
+			result.data[1][2] = leftMatrix.data[0][2] * rightMatrix.data[1][0] + leftMatrix.data[1][2] * rightMatrix.data[1][1] + leftMatrix.data[2][2] * rightMatrix.data[1][2];
+			result.data[2][2] = leftMatrix.data[0][2] * rightMatrix.data[2][0] + leftMatrix.data[1][2] * rightMatrix.data[2][1] + leftMatrix.data[2][2] * rightMatrix.data[2][2];
+			result.data[3][2] = leftMatrix.data[0][2] * rightMatrix.data[3][0] + leftMatrix.data[1][2] * rightMatrix.data[3][1] + leftMatrix.data[2][2] * rightMatrix.data[3][2] + leftMatrix.data[3][2];
+
+			return result;
 		}
 		
 		template <typename T>
-		Mat3x4<T>& Mat3x4<T>::operator*=(const T scalar)
+		constexpr Mat3x4<T>& Mat3x4<T>::operator*=(const T scalar)
 		{
-			columns[0] *= scalar;
-			columns[1] *= scalar;
-			columns[2] *= scalar;
-			columns[3] *= scalar;
+			for (int column = 0; column < 4; column++)
+			{
+				SetColumn(column, GetColumn(column) * scalar);
+			}
 
 			return *this;
 		}
 
 		template <typename T>
-		Mat3x4<T> operator*(const Mat3x4<T>& leftMatrix, const Mat3x4<T>& rightMatrix)
+		constexpr Vec3<T> Mat3x4<T>::MultiplyVector(const Vec3<T>& vector) const
+		{
+			const Mat3x4<T>& matrix = *this;
+
+			return Vec3<T>(matrix(0, 0) * vector.x + matrix(1, 0) * vector.y + matrix(2, 0) * vector.z,
+						   matrix(0, 1) * vector.x + matrix(1, 1) * vector.y + matrix(2, 1) * vector.z,
+						   matrix(0, 2) * vector.x + matrix(1, 2) * vector.y + matrix(2, 2) * vector.z);
+		}
+
+		template <typename T>
+		constexpr Mat3x4<T> operator*(const Mat3x4<T>& leftMatrix, const Mat3x4<T>& rightMatrix)
 		{
 			Mat3x4<T> leftMatrixCopy = leftMatrix;
 			return leftMatrixCopy *= rightMatrix;
 		}
 
 		template <typename T>
-		Mat4<T> operator*(const Mat3x4<T>& leftMatrix, const Mat4<T>& rightMatrix)
+		constexpr Mat4<T> operator*(const Mat3x4<T>& leftMatrix, const Mat4<T>& rightMatrix)
 		{
 			Mat4<T> result;
 
 			result(0, 0) = leftMatrix(0, 0) * rightMatrix(0, 0) + leftMatrix(0, 1) * rightMatrix(1, 0) + leftMatrix(0, 2) * rightMatrix(2, 0) + leftMatrix(0, 3) * rightMatrix(3, 0);
-			result(0, 1) = leftMatrix(0, 0) * rightMatrix(0, 1) + leftMatrix(0, 1) * rightMatrix(1, 1) + leftMatrix(0, 2) * rightMatrix(2, 1) + leftMatrix(0, 3) * rightMatrix(3, 0);
-			result(0, 2) = leftMatrix(0, 0) * rightMatrix(0, 2) + leftMatrix(0, 1) * rightMatrix(1, 2) + leftMatrix(0, 2) * rightMatrix(2, 2) + leftMatrix(0, 3) * rightMatrix(3, 0);
-			result(0, 3) = leftMatrix(0, 0) * rightMatrix(0, 3) + leftMatrix(0, 1) * rightMatrix(1, 3) + leftMatrix(0, 2) * rightMatrix(2, 3) + leftMatrix(0, 3) * rightMatrix(3, 0);
+			result(0, 1) = leftMatrix(0, 0) * rightMatrix(0, 1) + leftMatrix(0, 1) * rightMatrix(1, 1) + leftMatrix(0, 2) * rightMatrix(2, 1) + leftMatrix(0, 3) * rightMatrix(3, 1);
+			result(0, 2) = leftMatrix(0, 0) * rightMatrix(0, 2) + leftMatrix(0, 1) * rightMatrix(1, 2) + leftMatrix(0, 2) * rightMatrix(2, 2) + leftMatrix(0, 3) * rightMatrix(3, 2);
+			result(0, 3) = leftMatrix(0, 0) * rightMatrix(0, 3) + leftMatrix(0, 1) * rightMatrix(1, 3) + leftMatrix(0, 2) * rightMatrix(2, 3) + leftMatrix(0, 3) * rightMatrix(3, 3);
 
 			result(1, 0) = leftMatrix(1, 0) * rightMatrix(0, 0) + leftMatrix(1, 1) * rightMatrix(1, 0) + leftMatrix(1, 2) * rightMatrix(2, 0) + leftMatrix(1, 3) * rightMatrix(3, 0);
-			result(1, 1) = leftMatrix(1, 0) * rightMatrix(0, 1) + leftMatrix(1, 1) * rightMatrix(1, 1) + leftMatrix(1, 2) * rightMatrix(2, 1) + leftMatrix(1, 3) * rightMatrix(3, 0);
-			result(1, 2) = leftMatrix(1, 0) * rightMatrix(0, 2) + leftMatrix(1, 1) * rightMatrix(1, 2) + leftMatrix(1, 2) * rightMatrix(2, 2) + leftMatrix(1, 3) * rightMatrix(3, 0);
-			result(1, 3) = leftMatrix(1, 0) * rightMatrix(0, 3) + leftMatrix(1, 1) * rightMatrix(1, 3) + leftMatrix(1, 2) * rightMatrix(2, 3) + leftMatrix(1, 3) * rightMatrix(3, 0);
+			result(1, 1) = leftMatrix(1, 0) * rightMatrix(0, 1) + leftMatrix(1, 1) * rightMatrix(1, 1) + leftMatrix(1, 2) * rightMatrix(2, 1) + leftMatrix(1, 3) * rightMatrix(3, 1);
+			result(1, 2) = leftMatrix(1, 0) * rightMatrix(0, 2) + leftMatrix(1, 1) * rightMatrix(1, 2) + leftMatrix(1, 2) * rightMatrix(2, 2) + leftMatrix(1, 3) * rightMatrix(3, 2);
+			result(1, 3) = leftMatrix(1, 0) * rightMatrix(0, 3) + leftMatrix(1, 1) * rightMatrix(1, 3) + leftMatrix(1, 2) * rightMatrix(2, 3) + leftMatrix(1, 3) * rightMatrix(3, 3);
 
 			result(2, 0) = leftMatrix(2, 0) * rightMatrix(0, 0) + leftMatrix(2, 1) * rightMatrix(1, 0) + leftMatrix(2, 2) * rightMatrix(2, 0) + leftMatrix(2, 3) * rightMatrix(3, 0);
-			result(2, 1) = leftMatrix(2, 0) * rightMatrix(0, 1) + leftMatrix(2, 1) * rightMatrix(1, 1) + leftMatrix(2, 2) * rightMatrix(2, 1) + leftMatrix(2, 3) * rightMatrix(3, 0);
-			result(2, 2) = leftMatrix(2, 0) * rightMatrix(0, 2) + leftMatrix(2, 1) * rightMatrix(1, 2) + leftMatrix(2, 2) * rightMatrix(2, 2) + leftMatrix(2, 3) * rightMatrix(3, 0);
-			result(2, 3) = leftMatrix(2, 0) * rightMatrix(0, 3) + leftMatrix(2, 1) * rightMatrix(1, 3) + leftMatrix(2, 2) * rightMatrix(2, 3) + leftMatrix(2, 3) * rightMatrix(3, 0);
+			result(2, 1) = leftMatrix(2, 0) * rightMatrix(0, 1) + leftMatrix(2, 1) * rightMatrix(1, 1) + leftMatrix(2, 2) * rightMatrix(2, 1) + leftMatrix(2, 3) * rightMatrix(3, 1);
+			result(2, 2) = leftMatrix(2, 0) * rightMatrix(0, 2) + leftMatrix(2, 1) * rightMatrix(1, 2) + leftMatrix(2, 2) * rightMatrix(2, 2) + leftMatrix(2, 3) * rightMatrix(3, 2);
+			result(2, 3) = leftMatrix(2, 0) * rightMatrix(0, 3) + leftMatrix(2, 1) * rightMatrix(1, 3) + leftMatrix(2, 2) * rightMatrix(2, 3) + leftMatrix(2, 3) * rightMatrix(3, 3);
 
 			result(3, 0) = rightMatrix(3, 0);
 			result(3, 1) = rightMatrix(3, 1);
@@ -459,7 +455,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> operator*(const Mat4<T>& leftMatrix, const Mat3x4<T>& rightMatrix)
+		constexpr Mat4<T> operator*(const Mat4<T>& leftMatrix, const Mat3x4<T>& rightMatrix)
 		{
 			Mat4<T> result;
 
@@ -487,7 +483,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T> operator*(const Mat3x4<T>& matrix, const Vec4<T>& vector)
+		constexpr Vec4<T> operator*(const Mat3x4<T>& matrix, const Vec4<T>& vector)
 		{
 			return Vec4<T>(matrix(0, 0) * vector.x + matrix(1, 0) * vector.y + matrix(2, 0) * vector.z + matrix(3, 0) * vector.w,
 						   matrix(0, 1) * vector.x + matrix(1, 1) * vector.y + matrix(2, 1) * vector.z + matrix(3, 1) * vector.w,
@@ -496,7 +492,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec3<T> operator*(const Mat3x4<T>& matrix, const Vec3<T>& vector)
+		constexpr Vec3<T> operator*(const Mat3x4<T>& matrix, const Vec3<T>& vector)
 		{
 			return Vec3<T>(matrix(0, 0) * vector.x + matrix(1, 0) * vector.y + matrix(2, 0) * vector.z,
 						   matrix(0, 1) * vector.x + matrix(1, 1) * vector.y + matrix(2, 1) * vector.z,
@@ -504,14 +500,14 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3x4<T> operator*(const Mat3x4<T>& matrix, const T scalar)
+		constexpr Mat3x4<T> operator*(const Mat3x4<T>& matrix, const T scalar)
 		{
 			Mat3x4<T> matrixCopy = matrix;
 			return matrixCopy *= scalar;
 		}
 
 		template<typename T>
-		Mat3x4<T> operator*(const T scalar, const Mat3x4<T>& matrix)
+		constexpr Mat3x4<T> operator*(const T scalar, const Mat3x4<T>& matrix)
 		{
 			Mat3x4<T> matrixCopy = matrix;
 			return matrixCopy *= scalar;
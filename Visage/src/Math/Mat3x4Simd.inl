@@ -0,0 +1,113 @@
+#pragma once
+
+#include "MathSimd.h"
+
+#ifdef VISAGE_MATH_SSE
+	namespace Visage
+	{
+		namespace Math
+		{
+			// The twelve floats are read as three registers, or per column with the fourth lane reaching into the
+			// next column. Only the last column is loaded and stored as three floats. In constant expressions the
+			// specializations take the unspecialized code paths.
+
+			template <>
+			constexpr Mat3x4<float>& Mat3x4<float>::operator*=(const Mat3x4<float>& matrix)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Multiply(*this, matrix);
+				}
+
+				__m128 leftColumns[3] = { _mm_loadu_ps(data[0]), _mm_loadu_ps(data[1]), _mm_loadu_ps(data[2]) };
+				__m128 translation = Simd::Load3(data[3]);
+
+				__m128 firstProduct = Simd::LinearCombination3(leftColumns, _mm_loadu_ps(matrix.data[0]));
+				__m128 secondProduct = Simd::LinearCombination3(leftColumns, _mm_loadu_ps(matrix.data[1]));
+				__m128 thirdProduct = Simd::LinearCombination3(leftColumns, _mm_loadu_ps(matrix.data[2]));
+				__m128 fourthProduct = _mm_add_ps(Simd::LinearCombination3(leftColumns, Simd::Load3(matrix.data[3])), translation);
+
+				// In column order, each store overwrites the stray fourth lane of the one before
+				_mm_storeu_ps(data[0], firstProduct);
+				_mm_storeu_ps(data[1], secondProduct);
+				_mm_storeu_ps(data[2], thirdProduct);
+				Simd::Store3(data[3], fourthProduct);
+
+				return *this;
+			}
+
+			template <>
+			constexpr Mat3x4<float>& Mat3x4<float>::operator*=(const float scalar)
+			{
+				if (IsConstantEvaluated())
+				{
+					for (int column = 0; column < 4; column++)
+					{
+						SetColumn(column, GetColumn(column) * scalar);
+					}
+
+					return *this;
+				}
+
+				float* values = data[0];
+				__m128 factor = _mm_set1_ps(scalar);
+
+				_mm_storeu_ps(values, _mm_mul_ps(_mm_loadu_ps(values), factor));
+				_mm_storeu_ps(values + 4, _mm_mul_ps(_mm_loadu_ps(values + 4), factor));
+				_mm_storeu_ps(values + 8, _mm_mul_ps(_mm_loadu_ps(values + 8), factor));
+
+				return *this;
+			}
+
+			template <>
+			constexpr Vec3<float> Mat3x4<float>::MultiplyVector(const Vec3<float>& vector) const
+			{
+				if (IsConstantEvaluated())
+				{
+					return Vec3<float>(Vec3<float>::Dot(GetColumn(0), vector), Vec3<float>::Dot(GetColumn(1), vector), Vec3<float>::Dot(GetColumn(2), vector));
+				}
+
+				// Element i is the dot product of column i with the vector, the rows of the transpose weighted by it
+				__m128 rows[4] = { _mm_loadu_ps(data[0]), _mm_loadu_ps(data[1]), _mm_loadu_ps(data[2]), _mm_setzero_ps() };
+
+				Simd::Transpose4(rows[0], rows[1], rows[2], rows[3]);
+
+				Vec3<float> result;
+				Simd::Store3(&result.x, Simd::LinearCombination3(rows, Simd::Load3(&vector.x)));
+				return result;
+			}
+
+			namespace Simd
+			{
+				// Mat3x4 * Vec3 on lanes of vectors, element i is the dot product of column i with the vector
+				struct Mat3x4Kernel {
+					const float (*columns)[3];
+
+					template <typename L>
+					inline void Transform(typename L::Register& x, typename L::Register& y, typename L::Register& z) const
+					{
+						typename L::Register resultX = WeightedSum<L>(columns[0], x, y, z);
+						typename L::Register resultY = WeightedSum<L>(columns[1], x, y, z);
+						z = WeightedSum<L>(columns[2], x, y, z);
+						x = resultX;
+						y = resultY;
+					}
+				};
+			}
+
+			template <>
+			inline void Mat3x4<float>::TransformVectors(const Mat3x4<float>& matrix, const Vec3<float>* vectors, Vec3<float>* results, const std::size_t count)
+			{
+				Simd::Mat3x4Kernel kernel = { matrix.data };
+				Simd::TransformVec3s(kernel, reinterpret_cast<const float*>(vectors), reinterpret_cast<float*>(results), count);
+			}
+
+			template <>
+			inline void Mat3x4<float>::TransformVectors(const Mat3x4<float>& matrix, const Vec3Arrays<const float>& vectors, const Vec3Arrays<float>& results, const std::size_t count)
+			{
+				Simd::Mat3x4Kernel kernel = { matrix.data };
+				Simd::TransformVec3Arrays(kernel, vectors, results, count);
+			}
+		}
+	}
+#endif
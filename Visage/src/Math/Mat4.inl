@@ -1,6 +1,5 @@
 #pragma once
 
-#include <cstring>
 #include <cmath>
 #include <cstdint>
 #include "MathFunctions.h"
@@ -10,12 +9,13 @@ namespace Visage
 	namespace Math
 	{
 		template <typename T>
-		Mat4<T>::Mat4()
+		constexpr Mat4<T>::Mat4()
 			: data{ 0 } 
 		{ }
 
 		template<typename T>
-		Mat4<T>::Mat4(std::initializer_list<T> args)
+		constexpr Mat4<T>::Mat4(std::initializer_list<T> args)
+			: data{ 0 }
 		{
 			std::uint8_t column = 0, row = 0;
 			for (auto &element : args)
@@ -31,10 +31,11 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T>::Mat4(const T m00, const T m01, const T m02, const T m03,
+		constexpr Mat4<T>::Mat4(const T m00, const T m01, const T m02, const T m03,
 				      const T m10, const T m11, const T m12, const T m13, 
 				      const T m20, const T m21, const T m22, const T m23, 
 				      const T m30, const T m31, const T m32, const T m33)
+			: data{ 0 }
 		{
 			// Column-major ordering
 			data[0][0] = m00;
@@ -59,10 +60,11 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T>::Mat4(const Vec4<T>& firstRow,
+		constexpr Mat4<T>::Mat4(const Vec4<T>& firstRow,
 				      const Vec4<T>& secondRow, 
 				      const Vec4<T>& thirdRow, 
 				      const Vec4<T>& fourthRow)
+			: data{ 0 }
 		{
 			
 			data[0][0] = firstRow.x;
@@ -87,7 +89,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T>::Mat4(const T diagonal)
+		constexpr Mat4<T>::Mat4(const T diagonal)
 			: data{ 0 }
 		{
 			data[0][0] = diagonal;
@@ -97,18 +99,12 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T>::Mat4(const Mat4<T>& matrix)
-		{
-			std::memcpy(data, matrix.data, sizeof(Mat4<T>));
-		}
-
-		template <typename T>
-		Mat4<T> Mat4<T>::Inverted() const
+		constexpr Mat4<T> Mat4<T>::Inverted() const
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
-			const Vec3<T> d = reinterpret_cast<const Vec3<T>&>(data[3]);
+			const Vec3<T> a(data[0][0], data[0][1], data[0][2]);
+			const Vec3<T> b(data[1][0], data[1][1], data[1][2]);
+			const Vec3<T> c(data[2][0], data[2][1], data[2][2]);
+			const Vec3<T> d(data[3][0], data[3][1], data[3][2]);
 
 			T x = data[0][3];
 			T y = data[1][3];
@@ -120,7 +116,7 @@ namespace Visage
 			Vec3<T> u = a * y - b * x;
 			Vec3<T> v = c * w - d * z;
 
-			T inverseDet = static_cast<T>(1) / Vec3<T>::Dot(s, v) - Vec3<T>::Dot(t, u);
+			T inverseDet = static_cast<T>(1) / (Vec3<T>::Dot(s, v) + Vec3<T>::Dot(t, u));
 			s *= inverseDet;
 			t *= inverseDet;
 			u *= inverseDet;
@@ -138,59 +134,13 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T>& Mat4<T>::Invert()
+		constexpr Mat4<T>& Mat4<T>::Invert()
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
-			const Vec3<T> d = reinterpret_cast<const Vec3<T>&>(data[3]);
-
-			T x = data[0][3];
-			T y = data[1][3];
-			T z = data[2][3];
-			T w = data[3][3];
-
-			Vec3<T> s = Vec3<T>::Cross(a, b);
-			Vec3<T> t = Vec3<T>::Cross(c, d);
-			Vec3<T> u = a * y - b * x;
-			Vec3<T> v = c * w - d * z;
-
-			T inverseDet = static_cast<T>(1) / Vec3<T>::Dot(s, v) - Vec3<T>::Dot(t, u);
-			s *= inverseDet;
-			t *= inverseDet;
-			u *= inverseDet;
-			v *= inverseDet;
-
-			Vec3<T> firstRow = Vec3<T>::Cross(b, v) + t * y;
-			Vec3<T> secondRow = Vec3<T>::Cross(v, a) - t * x;
-			Vec3<T> thirdRow = Vec3<T>::Cross(d, u) + s * w;
-			Vec3<T> fourthRow = Vec3<T>::Cross(u, c) - s * z;
-
-			data[0][0] = firstRow.x;
-			data[1][0] = firstRow.y;
-			data[2][0] = firstRow.z;
-			data[3][0] = -Vec3<T>::Dot(b, t);
-
-			data[0][1] = secondRow.x;
-			data[1][1] = secondRow.y;
-			data[2][1] = secondRow.z;
-			data[3][1] = -Vec3<T>::Dot(a, t);
-
-			data[0][2] = thirdRow.x;
-			data[1][2] = thirdRow.y;
-			data[2][2] = thirdRow.z;
-			data[3][2] = -Vec3<T>::Dot(d, s);
-
-			data[0][3] = fourthRow.x;
-			data[1][3] = fourthRow.y;
-			data[2][3] = fourthRow.z;
-			data[3][3] = -Vec3<T>::Dot(c, s);
-
-			return *this;
+			return *this = Inverted();
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::Transposed() const
+		constexpr Mat4<T> Mat4<T>::Transposed() const
 		{
 			return Mat4<T>(data[0][0], data[0][1], data[0][2], data[0][3],
 						   data[1][0], data[1][1], data[1][2], data[1][3],
@@ -199,59 +149,44 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T>& Mat4<T>::Transpose()
+		constexpr Mat4<T>& Mat4<T>::Transpose()
 		{
-			Mat4<T> temp = *this;
-
-			data[0][1] = temp.data[1][0];
-			data[0][2] = temp.data[2][0];
-			data[0][3] = temp.data[3][0];
-
-			data[1][0] = temp.data[0][1];
-			data[1][2] = temp.data[2][1];
-			data[1][3] = temp.data[3][1];
-
-			data[2][0] = temp.data[0][2];
-			data[2][1] = temp.data[1][2];
-			data[2][3] = temp.data[3][2];
-
-			data[3][0] = temp.data[0][3];
-			data[3][1] = temp.data[1][3];
-			data[3][2] = temp.data[2][3];
-
-			return *this;
+			return *this = Transposed();
 		}
 
 		template <typename T>
-		float Mat4<T>::Determinant() const
+		constexpr T Mat4<T>::Determinant() const
 		{
-			const Vec3<T> a = reinterpret_cast<const Vec3<T>&>(data[0]);
-			const Vec3<T> b = reinterpret_cast<const Vec3<T>&>(data[1]);
-			const Vec3<T> c = reinterpret_cast<const Vec3<T>&>(data[2]);
-			const Vec3<T> d = reinterpret_cast<const Vec3<T>&>(data[3]);
+			const Vec3<T> a(data[0][0], data[0][1], data[0][2]);
+			const Vec3<T> b(data[1][0], data[1][1], data[1][2]);
+			const Vec3<T> c(data[2][0], data[2][1], data[2][2]);
+			const Vec3<T> d(data[3][0], data[3][1], data[3][2]);
 
 			Vec3<T> s = Vec3<T>::Cross(a, b);
 			Vec3<T> t = Vec3<T>::Cross(c, d);
 			Vec3<T> u = a * data[1][3] - b * data[0][3];
 			Vec3<T> v = c * data[3][3] - d * data[2][3];
 
-			return Vec3<T>::Dot(s, v) - Vec3<T>::Dot(t, u);
+			return Vec3<T>::Dot(s, v) + Vec3<T>::Dot(t, u);
 		}
 
 		template <typename T>
-		Vec4<T> Mat4<T>::GetColumn(const int columnIndex) const
+		constexpr Vec4<T> Mat4<T>::GetColumn(const int columnIndex) const
 		{
-			return columns[columnIndex];
+			return Vec4<T>(data[columnIndex][0], data[columnIndex][1], data[columnIndex][2], data[columnIndex][3]);
 		}
 
 		template <typename T>
-		void Mat4<T>::SetColumn(const int columnIndex, const Vec4<T>& vector)
+		constexpr void Mat4<T>::SetColumn(const int columnIndex, const Vec4<T>& vector)
 		{
-			columns[columnIndex] = vector;
+			data[columnIndex][0] = vector.x;
+			data[columnIndex][1] = vector.y;
+			data[columnIndex][2] = vector.z;
+			data[columnIndex][3] = vector.w;
 		}
 
 		template <typename T>
-		Vec4<T> Mat4<T>::GetRow(const int rowIndex) const
+		constexpr Vec4<T> Mat4<T>::GetRow(const int rowIndex) const
 		{
 			return Vec4<T>(data[0][rowIndex], 
 						   data[1][rowIndex], 
@@ -260,7 +195,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		void Mat4<T>::SetRow(const int rowIndex, const Vec4<T>& vector)
+		constexpr void Mat4<T>::SetRow(const int rowIndex, const Vec4<T>& vector)
 		{
 			data[0][rowIndex] = vector.x;
 			data[1][rowIndex] = vector.y;
@@ -269,19 +204,21 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec3<T> Mat4<T>::GetTranslation() const
+		constexpr Vec3<T> Mat4<T>::GetTranslation() const
 		{
-			return columns[3];
+			return Vec3<T>(data[3][0], data[3][1], data[3][2]);
 		}
 
 		template <typename T>
-		void Mat4<T>::SetTranslation(const Vec3<T>& translation)
+		constexpr void Mat4<T>::SetTranslation(const Vec3<T>& translation)
 		{
-			columns[3] = translation;
+			data[3][0] = translation.x;
+			data[3][1] = translation.y;
+			data[3][2] = translation.z;
 		}
 
 		template <typename T>
-		Mat3<T> Mat4<T>::AffineMatrix() const
+		constexpr Mat3<T> Mat4<T>::AffineMatrix() const
 		{
 			return Mat3<T>(data[0][0], data[1][0], data[2][0],
 						   data[0][1], data[1][1], data[2][1], 
@@ -289,7 +226,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat3<T> Mat4<T>::NormalMatrix() const
+		constexpr Mat3<T> Mat4<T>::NormalMatrix() const
 		{
 			return AffineMatrix().Inverted().Transposed();
 		}
@@ -355,7 +292,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::MakeScale(const T uniformScale)
+		constexpr Mat4<T> Mat4<T>::MakeScale(const T uniformScale)
 		{
 			return Mat4<T>(uniformScale, 0, 0, 0,
 						   0, uniformScale, 0, 0,
@@ -364,7 +301,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::MakeScale(const T scaleX, const T scaleY, const T scaleZ)
+		constexpr Mat4<T> Mat4<T>::MakeScale(const T scaleX, const T scaleY, const T scaleZ)
 		{
 			return Mat4<T>(scaleX, 0, 0, 0,
 						   0, scaleY, 0, 0,
@@ -373,7 +310,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::MakeScale(const Vec3<T>& vector)
+		constexpr Mat4<T> Mat4<T>::MakeScale(const Vec3<T>& vector)
 		{
 			return Mat4<T>(vector.x, 0, 0, 0,
 						   0, vector.y, 0, 0,
@@ -382,7 +319,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::MakeTranslation(const T uniformTranslation)
+		constexpr Mat4<T> Mat4<T>::MakeTranslation(const T uniformTranslation)
 		{
 			return Mat4<T>(1, 0, 0, uniformTranslation,
 						   0, 1, 0, uniformTranslation,
@@ -391,7 +328,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::MakeTranslation(const T translationX, const T translationY, const T translationZ)
+		constexpr Mat4<T> Mat4<T>::MakeTranslation(const T translationX, const T translationY, const T translationZ)
 		{
 			return Mat4<T>(1, 0, 0, translationX,
 						   0, 1, 0, translationY,
@@ -400,7 +337,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::MakeTranslation(const Vec3<T>& vector)
+		constexpr Mat4<T> Mat4<T>::MakeTranslation(const Vec3<T>& vector)
 		{
 			return Mat4<T>(1, 0, 0, vector.x,
 						   0, 1, 0, vector.y,
@@ -422,7 +359,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::Orthographic(const T left, const T right, const T bottom, const T top, const T near, const T far)
+		constexpr Mat4<T> Mat4<T>::Orthographic(const T left, const T right, const T bottom, const T top, const T near, const T far)
 		{
 			return Mat4<T>(static_cast<T>(2) / (right - left), 0, 0, (left + right) / (left - right),
 						   0, static_cast<T>(2) / (top - bottom), 0, (bottom + top) / (bottom - top),
@@ -443,78 +380,111 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> Mat4<T>::Identity()
+		constexpr Mat4<T> Mat4<T>::Identity()
 		{
 			return Mat4<T>(1);
 		}
 
 		template <typename T>
-		Mat4<T>& Mat4<T>::operator=(const Mat4<T>& matrix)
+		void Mat4<T>::TransformVectors(const Mat4<T>& matrix, const Vec4<T>* vectors, Vec4<T>* results, const std::size_t count)
 		{
-			std::memcpy(data, matrix.data, sizeof(Mat4<T>));
-			return *this;
+			for (std::size_t i = 0; i < count; i++)
+			{
+				results[i] = matrix * vectors[i];
+			}
+		}
+
+		template <typename T>
+		void Mat4<T>::TransformVectors(const Mat4<T>& matrix, const Vec4Arrays<const T>& vectors, const Vec4Arrays<T>& results, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				Vec4<T> result = matrix * Vec4<T>(vectors.x[i], vectors.y[i], vectors.z[i], vectors.w[i]);
+
+				results.x[i] = result.x;
+				results.y[i] = result.y;
+				results.z[i] = result.z;
+				results.w[i] = result.w;
+			}
 		}
 
 		template<typename T>
-		const T& Mat4<T>::operator()(const int rowIndex, const int columnIndex) const
+		constexpr const T& Mat4<T>::operator()(const int rowIndex, const int columnIndex) const
 		{
 			return data[columnIndex][rowIndex];
 		}
 
 		template<typename T>
-		T& Mat4<T>::operator()(const int rowIndex, const int columnIndex)
+		constexpr T& Mat4<T>::operator()(const int rowIndex, const int columnIndex)
 		{
 			return data[columnIndex][rowIndex];
 		}
 
 		template <typename T>
-		Mat4<T>& Mat4<T>::operator*=(const Mat4<T>& matrix)
+		constexpr Mat4<T>& Mat4<T>::operator*=(const Mat4<T>& matrix)
+		{
+			return *this = Multiply(*this, matrix);
+		}
+
+		template <typename T>
+		constexpr Mat4<T> Mat4<T>::Multiply(const Mat4<T>& leftMatrix, const Mat4<T>& rightMatrix)
 		{
-			Mat4<T> temp = *this;
+			Mat4<T> result;
 
-			data[0][0] = temp.data[0][0] * matrix.data[0][0] + temp.data[1][0] * matrix.data[0][1] + temp.data[2][0] * matrix.data[0][2] + temp.data[3][0] * matrix.data[0][3];
-			data[1][0] = temp.data[0][0] * matrix.data[1][0] + temp.data[1][0] * matrix.data[1][1] + temp.data[2][0] * matrix.data[1][2] + temp.data[3][0] * matrix.data[1][3];
-			data[2][0] = temp.data[0][0] * matrix.data[2][0] + temp.data[1][0] * matrix.data[2][1] + temp.data[2][0] * matrix.data[2][2] + temp.data[3][0] * matrix.data[2][3];
-			data[3][0] = temp.data[0][0] * matrix.data[3][0] + temp.data[1][0] * matrix.data[3][1] + temp.data[2][0] * matrix.data[3][2] + temp.data[3][0] * matrix.data[3][3];
+			result.data[0][0] = leftMatrix.data[0][0] * rightMatrix.data[0][0] + leftMatrix.data[1][0] * rightMatrix.data[0][1] + leftMatrix.data[2][0] * rightMatrix.data[0][2] + leftMatrix.data[3][0] * rightMatrix.data[0][3];
+			result.data[1][0] = leftMatrix.data[0][0] * rightMatrix.data[1][0] + leftMatrix.data[1][0] * rightMatrix.data[1][1] + leftMatrix.data[2][0] * rightMatrix.data[1][2] + leftMatrix.data[3][0] * rightMatrix.data[1][3];
+			result.data[2][0] = leftMatrix.data[0][0] * rightMatrix.data[2][0] + leftMatrix.data[1][0] * rightMatrix.data[2][1] + leftMatrix.data[2][0] * rightMatrix.data[2][2] + leftMatrix.data[3][0] * rightMatrix.data[2][3];
+			result.data[3][0] = leftMatrix.data[0][0] * rightMatrix.data[3][0] + leftMatrix.data[1][0] * rightMatrix.data[3][1] + leftMatrix.data[2][0] * rightMatrix.data[3][2] + leftMatrix.data[3][0] * rightMatrix.data[3][3];
 
-			data[0][1] = temp.data[0][1] * matrix.data[0][0] + temp.data[1][1] * matrix.data[0][1] + temp.data[2][1] * matrix.data[0][2] + temp.data[3][1] * matrix.data[0][3];
-			data[1][1] = temp.data[0][1] * matrix.data[1][0] + temp.data[1][1] * matrix.data[1][1] + temp.data[2][1] * matrix.data[1][2] + temp.data[3][1] * matrix.data[1][3];
-			data[2][1] = temp.data[0][1] * matrix.data[2][0] + temp.data[1][1] * matrix.data[2][1] + temp.data[2][1] * matrix.data[2][2] + temp.data[3][1] * matrix.data[2][3];
-			data[3][1] = temp.data[0][1] * matrix.data[3][0] + temp.data[1][1] * matrix.data[3][1] + temp.data[2][1] * matrix.data[3][2] + temp.data[3][1] * matrix.data[3][3];
+			result.data[0][1] = leftMatrix.data[0][1] * rightMatrix.data[0][0] + leftMatrix.data[1][1] * rightMatrix.data[0][1] + leftMatrix.data[2][1] * rightMatrix.data[0][2] + leftMatrix.data[3][1] * rightMatrix.data[0][3];
+			result.data[1][1] = leftMatrix.data[0][1] * rightMatrix.data[1][0] + leftMatrix.data[1][1] * rightMatrix.data[1][1] + leftMatrix.data[2][1] * rightMatrix.data[1][2] + leftMatrix.data[3][1] * rightMatrix.data[1][3];
+			result.data[2][1] = leftMatrix.data[0][1] * rightMatrix.data[2][0] + leftMatrix.data[1][1] * rightMatrix.data[2][1] + leftMatrix.data[2][1] * rightMatrix.data[2][2] + leftMatrix.data[3][1] * rightMatrix.data[2][3];
+			result.data[3][1] = leftMatrix.data[0][1] * rightMatrix.data[3][0] + leftMatrix.data[1][1] * rightMatrix.data[3][1] + leftMatrix.data[2][1] * rightMatrix.data[3][2] + leftMatrix.data[3][1] * rightMatrix.data[3][3];
 
-			data[0][2] = temp.data[0][2] * matrix.data[0][0] + temp.data[1][2] * matrix.data[0][1] + temp.data[2][2] * matrix.data[0][2] + temp.data[3][2] * matrix.data[0][3];
-			data[1][2] = temp.data[0][2] * matrix.data[1][0] + temp.data[1][2] * matrix.data[1][1] + temp.data[2][2] * matrix.data[1][2] + temp.data[3][2] * matrix.data[1][3];
-			data[2][2] = temp.data[0][2] * matrix.data[2][0] + temp.data[1][2] * matrix.data[2][1] + temp.data[2][2] * matrix.data[2][2] + temp.data[3][2] * matrix.data[2][3];
-			data[3][2] = temp.data[0][2] * matrix.data[3][0] + temp.data[1][2] * matrix.data[3][1] + temp.data[2][2] * matrix.data[3][2] + temp.data[3][2] * matrix.data[3][3];
+			result.data[0][2] = leftMatrix.data[0][2] * rightMatrix.data[0][0] + leftMatrix.data[1][2] * rightMatrix.data[0][1] + leftMatrix.data[2][2] * rightMatrix.data[0][2] + leftMatrix.data[3][2] * rightMatrix.data[0][3];
+			result.data[1][2] = leftMatrix.data[0][2] * rightMatrix.data[1][0] + leftMatrix.data[1][2] * rightMatrix.data[1][1] + leftMatrix.data[2][2] * rightMatrix.data[1][2] + leftMatrix.data[3][2] * rightMatrix.data[1][3];
+			result.data[2][2] = leftMatrix.data[0][2] * rightMatrix.data[2][0] + leftMatrix.data[1][2] * rightMatrix.data[2][1] + leftMatrix.data[2][2] * rightMatrix.data[2][2] + leftMatrix.data[3][2] * rightMatrix.data[2][3];
+			result.data[3][2] = leftMatrix.data[0][2] * rightMatrix.data[3][0] + leftMatrix.data[1][2] * rightMatrix.data[3][1] + leftMatrix.data[2][2] * rightMatrix.data[3][2] + leftMatrix.data[3][2] * rightMatrix.data[3][3];
 
-			data[0][3] = temp.data[0][3] * matrix.data[0][0] + temp.data[1][3] * matrix.data[0][1] + temp.data[2][3] * matrix.data[0][2] + temp.data[3][3] * matrix.data[0][3];
-			data[1][3] = temp.data[0][3] * matrix.data[1][0] + temp.data[1][3] * matrix.data[1][1] + temp.data[2][3] * matrix.data[1][2] + temp.data[3][3] * matrix.data[1][3];
-			data[2][3] = temp.data[0][3] * matrix.data[2][0] + temp.data[1][3] * matrix.data[2][1] + temp.data[2][3] * matrix.data[2][2] + temp.data[3][3] * matrix.data[2][3];
-			data[3][3] = temp.data[0][3] * matrix.data[3][0] + temp.data[1][3] * matrix.data[3][1] + temp.data[2][3] * matrix.data[3][2] + temp.data[3][3] * matrix.data[3][3];
+			result.data[0][3] = leftMatrix.data[0][3] * rightMatrix.data[0][0] + leftMatrix.data[1][3] * rightMatrix.data[0][1] + leftMatrix.data[2][3] * rightMatrix.data[0][2] + leftMatrix.data[3][3] * rightMatrix.data[0][3];
+			result.data[1][3] = leftMatrix.data[0][3] * rightMatrix.data[1][0] + leftMatrix.data[1][3] * rightMatrix.data[1][1] + leftMatrix.data[2][3] * rightMatrix.data[1][2] + leftMatrix.data[3][3] * rightMatrix.data[1][3];
+			result.data[2][3] = leftMatrix.data[0][3] * rightMatrix.data[2][0] + leftMatrix.data[1][3] * rightMatrix.data[2][1] + leftMatrix.data[2][3] * rightMatrix.data[2][2] + leftMatrix.data[3][3] * rightMatrix.data[2][3];
+			result.data[3][3] = leftMatrix.data[0][3] * rightMatrix.data[3][0] + leftMatrix.data[1][3] * rightMatrix.data[3][1] + leftMatrix.data[2][3] * rightMatrix.data[3][2] + leftMatrix.data[3][3] * rightMatrix.data[3][3];
 
-			return *this;
+			return result;
 		}
 
 		template <typename T>
-		Mat4<T>& Mat4<T>::operator*=(const T scalar)
+		constexpr Mat4<T>& Mat4<T>::operator*=(const T scalar)
 		{
-			columns[0] *= scalar;
-			columns[1] *= scalar;
-			columns[2] *= scalar;
-			columns[3] *= scalar;
+			for (int column = 0; column < 4; column++)
+			{
+				SetColumn(column, GetColumn(column) * scalar);
+			}
 
 			return *this;
 		}
 
 		template <typename T>
-		Mat4<T> operator*(const Mat4<T>& leftMatrix, const Mat4<T>& rightMatrix)
+		constexpr Vec4<T> Mat4<T>::MultiplyVector(const Vec4<T>& vector) const
+		{
+			const Mat4<T>& matrix = *this;
+
+			return Vec4<T>(matrix(0, 0) * vector.x + matrix(1, 0) * vector.y + matrix(2, 0) * vector.z + matrix(3, 0) * vector.w,
+						   matrix(0, 1) * vector.x + matrix(1, 1) * vector.y + matrix(2, 1) * vector.z + matrix(3, 1) * vector.w,
+						   matrix(0, 2) * vector.x + matrix(1, 2) * vector.y + matrix(2, 2) * vector.z + matrix(3, 2) * vector.w,
+						   matrix(0, 3) * vector.x + matrix(1, 3) * vector.y + matrix(2, 3) * vector.z + matrix(3, 3) * vector.w);
+		}
+
+		template <typename T>
+		constexpr Mat4<T> operator*(const Mat4<T>& leftMatrix, const Mat4<T>& rightMatrix)
 		{
 			Mat4<T> leftMatrixCopy = leftMatrix;
 			return leftMatrixCopy *= rightMatrix;
 		}
 
 		template <typename T>
-		Vec4<T> operator*(const Mat4<T>& matrix, const Vec4<T>& vector)
+		constexpr Vec4<T> operator*(const Mat4<T>& matrix, const Vec4<T>& vector)
 		{
 			return Vec4<T>(matrix(0, 0) * vector.x + matrix(1, 0) * vector.y + matrix(2, 0) * vector.z + matrix(3, 0) * vector.w,
 						   matrix(0, 1) * vector.x + matrix(1, 1) * vector.y + matrix(2, 1) * vector.z + matrix(3, 1) * vector.w,
@@ -523,14 +493,14 @@ namespace Visage
 		}
 
 		template <typename T>
-		Mat4<T> operator*(const Mat4<T>& matrix, const T scalar)
+		constexpr Mat4<T> operator*(const Mat4<T>& matrix, const T scalar)
 		{
 			Mat4<T> matrixCopy = matrix;
 			return matrixCopy *= scalar;
 		}
 
 		template<typename T>
-		Mat4<T> operator*(const T scalar, const Mat4<T>& matrix)
+		constexpr Mat4<T> operator*(const T scalar, const Mat4<T>& matrix)
 		{
 			Mat4<T> matrixCopy = matrix;
 			return matrixCopy *= scalar;
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "MathSimd.h"
+
+#ifdef VISAGE_MATH_SSE
+	namespace Visage
+	{
+		namespace Math
+		{
+			// The specializations of constexpr members take the unspecialized code paths in constant expressions
+
+			template <>
+			constexpr Mat4<float> Mat4<float>::Transposed() const
+			{
+				if (IsConstantEvaluated())
+				{
+					// The row constructor, given the columns
+					return Mat4<float>(GetColumn(0), GetColumn(1), GetColumn(2), GetColumn(3));
+				}
+
+				__m128 firstColumn = _mm_loadu_ps(data[0]);
+				__m128 secondColumn = _mm_loadu_ps(data[1]);
+				__m128 thirdColumn = _mm_loadu_ps(data[2]);
+				__m128 fourthColumn = _mm_loadu_ps(data[3]);
+
+				Simd::Transpose4(firstColumn, secondColumn, thirdColumn, fourthColumn);
+
+				Mat4<float> result;
+				_mm_storeu_ps(result.data[0], firstColumn);
+				_mm_storeu_ps(result.data[1], secondColumn);
+				_mm_storeu_ps(result.data[2], thirdColumn);
+				_mm_storeu_ps(result.data[3], fourthColumn);
+
+				return result;
+			}
+
+			template <>
+			constexpr Mat4<float>& Mat4<float>::operator*=(const Mat4<float>& matrix)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Multiply(*this, matrix);
+				}
+
+				// Column j of the product is the columns of this matrix weighted by column j of the other one. Every
+				// column is read before the first store since the other matrix may be this one.
+				#ifdef VISAGE_MATH_AVX
+					// Two columns of the product per register, the columns of this matrix repeated in both halves
+					__m256 firstColumn = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(data[0]));
+					__m256 secondColumn = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(data[1]));
+					__m256 thirdColumn = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(data[2]));
+					__m256 fourthColumn = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(data[3]));
+
+					__m256 weights[2] = { _mm256_loadu_ps(matrix.data[0]), _mm256_loadu_ps(matrix.data[2]) };
+					__m256 products[2] = { _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+					for (int i = 0; i < 2; i++)
+					{
+						#ifdef VISAGE_MATH_FMA
+							products[i] = _mm256_mul_ps(firstColumn, _mm256_permute_ps(weights[i], 0x00));
+							products[i] = _mm256_fmadd_ps(secondColumn, _mm256_permute_ps(weights[i], 0x55), products[i]);
+							products[i] = _mm256_fmadd_ps(thirdColumn, _mm256_permute_ps(weights[i], 0xAA), products[i]);
+							products[i] = _mm256_fmadd_ps(fourthColumn, _mm256_permute_ps(weights[i], 0xFF), products[i]);
+						#else
+							products[i] = _mm256_add_ps(_mm256_mul_ps(firstColumn, _mm256_permute_ps(weights[i], 0x00)),
+														_mm256_mul_ps(secondColumn, _mm256_permute_ps(weights[i], 0x55)));
+							products[i] = _mm256_add_ps(products[i], _mm256_add_ps(_mm256_mul_ps(thirdColumn, _mm256_permute_ps(weights[i], 0xAA)),
+																				   _mm256_mul_ps(fourthColumn, _mm256_permute_ps(weights[i], 0xFF))));
+						#endif
+					}
+
+					_mm256_storeu_ps(data[0], products[0]);
+					_mm256_storeu_ps(data[2], products[1]);
+				#else
+					__m128 leftColumns[4] = { _mm_loadu_ps(data[0]), _mm_loadu_ps(data[1]), _mm_loadu_ps(data[2]), _mm_loadu_ps(data[3]) };
+
+					__m128 firstProduct = Simd::LinearCombination(leftColumns, _mm_loadu_ps(matrix.data[0]));
+					__m128 secondProduct = Simd::LinearCombination(leftColumns, _mm_loadu_ps(matrix.data[1]));
+					__m128 thirdProduct = Simd::LinearCombination(leftColumns, _mm_loadu_ps(matrix.data[2]));
+					__m128 fourthProduct = Simd::LinearCombination(leftColumns, _mm_loadu_ps(matrix.data[3]));
+
+					_mm_storeu_ps(data[0], firstProduct);
+					_mm_storeu_ps(data[1], secondProduct);
+					_mm_storeu_ps(data[2], thirdProduct);
+					_mm_storeu_ps(data[3], fourthProduct);
+				#endif
+
+				return *this;
+			}
+
+			template <>
+			constexpr Mat4<float>& Mat4<float>::operator*=(const float scalar)
+			{
+				if (IsConstantEvaluated())
+				{
+					for (int column = 0; column < 4; column++)
+					{
+						SetColumn(column, GetColumn(column) * scalar);
+					}
+
+					return *this;
+				}
+
+				#ifdef VISAGE_MATH_AVX
+					__m256 factor = _mm256_set1_ps(scalar);
+					_mm256_storeu_ps(data[0], _mm256_mul_ps(_mm256_loadu_ps(data[0]), factor));
+					_mm256_storeu_ps(data[2], _mm256_mul_ps(_mm256_loadu_ps(data[2]), factor));
+				#else
+					__m128 factor = _mm_set1_ps(scalar);
+					_mm_storeu_ps(data[0], _mm_mul_ps(_mm_loadu_ps(data[0]), factor));
+					_mm_storeu_ps(data[1], _mm_mul_ps(_mm_loadu_ps(data[1]), factor));
+					_mm_storeu_ps(data[2], _mm_mul_ps(_mm_loadu_ps(data[2]), factor));
+					_mm_storeu_ps(data[3], _mm_mul_ps(_mm_loadu_ps(data[3]), factor));
+				#endif
+
+				return *this;
+			}
+
+			template <>
+			constexpr Vec4<float> Mat4<float>::MultiplyVector(const Vec4<float>& vector) const
+			{
+				if (IsConstantEvaluated())
+				{
+					return Vec4<float>(Vec4<float>::Dot(GetColumn(0), vector), Vec4<float>::Dot(GetColumn(1), vector),
+									   Vec4<float>::Dot(GetColumn(2), vector), Vec4<float>::Dot(GetColumn(3), vector));
+				}
+
+				// Element i is the dot product of column i with the vector, the rows of the transpose weighted by it
+				__m128 rows[4] = { _mm_loadu_ps(data[0]), _mm_loadu_ps(data[1]), _mm_loadu_ps(data[2]), _mm_loadu_ps(data[3]) };
+
+				Simd::Transpose4(rows[0], rows[1], rows[2], rows[3]);
+
+				Vec4<float> result;
+				_mm_storeu_ps(result.data.data(), Simd::LinearCombination(rows, _mm_loadu_ps(vector.data.data())));
+				return result;
+			}
+
+			namespace Simd
+			{
+				// Mat4 * Vec4 on lanes of vectors, element i is the dot product of column i with the vector
+				struct Mat4Kernel {
+					const float (*columns)[4];
+
+					template <typename L>
+					inline void Transform(typename L::Register& x, typename L::Register& y, typename L::Register& z, typename L::Register& w) const
+					{
+						typename L::Register resultX = WeightedSum<L>(columns[0], x, y, z, w);
+						typename L::Register resultY = WeightedSum<L>(columns[1], x, y, z, w);
+						typename L::Register resultZ = WeightedSum<L>(columns[2], x, y, z, w);
+						w = WeightedSum<L>(columns[3], x, y, z, w);
+						x = resultX;
+						y = resultY;
+						z = resultZ;
+					}
+				};
+			}
+
+			template <>
+			inline void Mat4<float>::TransformVectors(const Mat4<float>& matrix, const Vec4<float>* vectors, Vec4<float>* results, const std::size_t count)
+			{
+				Simd::Mat4Kernel kernel = { matrix.data };
+				Simd::TransformVec4s(kernel, reinterpret_cast<const float*>(vectors), reinterpret_cast<float*>(results), count);
+			}
+
+			template <>
+			inline void Mat4<float>::TransformVectors(const Mat4<float>& matrix, const Vec4Arrays<const float>& vectors, const Vec4Arrays<float>& results, const std::size_t count)
+			{
+				Simd::Mat4Kernel kernel = { matrix.data };
+				Simd::TransformVec4Arrays(kernel, vectors, results, count);
+			}
+		}
+	}
+#endif
@@ -6,10 +6,10 @@ namespace Visage
 {
 	namespace Math
 	{
-		const float maxEpsilonDiff = 1.0e-5f;
+		constexpr float maxEpsilonDiff = 1.0e-5f;
 
-		const float F_PI = (float)M_PI;
+		constexpr float F_PI = static_cast<float>(M_PI);
 
-		const float dotThreshhold = 0.9995f;
+		constexpr float dotThreshhold = 0.9995f;
 	}
 }
\ No newline at end of file
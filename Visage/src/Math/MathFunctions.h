@@ -2,16 +2,36 @@
 
 #include <cstdint>
 #include <cstring>
+#include <type_traits>
 #include "MathConstants.h"
 
 namespace Visage
 {
 	namespace Math
 	{
+		// True while a constant expression is being evaluated, the SIMD specializations take their scalar path then.
+		// Without the builtin it is always false and those specializations only run at runtime.
+		constexpr bool IsConstantEvaluated()
+		{
+			#if defined(__cpp_lib_is_constant_evaluated)
+				return std::is_constant_evaluated();
+			#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+				return __builtin_is_constant_evaluated();
+			#elif defined(__has_builtin)
+				#if __has_builtin(__builtin_is_constant_evaluated)
+					return __builtin_is_constant_evaluated();
+				#else
+					return false;
+				#endif
+			#else
+				return false;
+			#endif
+		}
+
 		template <typename T>
-		inline bool NearEquals(const T floatOne, const T floatTwo)
+		constexpr bool NearEquals(const T floatOne, const T floatTwo)
 		{
-			T absDiff = std::abs(floatOne - floatTwo);
+			T absDiff = floatOne > floatTwo ? floatOne - floatTwo : floatTwo - floatOne;
 			if (absDiff <= maxEpsilonDiff)
 			{
 				return true;
@@ -21,19 +41,19 @@ namespace Visage
 		}
 
 		template <typename T>
-		inline T DegreesToRad(const T angleInDegrees)
+		constexpr T DegreesToRad(const T angleInDegrees)
 		{
 			return angleInDegrees * static_cast<T>(F_PI / 180.0f);
 		}
 
 		template <typename T>
-		inline T RadToDegrees(const T angleInDegrees)
+		constexpr T RadToDegrees(const T angleInDegrees)
 		{
 			return angleInDegrees * static_cast<T>(180.0f / F_PI);
 		}
 
 		template <typename T>
-		inline T FastInverseSqurRootAroundOne(const T value)
+		constexpr T FastInverseSqurRootAroundOne(const T value)
 		{
 			constexpr T coeffOne = static_cast<T>(15.0f / 8.0f);
 			constexpr T coeffTwo = static_cast<T>(-5.0f / 4.0f);
@@ -0,0 +1,527 @@
+#pragma once
+
+// The float types get SSE4.1 specializations when the compiler targets SSE4.1 or AVX, or when VISAGE_MATH_SSE
+// is defined for compilers that do not report SSE4.1 (MSVC). AVX and FMA are used on top when they are enabled
+// too. Defining VISAGE_MATH_SCALAR keeps every type on the scalar templates. Every translation unit has to be
+// built with the same instruction sets, the specializations are inline.
+#ifdef VISAGE_MATH_SCALAR
+	#undef VISAGE_MATH_SSE
+#elif defined(__SSE4_1__) || defined(__AVX__)
+	#ifndef VISAGE_MATH_SSE
+		#define VISAGE_MATH_SSE
+	#endif
+#endif
+
+#ifdef VISAGE_MATH_SSE
+	#if defined(__AVX__) && !defined(VISAGE_MATH_AVX)
+		#define VISAGE_MATH_AVX
+	#endif
+
+	// MSVC enables FMA with /arch:AVX2 but has no macro for it
+	#if (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))) && !defined(VISAGE_MATH_FMA)
+		#define VISAGE_MATH_FMA
+	#endif
+
+	#include <cstddef>
+	#include <immintrin.h>
+	#include "VectorArrays.h"
+
+	namespace Visage
+	{
+		namespace Math
+		{
+			namespace Simd
+			{
+				// first * second + addend
+				inline __m128 MultiplyAdd(const __m128 first, const __m128 second, const __m128 addend)
+				{
+					#ifdef VISAGE_MATH_FMA
+						return _mm_fmadd_ps(first, second, addend);
+					#else
+						return _mm_add_ps(_mm_mul_ps(first, second), addend);
+					#endif
+				}
+
+				template <int Index>
+				inline __m128 Splat(const __m128 vector)
+				{
+					return _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(Index, Index, Index, Index));
+				}
+
+				// Loads three floats without reading past them, the fourth lane is zero. The first two go through the
+				// 64 bit integer load, whose pointer type may alias the floats. Reading them as a double with
+				// _mm_load_sd breaks strict aliasing and GCC reorders it with stores to the floats.
+				inline __m128 Load3(const float* values)
+				{
+					__m128 xy = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+					return _mm_insert_ps(xy, _mm_load_ss(values + 2), 0x20);
+				}
+
+				inline void Store3(float* values, const __m128 vector)
+				{
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_castps_si128(vector));
+					_mm_store_ss(values + 2, _mm_movehl_ps(vector, vector));
+				}
+
+				// columns[0] * weights.x + columns[1] * weights.y + columns[2] * weights.z + columns[3] * weights.w
+				inline __m128 LinearCombination(const __m128 columns[4], const __m128 weights)
+				{
+					__m128 result = _mm_mul_ps(columns[0], Splat<0>(weights));
+					result = MultiplyAdd(columns[1], Splat<1>(weights), result);
+					result = MultiplyAdd(columns[2], Splat<2>(weights), result);
+					return MultiplyAdd(columns[3], Splat<3>(weights), result);
+				}
+
+				// Same as LinearCombination without the fourth column
+				inline __m128 LinearCombination3(const __m128 columns[3], const __m128 weights)
+				{
+					__m128 result = _mm_mul_ps(columns[0], Splat<0>(weights));
+					result = MultiplyAdd(columns[1], Splat<1>(weights), result);
+					return MultiplyAdd(columns[2], Splat<2>(weights), result);
+				}
+
+				// _MM_TRANSPOSE4_PS behind a function, the macro declares uninitialized temporaries on some compilers
+				// which constexpr functions may not contain
+				inline void Transpose4(__m128& first, __m128& second, __m128& third, __m128& fourth)
+				{
+					_MM_TRANSPOSE4_PS(first, second, third, fourth);
+				}
+
+				// Batch kernels are written once against Lanes<Width>, whose Register holds one component of Width
+				// vectors. They run on the widest register first and on __m128 and float for the vectors left over.
+				template <std::size_t Width>
+				struct Lanes;
+
+				template <>
+				struct Lanes<1>
+				{
+					typedef float Register;
+
+					static const std::size_t width = 1;
+
+					static inline float Broadcast(const float value)
+					{
+						return value;
+					}
+
+					static inline float Add(const float first, const float second)
+					{
+						return first + second;
+					}
+
+					static inline float Subtract(const float first, const float second)
+					{
+						return first - second;
+					}
+
+					static inline float Multiply(const float first, const float second)
+					{
+						return first * second;
+					}
+
+					static inline float MultiplyAdd(const float first, const float second, const float addend)
+					{
+						return first * second + addend;
+					}
+
+					static inline float Load(const float* values)
+					{
+						return *values;
+					}
+
+					static inline void Store(float* values, const float value)
+					{
+						*values = value;
+					}
+
+					static inline void LoadVec3s(const float* vectors, float& x, float& y, float& z)
+					{
+						x = vectors[0];
+						y = vectors[1];
+						z = vectors[2];
+					}
+
+					static inline void StoreVec3s(float* vectors, const float x, const float y, const float z)
+					{
+						vectors[0] = x;
+						vectors[1] = y;
+						vectors[2] = z;
+					}
+
+					static inline void LoadVec4s(const float* vectors, float& x, float& y, float& z, float& w)
+					{
+						x = vectors[0];
+						y = vectors[1];
+						z = vectors[2];
+						w = vectors[3];
+					}
+
+					static inline void StoreVec4s(float* vectors, const float x, const float y, const float z, const float w)
+					{
+						vectors[0] = x;
+						vectors[1] = y;
+						vectors[2] = z;
+						vectors[3] = w;
+					}
+				};
+
+				template <>
+				struct Lanes<4>
+				{
+					typedef __m128 Register;
+
+					static const std::size_t width = 4;
+
+					static inline __m128 Broadcast(const float value)
+					{
+						return _mm_set1_ps(value);
+					}
+
+					static inline __m128 Add(const __m128 first, const __m128 second)
+					{
+						return _mm_add_ps(first, second);
+					}
+
+					static inline __m128 Subtract(const __m128 first, const __m128 second)
+					{
+						return _mm_sub_ps(first, second);
+					}
+
+					static inline __m128 Multiply(const __m128 first, const __m128 second)
+					{
+						return _mm_mul_ps(first, second);
+					}
+
+					static inline __m128 MultiplyAdd(const __m128 first, const __m128 second, const __m128 addend)
+					{
+						return Simd::MultiplyAdd(first, second, addend);
+					}
+
+					static inline __m128 Load(const float* values)
+					{
+						return _mm_loadu_ps(values);
+					}
+
+					static inline void Store(float* values, const __m128 value)
+					{
+						_mm_storeu_ps(values, value);
+					}
+
+					// The twelve floats of four vectors are x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3. Each component is
+					// blended out of the three registers and put in order by one shuffle, storing undoes both.
+					static inline void LoadVec3s(const float* vectors, __m128& x, __m128& y, __m128& z)
+					{
+						__m128 first = _mm_loadu_ps(vectors);
+						__m128 second = _mm_loadu_ps(vectors + 4);
+						__m128 third = _mm_loadu_ps(vectors + 8);
+
+						x = _mm_blend_ps(_mm_blend_ps(first, second, 0x4), third, 0x2);
+						y = _mm_blend_ps(_mm_blend_ps(first, second, 0x9), third, 0x4);
+						z = _mm_blend_ps(_mm_blend_ps(first, second, 0x2), third, 0x9);
+
+						x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+						y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+						z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+					}
+
+					static inline void StoreVec3s(float* vectors, __m128 x, __m128 y, __m128 z)
+					{
+						x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+						y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+						z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+
+						_mm_storeu_ps(vectors, _mm_blend_ps(_mm_blend_ps(x, y, 0x2), z, 0x4));
+						_mm_storeu_ps(vectors + 4, _mm_blend_ps(_mm_blend_ps(x, y, 0x9), z, 0x2));
+						_mm_storeu_ps(vectors + 8, _mm_blend_ps(_mm_blend_ps(x, y, 0x4), z, 0x9));
+					}
+
+					static inline void LoadVec4s(const float* vectors, __m128& x, __m128& y, __m128& z, __m128& w)
+					{
+						x = _mm_loadu_ps(vectors);
+						y = _mm_loadu_ps(vectors + 4);
+						z = _mm_loadu_ps(vectors + 8);
+						w = _mm_loadu_ps(vectors + 12);
+
+						_MM_TRANSPOSE4_PS(x, y, z, w);
+					}
+
+					static inline void StoreVec4s(float* vectors, __m128 x, __m128 y, __m128 z, __m128 w)
+					{
+						_MM_TRANSPOSE4_PS(x, y, z, w);
+
+						_mm_storeu_ps(vectors, x);
+						_mm_storeu_ps(vectors + 4, y);
+						_mm_storeu_ps(vectors + 8, z);
+						_mm_storeu_ps(vectors + 12, w);
+					}
+				};
+
+				#ifdef VISAGE_MATH_AVX
+					// Transposes the 4x4 blocks in the low and in the high halves of the registers
+					inline void Transpose4(__m256& first, __m256& second, __m256& third, __m256& fourth)
+					{
+						__m256 firstLow = _mm256_unpacklo_ps(first, second);
+						__m256 secondLow = _mm256_unpacklo_ps(third, fourth);
+						__m256 firstHigh = _mm256_unpackhi_ps(first, second);
+						__m256 secondHigh = _mm256_unpackhi_ps(third, fourth);
+
+						first = _mm256_shuffle_ps(firstLow, secondLow, _MM_SHUFFLE(1, 0, 1, 0));
+						second = _mm256_shuffle_ps(firstLow, secondLow, _MM_SHUFFLE(3, 2, 3, 2));
+						third = _mm256_shuffle_ps(firstHigh, secondHigh, _MM_SHUFFLE(1, 0, 1, 0));
+						fourth = _mm256_shuffle_ps(firstHigh, secondHigh, _MM_SHUFFLE(3, 2, 3, 2));
+					}
+
+					inline __m256 LoadHalves(const float* low, const float* high)
+					{
+						return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+					}
+
+					inline void StoreHalves(float* low, float* high, const __m256 value)
+					{
+						_mm_storeu_ps(low, _mm256_castps256_ps128(value));
+						_mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+					}
+
+					// The first four vectors go to the low halves and the next four to the high halves, so the shuffles
+					// of Lanes<4> work on both halves at once
+					template <>
+					struct Lanes<8>
+					{
+						typedef __m256 Register;
+
+						static const std::size_t width = 8;
+
+						static inline __m256 Broadcast(const float value)
+						{
+							return _mm256_set1_ps(value);
+						}
+
+						static inline __m256 Add(const __m256 first, const __m256 second)
+						{
+							return _mm256_add_ps(first, second);
+						}
+
+						static inline __m256 Subtract(const __m256 first, const __m256 second)
+						{
+							return _mm256_sub_ps(first, second);
+						}
+
+						static inline __m256 Multiply(const __m256 first, const __m256 second)
+						{
+							return _mm256_mul_ps(first, second);
+						}
+
+						static inline __m256 MultiplyAdd(const __m256 first, const __m256 second, const __m256 addend)
+						{
+							#ifdef VISAGE_MATH_FMA
+								return _mm256_fmadd_ps(first, second, addend);
+							#else
+								return _mm256_add_ps(_mm256_mul_ps(first, second), addend);
+							#endif
+						}
+
+						static inline __m256 Load(const float* values)
+						{
+							return _mm256_loadu_ps(values);
+						}
+
+						static inline void Store(float* values, const __m256 value)
+						{
+							_mm256_storeu_ps(values, value);
+						}
+
+						static inline void LoadVec3s(const float* vectors, __m256& x, __m256& y, __m256& z)
+						{
+							__m256 first = LoadHalves(vectors, vectors + 12);
+							__m256 second = LoadHalves(vectors + 4, vectors + 16);
+							__m256 third = LoadHalves(vectors + 8, vectors + 20);
+
+							x = _mm256_blend_ps(_mm256_blend_ps(first, second, 0x44), third, 0x22);
+							y = _mm256_blend_ps(_mm256_blend_ps(first, second, 0x99), third, 0x44);
+							z = _mm256_blend_ps(_mm256_blend_ps(first, second, 0x22), third, 0x99);
+
+							x = _mm256_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+							y = _mm256_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+							z = _mm256_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+						}
+
+						static inline void StoreVec3s(float* vectors, __m256 x, __m256 y, __m256 z)
+						{
+							x = _mm256_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+							y = _mm256_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+							z = _mm256_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+
+							StoreHalves(vectors, vectors + 12, _mm256_blend_ps(_mm256_blend_ps(x, y, 0x22), z, 0x44));
+							StoreHalves(vectors + 4, vectors + 16, _mm256_blend_ps(_mm256_blend_ps(x, y, 0x99), z, 0x22));
+							StoreHalves(vectors + 8, vectors + 20, _mm256_blend_ps(_mm256_blend_ps(x, y, 0x44), z, 0x99));
+						}
+
+						static inline void LoadVec4s(const float* vectors, __m256& x, __m256& y, __m256& z, __m256& w)
+						{
+							x = LoadHalves(vectors, vectors + 16);
+							y = LoadHalves(vectors + 4, vectors + 20);
+							z = LoadHalves(vectors + 8, vectors + 24);
+							w = LoadHalves(vectors + 12, vectors + 28);
+
+							Transpose4(x, y, z, w);
+						}
+
+						static inline void StoreVec4s(float* vectors, __m256 x, __m256 y, __m256 z, __m256 w)
+						{
+							Transpose4(x, y, z, w);
+
+							StoreHalves(vectors, vectors + 16, x);
+							StoreHalves(vectors + 4, vectors + 20, y);
+							StoreHalves(vectors + 8, vectors + 24, z);
+							StoreHalves(vectors + 12, vectors + 28, w);
+						}
+					};
+				#endif
+
+				// weights[0] * x + weights[1] * y + weights[2] * z, with the weights broadcast to every lane
+				template <typename L, typename Register>
+				inline Register WeightedSum(const float weights[3], const Register x, const Register y, const Register z)
+				{
+					Register result = L::Multiply(L::Broadcast(weights[0]), x);
+					result = L::MultiplyAdd(L::Broadcast(weights[1]), y, result);
+					return L::MultiplyAdd(L::Broadcast(weights[2]), z, result);
+				}
+
+				template <typename L, typename Register>
+				inline Register WeightedSum(const float weights[4], const Register x, const Register y, const Register z, const Register w)
+				{
+					return L::MultiplyAdd(L::Broadcast(weights[3]), w, WeightedSum<L>(weights, x, y, z));
+				}
+
+				// The drivers below call kernel.Transform<Lanes<Width>>(x, y, z), or with w, on Width vectors at a
+				// time, starting at index, and return the index of the first vector they left. The results may be the
+				// vectors themselves, every block is loaded before it is stored.
+
+				template <std::size_t Width, typename Kernel>
+				inline std::size_t TransformVec3Lanes(const Kernel& kernel, const float* vectors, float* results, std::size_t index, const std::size_t count)
+				{
+					typedef Lanes<Width> L;
+
+					for (; index + Width <= count; index += Width)
+					{
+						typename L::Register x, y, z;
+						L::LoadVec3s(vectors + index * 3, x, y, z);
+						kernel.template Transform<L>(x, y, z);
+						L::StoreVec3s(results + index * 3, x, y, z);
+					}
+
+					return index;
+				}
+
+				template <std::size_t Width, typename Kernel>
+				inline std::size_t TransformVec4Lanes(const Kernel& kernel, const float* vectors, float* results, std::size_t index, const std::size_t count)
+				{
+					typedef Lanes<Width> L;
+
+					for (; index + Width <= count; index += Width)
+					{
+						typename L::Register x, y, z, w;
+						L::LoadVec4s(vectors + index * 4, x, y, z, w);
+						kernel.template Transform<L>(x, y, z, w);
+						L::StoreVec4s(results + index * 4, x, y, z, w);
+					}
+
+					return index;
+				}
+
+				template <std::size_t Width, typename Kernel>
+				inline std::size_t TransformVec3ArrayLanes(const Kernel& kernel, const Vec3Arrays<const float>& vectors, const Vec3Arrays<float>& results, std::size_t index, const std::size_t count)
+				{
+					typedef Lanes<Width> L;
+
+					for (; index + Width <= count; index += Width)
+					{
+						typename L::Register x = L::Load(vectors.x + index);
+						typename L::Register y = L::Load(vectors.y + index);
+						typename L::Register z = L::Load(vectors.z + index);
+						kernel.template Transform<L>(x, y, z);
+						L::Store(results.x + index, x);
+						L::Store(results.y + index, y);
+						L::Store(results.z + index, z);
+					}
+
+					return index;
+				}
+
+				template <std::size_t Width, typename Kernel>
+				inline std::size_t TransformVec4ArrayLanes(const Kernel& kernel, const Vec4Arrays<const float>& vectors, const Vec4Arrays<float>& results, std::size_t index, const std::size_t count)
+				{
+					typedef Lanes<Width> L;
+
+					for (; index + Width <= count; index += Width)
+					{
+						typename L::Register x = L::Load(vectors.x + index);
+						typename L::Register y = L::Load(vectors.y + index);
+						typename L::Register z = L::Load(vectors.z + index);
+						typename L::Register w = L::Load(vectors.w + index);
+						kernel.template Transform<L>(x, y, z, w);
+						L::Store(results.x + index, x);
+						L::Store(results.y + index, y);
+						L::Store(results.z + index, z);
+						L::Store(results.w + index, w);
+					}
+
+					return index;
+				}
+
+				// Vec3 vectors one after the other, three floats each
+				template <typename Kernel>
+				inline void TransformVec3s(const Kernel& kernel, const float* vectors, float* results, const std::size_t count)
+				{
+					std::size_t index = 0;
+
+					#ifdef VISAGE_MATH_AVX
+						index = TransformVec3Lanes<8>(kernel, vectors, results, index, count);
+					#endif
+
+					index = TransformVec3Lanes<4>(kernel, vectors, results, index, count);
+					TransformVec3Lanes<1>(kernel, vectors, results, index, count);
+				}
+
+				template <typename Kernel>
+				inline void TransformVec4s(const Kernel& kernel, const float* vectors, float* results, const std::size_t count)
+				{
+					std::size_t index = 0;
+
+					#ifdef VISAGE_MATH_AVX
+						index = TransformVec4Lanes<8>(kernel, vectors, results, index, count);
+					#endif
+
+					index = TransformVec4Lanes<4>(kernel, vectors, results, index, count);
+					TransformVec4Lanes<1>(kernel, vectors, results, index, count);
+				}
+
+				template <typename Kernel>
+				inline void TransformVec3Arrays(const Kernel& kernel, const Vec3Arrays<const float>& vectors, const Vec3Arrays<float>& results, const std::size_t count)
+				{
+					std::size_t index = 0;
+
+					#ifdef VISAGE_MATH_AVX
+						index = TransformVec3ArrayLanes<8>(kernel, vectors, results, index, count);
+					#endif
+
+					index = TransformVec3ArrayLanes<4>(kernel, vectors, results, index, count);
+					TransformVec3ArrayLanes<1>(kernel, vectors, results, index, count);
+				}
+
+				template <typename Kernel>
+				inline void TransformVec4Arrays(const Kernel& kernel, const Vec4Arrays<const float>& vectors, const Vec4Arrays<float>& results, const std::size_t count)
+				{
+					std::size_t index = 0;
+
+					#ifdef VISAGE_MATH_AVX
+						index = TransformVec4ArrayLanes<8>(kernel, vectors, results, index, count);
+					#endif
+
+					index = TransformVec4ArrayLanes<4>(kernel, vectors, results, index, count);
+					TransformVec4ArrayLanes<1>(kernel, vectors, results, index, count);
+				}
+			}
+		}
+	}
+#endif
@@ -3,6 +3,7 @@
 #include "Vec3.h"
 #include "Vec4.h"
 #include "Mat3.h"
+#include "VectorArrays.h"
 
 namespace Visage
 {
@@ -14,73 +15,83 @@ namespace Visage
 		public:
 			union
 			{
-				T x, y, z, w;
+				struct
+				{
+					T x, y, z, w;
+				};
 
 				Vec4<T> components;
 			};
 
-			Quaternion();
-			Quaternion(const T x, const T y, const T z, const T w);
+			constexpr Quaternion();
+			constexpr Quaternion(const T x, const T y, const T z, const T w);
 			Quaternion(const Vec3<T>& unitVector, const T angleInDegrees);
-			Quaternion(const Quaternion<T>& quaternion);
+			constexpr Quaternion(const Quaternion<T>& quaternion) = default;
 
 			~Quaternion() = default;
 
 			T Norm() const;
-			T SqrNorm() const;
+			constexpr T SqrNorm() const;
 			Quaternion<T> Normalized() const;
 			Quaternion<T>& Normalize();
-			Quaternion<T> Renormalized() const;
-			Quaternion<T>& Renormalize();
-			Quaternion<T> Inverted() const;
-			Quaternion<T>& Invert();
-			Quaternion<T> Conjugate() const;
-			Mat3<T> GetRotationMatrix() const;
+			constexpr Quaternion<T> Renormalized() const;
+			constexpr Quaternion<T>& Renormalize();
+			constexpr Quaternion<T> Inverted() const;
+			constexpr Quaternion<T>& Invert();
+			constexpr Quaternion<T> Conjugate() const;
+			constexpr Mat3<T> GetRotationMatrix() const;
 			void SetRotationMatrix(const Mat3<T>& matrix);
 
-			static Vec3<T> TransformVector(const Quaternion<T>& quaterion, const Vec3<T>& vector);
-			static T Dot(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
+			static constexpr Vec3<T> TransformVector(const Quaternion<T>& quaterion, const Vec3<T>& vector);
+			// TransformVector for count vectors, results may be the vectors
+			static void TransformVectors(const Quaternion<T>& quaternion, const Vec3<T>* vectors, Vec3<T>* results, const std::size_t count);
+			static void TransformVectors(const Quaternion<T>& quaternion, const Vec3Arrays<const T>& vectors, const Vec3Arrays<T>& results, const std::size_t count);
+			static constexpr T Dot(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
 			static Quaternion<T> MakeRotationX(const T angleInDegrees);
 			static Quaternion<T> MakeRotationY(const T angleInDegrees);
 			static Quaternion<T> MakeRotationZ(const T angleInDegrees);
 			static Quaternion<T> MakeRotation(const Vec3<T>& unitVector, const T angleInDegrees);
-			static Quaternion<T> Lerp(const Quaternion<T>& leftQuaternion, const Quaternion<T>& rightQuaternion, const T t);
+			static constexpr Quaternion<T> Lerp(const Quaternion<T>& leftQuaternion, const Quaternion<T>& rightQuaternion, const T t);
 			static Quaternion<T> Nlerp(const Quaternion<T>& leftQuaternion, const Quaternion<T>& rightQuaternion, const T t);
 			static Quaternion<T> Slerp(const Quaternion<T>& leftQuaternion, const Quaternion<T>& rightQuaternion, const T t);
 
-			Quaternion<T>& operator=(const Quaternion<T>& quaternion);
-			Quaternion<T>& operator*=(const Quaternion<T>& quaterion);
-			Quaternion<T>& operator*=(const T scalar);
-			Quaternion<T>& operator/=(const T scalar);
-			Quaternion<T>& operator+=(const Quaternion<T>& quaternion);
-			Quaternion<T>& operator-=(const Quaternion<T>& quaternion);
+			constexpr Quaternion<T>& operator=(const Quaternion<T>& quaternion) = default;
+			constexpr Quaternion<T>& operator*=(const Quaternion<T>& quaterion);
+			constexpr Quaternion<T>& operator*=(const T scalar);
+			constexpr Quaternion<T>& operator/=(const T scalar);
+			constexpr Quaternion<T>& operator+=(const Quaternion<T>& quaternion);
+			constexpr Quaternion<T>& operator-=(const Quaternion<T>& quaternion);
 
-			friend Vec3<T> operator*(const Quaternion<T>& quaternion, const Vec3<T>& vector)
+			friend constexpr Vec3<T> operator*(const Quaternion<T>& quaternion, const Vec3<T>& vector)
 			{
 				return Quaternion<T>::TransformVector(quaternion, vector);
 			}
+
+		private:
+			// Body of the Hamilton product, also the constant-evaluated path of the float version
+			static constexpr Quaternion<T> Multiply(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
 		};
 
 		template <typename T>
-		Quaternion<T> operator*(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
+		constexpr Quaternion<T> operator*(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
 
 		template <typename T>
-		Quaternion<T> operator*(const Quaternion<T>& quaterion, const T scalar);
+		constexpr Quaternion<T> operator*(const Quaternion<T>& quaterion, const T scalar);
 
 		template <typename T>
-		Quaternion<T> operator*(const T scalar, const Quaternion<T>& quaterion);
+		constexpr Quaternion<T> operator*(const T scalar, const Quaternion<T>& quaterion);
 
 		template <typename T>
-		Quaternion<T> operator/(const Quaternion<T>& quaterion, const T scalar);
+		constexpr Quaternion<T> operator/(const Quaternion<T>& quaterion, const T scalar);
 
 		template <typename T>
-		Quaternion<T> operator/(const T scalar, const Quaternion<T>& quaterion);
+		constexpr Quaternion<T> operator/(const T scalar, const Quaternion<T>& quaterion);
 
 		template <typename T>
-		Quaternion<T> operator+(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
+		constexpr Quaternion<T> operator+(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
 
 		template <typename T>
-		Quaternion<T> operator-(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
+		constexpr Quaternion<T> operator-(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion);
 
 		template <typename T>
 		std::ostream& operator<<(std::ostream& stream, const Quaternion<T>& quaternion);
@@ -90,4 +101,5 @@ namespace Visage
 	using quatd = Math::Quaternion<double>;
 }
 
-#include "Quaternion.inl"
\ No newline at end of file
+#include "Quaternion.inl"
+#include "QuaternionSimd.inl"
\ No newline at end of file
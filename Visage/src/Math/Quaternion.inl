@@ -10,13 +10,13 @@ namespace Visage
 	namespace Math
 	{
 		template <typename T>
-		Quaternion<T>::Quaternion()
+		constexpr Quaternion<T>::Quaternion()
 			: x(0), y(0), z(0), w(1)
 		{
 		}
 
 		template <typename T>
-		Quaternion<T>::Quaternion(const T x, const T y, const T z, const T w)
+		constexpr Quaternion<T>::Quaternion(const T x, const T y, const T z, const T w)
 			: x(x), y(y), z(z), w(w)
 		{
 		}
@@ -34,12 +34,6 @@ namespace Visage
 			w = cosHalfAngle;
 		}
 
-		template <typename T>
-		Quaternion<T>::Quaternion(const Quaternion<T>& quaternion)
-			: x(quaternion.x), y(quaternion.y), z(quaternion.z), w(quaternion.w)
-		{
-		}
-
 		template <typename T>
 		T Quaternion<T>::Norm() const
 		{
@@ -47,7 +41,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		T Quaternion<T>::SqrNorm() const
+		constexpr T Quaternion<T>::SqrNorm() const
 		{
 			return x * x + y * y + z * z + w * w;
 		}
@@ -71,14 +65,14 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T> Quaternion<T>::Renormalized() const
+		constexpr Quaternion<T> Quaternion<T>::Renormalized() const
 		{
 			T inverseNorm = FastInverseSqurRootAroundOne(SqrNorm());
 			return Quaternion<T>(x * inverseNorm, y * inverseNorm, z * inverseNorm, w * inverseNorm);
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::Renormalize()
+		constexpr Quaternion<T>& Quaternion<T>::Renormalize()
 		{
 			T inverseNorm = FastInverseSqurRootAroundOne(SqrNorm());
 			*this *= inverseNorm;
@@ -86,13 +80,13 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T> Quaternion<T>::Inverted() const
+		constexpr Quaternion<T> Quaternion<T>::Inverted() const
 		{
 			return Conjugate();
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::Invert()
+		constexpr Quaternion<T>& Quaternion<T>::Invert()
 		{
 			x = -x;
 			y = -y;
@@ -101,13 +95,13 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T> Quaternion<T>::Conjugate() const
+		constexpr Quaternion<T> Quaternion<T>::Conjugate() const
 		{
 			return Quaternion<T>(-x, -y, -z, w);
 		}
 
 		template <typename T>
-		Mat3<T> Quaternion<T>::GetRotationMatrix() const
+		constexpr Mat3<T> Quaternion<T>::GetRotationMatrix() const
 		{
 			Mat3<T> matrix;
 
@@ -183,7 +177,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec3<T> Quaternion<T>::TransformVector(const Quaternion<T>& quaterion, const Vec3<T>& vector)
+		constexpr Vec3<T> Quaternion<T>::TransformVector(const Quaternion<T>& quaterion, const Vec3<T>& vector)
 		{
 			Vec3<T> vectorPart(quaterion.x, quaterion.y, quaterion.z);
 			
@@ -193,7 +187,29 @@ namespace Visage
 		}
 
 		template <typename T>
-		T Quaternion<T>::Dot(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
+		void Quaternion<T>::TransformVectors(const Quaternion<T>& quaternion, const Vec3<T>* vectors, Vec3<T>* results, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				results[i] = TransformVector(quaternion, vectors[i]);
+			}
+		}
+
+		template <typename T>
+		void Quaternion<T>::TransformVectors(const Quaternion<T>& quaternion, const Vec3Arrays<const T>& vectors, const Vec3Arrays<T>& results, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				Vec3<T> result = TransformVector(quaternion, Vec3<T>(vectors.x[i], vectors.y[i], vectors.z[i]));
+
+				results.x[i] = result.x;
+				results.y[i] = result.y;
+				results.z[i] = result.z;
+			}
+		}
+
+		template <typename T>
+		constexpr T Quaternion<T>::Dot(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
 		{
 			return leftQuaterion.x * rightQuaterion.x + 
 				   leftQuaterion.y * rightQuaterion.y + 
@@ -229,7 +245,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T> Quaternion<T>::Lerp(const Quaternion<T>& leftQuaternion, const Quaternion<T>& rightQuaternion, const T t)
+		constexpr Quaternion<T> Quaternion<T>::Lerp(const Quaternion<T>& leftQuaternion, const Quaternion<T>& rightQuaternion, const T t)
 		{
 			return leftQuaternion * (static_cast<T>(1) - t) + rightQuaternion * t;
 		}
@@ -257,30 +273,22 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::operator=(const Quaternion<T>& quaternion)
+		constexpr Quaternion<T>& Quaternion<T>::operator*=(const Quaternion<T>& quaterion)
 		{
-			x = quaternion.x;
-			y = quaternion.y;
-			z = quaternion.z;
-			w = quaternion.w;
-			return *this;
+			return *this = Multiply(*this, quaterion);
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::operator*=(const Quaternion<T>& quaterion)
+		constexpr Quaternion<T> Quaternion<T>::Multiply(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
 		{
-			Quaternion<T> temp = *this;
-			
-			this->x = temp.w * quaterion.x + temp.x * quaterion.w + temp.y * quaterion.z - temp.z * quaterion.y;
-			this->y = temp.w * quaterion.y + temp.y * quaterion.w + temp.z * quaterion.x - temp.x * quaterion.z;
-			this->z = temp.w * quaterion.z + temp.z * quaterion.w + temp.x * quaterion.y - temp.y * quaterion.x;
-			this->w = temp.w * quaterion.w - temp.x * quaterion.x - temp.y * quaterion.y - temp.z * quaterion.z;
-
-			return *this;
+			return Quaternion<T>(leftQuaterion.w * rightQuaterion.x + leftQuaterion.x * rightQuaterion.w + leftQuaterion.y * rightQuaterion.z - leftQuaterion.z * rightQuaterion.y,
+								 leftQuaterion.w * rightQuaterion.y + leftQuaterion.y * rightQuaterion.w + leftQuaterion.z * rightQuaterion.x - leftQuaterion.x * rightQuaterion.z,
+								 leftQuaterion.w * rightQuaterion.z + leftQuaterion.z * rightQuaterion.w + leftQuaterion.x * rightQuaterion.y - leftQuaterion.y * rightQuaterion.x,
+								 leftQuaterion.w * rightQuaterion.w - leftQuaterion.x * rightQuaterion.x - leftQuaterion.y * rightQuaterion.y - leftQuaterion.z * rightQuaterion.z);
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::operator*=(const T scalar)
+		constexpr Quaternion<T>& Quaternion<T>::operator*=(const T scalar)
 		{
 			x *= scalar;
 			y *= scalar;
@@ -290,7 +298,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::operator/=(const T scalar)
+		constexpr Quaternion<T>& Quaternion<T>::operator/=(const T scalar)
 		{
 			x /= scalar;
 			y /= scalar;
@@ -300,7 +308,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::operator+=(const Quaternion<T>& quaternion)
+		constexpr Quaternion<T>& Quaternion<T>::operator+=(const Quaternion<T>& quaternion)
 		{
 			x += quaternion.x;
 			y += quaternion.y;
@@ -310,7 +318,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T>& Quaternion<T>::operator-=(const Quaternion<T>& quaternion)
+		constexpr Quaternion<T>& Quaternion<T>::operator-=(const Quaternion<T>& quaternion)
 		{
 			x -= quaternion.x;
 			y -= quaternion.y;
@@ -320,49 +328,49 @@ namespace Visage
 		}
 
 		template <typename T>
-		Quaternion<T> operator*(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
+		constexpr Quaternion<T> operator*(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
 		{
 			Quaternion<T> leftQuaterionCopy = leftQuaterion;
 			return leftQuaterionCopy *= rightQuaterion;
 		}
 		
 		template <typename T>
-		Quaternion<T> operator*(const Quaternion<T>& quaterion, const T scalar)
+		constexpr Quaternion<T> operator*(const Quaternion<T>& quaterion, const T scalar)
 		{
 			Quaternion quaterionCopy = quaterion;
 			return quaterionCopy *= scalar;
 		}
 
 		template<typename T>
-		Quaternion<T> operator*(const T scalar, const Quaternion<T>& quaterion)
+		constexpr Quaternion<T> operator*(const T scalar, const Quaternion<T>& quaterion)
 		{
 			Quaternion quaterionCopy = quaterion;
 			return quaterionCopy *= scalar;
 		}
 
 		template <typename T>
-		Quaternion<T> operator/(const Quaternion<T>& quaterion, const T scalar)
+		constexpr Quaternion<T> operator/(const Quaternion<T>& quaterion, const T scalar)
 		{
 			Quaternion<T> quaterionCopy = quaterion;
 			return quaterionCopy /= scalar;
 		}
 
 		template<typename T>
-		Quaternion<T> operator/(const T scalar, const Quaternion<T>& quaterion)
+		constexpr Quaternion<T> operator/(const T scalar, const Quaternion<T>& quaterion)
 		{
 			Quaternion<T> quaterionCopy = quaterion;
 			return quaterionCopy /= scalar;
 		}
 
 		template <typename T>
-		Quaternion<T> operator+(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
+		constexpr Quaternion<T> operator+(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
 		{
 			Quaternion<T> leftQuaterionCopy = leftQuaterion;
 			return leftQuaterionCopy += rightQuaterion;
 		}
 
 		template <typename T>
-		Quaternion<T> operator-(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
+		constexpr Quaternion<T> operator-(const Quaternion<T>& leftQuaterion, const Quaternion<T>& rightQuaterion)
 		{
 			Quaternion<T> leftQuaterionCopy = leftQuaterion;
 			return leftQuaterionCopy -= rightQuaterion;
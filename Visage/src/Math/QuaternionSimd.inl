@@ -0,0 +1,174 @@
+#pragma once
+
+#include "MathSimd.h"
+
+#ifdef VISAGE_MATH_SSE
+	namespace Visage
+	{
+		namespace Math
+		{
+			// Constant expressions take the scalar branches, the intrinsics cannot be evaluated there
+
+			template <>
+			constexpr float Quaternion<float>::Dot(const Quaternion<float>& leftQuaterion, const Quaternion<float>& rightQuaterion)
+			{
+				if (IsConstantEvaluated())
+				{
+					return leftQuaterion.x * rightQuaterion.x + leftQuaterion.y * rightQuaterion.y + leftQuaterion.z * rightQuaterion.z + leftQuaterion.w * rightQuaterion.w;
+				}
+
+				return _mm_cvtss_f32(_mm_dp_ps(_mm_loadu_ps(&leftQuaterion.x), _mm_loadu_ps(&rightQuaterion.x), 0xF1));
+			}
+
+			template <>
+			constexpr float Quaternion<float>::SqrNorm() const
+			{
+				return Dot(*this, *this);
+			}
+
+			template <>
+			inline Quaternion<float> Quaternion<float>::Normalized() const
+			{
+				__m128 quaternion = _mm_loadu_ps(&x);
+				__m128 norm = _mm_sqrt_ps(_mm_dp_ps(quaternion, quaternion, 0xFF));
+
+				Quaternion<float> result;
+				_mm_storeu_ps(&result.x, _mm_div_ps(quaternion, norm));
+				return result;
+			}
+
+			template <>
+			inline Quaternion<float>& Quaternion<float>::Normalize()
+			{
+				__m128 quaternion = _mm_loadu_ps(&x);
+				__m128 norm = _mm_sqrt_ps(_mm_dp_ps(quaternion, quaternion, 0xFF));
+
+				_mm_storeu_ps(&x, _mm_div_ps(quaternion, norm));
+				return *this;
+			}
+
+			template <>
+			constexpr Quaternion<float>& Quaternion<float>::operator*=(const Quaternion<float>& quaterion)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Multiply(*this, quaterion);
+				}
+
+				// The Hamilton product as four lane-wise products, the scalar part takes the negated terms
+				//   w1 * (x2, y2, z2, w2)
+				// + (x1, y1, z1, -x1) * (w2, w2, w2, x2)
+				// + (y1, z1, x1, -y1) * (z2, x2, y2, y2)
+				// - (z1, x1, y1, z1) * (y2, z2, x2, z2)
+				__m128 left = _mm_loadu_ps(&x);
+				__m128 right = _mm_loadu_ps(&quaterion.x);
+				__m128 negateW = _mm_set_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+
+				__m128 crossTerms = _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(1, 0, 2, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 1, 0, 2)));
+				crossTerms = Simd::MultiplyAdd(_mm_shuffle_ps(left, left, _MM_SHUFFLE(0, 2, 1, 0)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(0, 3, 3, 3)), crossTerms);
+
+				__m128 result = Simd::MultiplyAdd(Simd::Splat<3>(left), right, _mm_xor_ps(crossTerms, negateW));
+				result = _mm_sub_ps(result, _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 1, 0, 2)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(2, 0, 2, 1))));
+
+				_mm_storeu_ps(&x, result);
+				return *this;
+			}
+
+			template <>
+			constexpr Quaternion<float>& Quaternion<float>::operator*=(const float scalar)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Quaternion<float>(x * scalar, y * scalar, z * scalar, w * scalar);
+				}
+
+				_mm_storeu_ps(&x, _mm_mul_ps(_mm_loadu_ps(&x), _mm_set1_ps(scalar)));
+				return *this;
+			}
+
+			template <>
+			constexpr Quaternion<float>& Quaternion<float>::operator/=(const float scalar)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Quaternion<float>(x / scalar, y / scalar, z / scalar, w / scalar);
+				}
+
+				_mm_storeu_ps(&x, _mm_div_ps(_mm_loadu_ps(&x), _mm_set1_ps(scalar)));
+				return *this;
+			}
+
+			template <>
+			constexpr Quaternion<float>& Quaternion<float>::operator+=(const Quaternion<float>& quaternion)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Quaternion<float>(x + quaternion.x, y + quaternion.y, z + quaternion.z, w + quaternion.w);
+				}
+
+				_mm_storeu_ps(&x, _mm_add_ps(_mm_loadu_ps(&x), _mm_loadu_ps(&quaternion.x)));
+				return *this;
+			}
+
+			template <>
+			constexpr Quaternion<float>& Quaternion<float>::operator-=(const Quaternion<float>& quaternion)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = Quaternion<float>(x - quaternion.x, y - quaternion.y, z - quaternion.z, w - quaternion.w);
+				}
+
+				_mm_storeu_ps(&x, _mm_sub_ps(_mm_loadu_ps(&x), _mm_loadu_ps(&quaternion.x)));
+				return *this;
+			}
+
+			namespace Simd
+			{
+				// Quaternion::TransformVector on lanes of vectors:
+				// vector * (w^2 - |u|^2) + u * 2 (u . vector) + (u x vector) * 2 w, u the vector part
+				struct QuaternionKernel {
+					float vectorPart[3];
+					float vectorScale;
+					float crossScale;
+
+					explicit QuaternionKernel(const Quaternion<float>& quaternion)
+						: vectorPart{ quaternion.x, quaternion.y, quaternion.z },
+						  vectorScale(quaternion.w * quaternion.w - (quaternion.x * quaternion.x + quaternion.y * quaternion.y + quaternion.z * quaternion.z)),
+						  crossScale(quaternion.w * 2.0f)
+					{ }
+
+					template <typename L>
+					inline void Transform(typename L::Register& x, typename L::Register& y, typename L::Register& z) const
+					{
+						typedef typename L::Register Register;
+
+						Register u[3] = { L::Broadcast(vectorPart[0]), L::Broadcast(vectorPart[1]), L::Broadcast(vectorPart[2]) };
+						Register doubledDot = L::Multiply(WeightedSum<L>(vectorPart, x, y, z), L::Broadcast(2.0f));
+						Register scale = L::Broadcast(vectorScale);
+						Register doubledW = L::Broadcast(crossScale);
+
+						Register crossX = L::Subtract(L::Multiply(u[1], z), L::Multiply(u[2], y));
+						Register crossY = L::Subtract(L::Multiply(u[2], x), L::Multiply(u[0], z));
+						Register crossZ = L::Subtract(L::Multiply(u[0], y), L::Multiply(u[1], x));
+
+						x = L::MultiplyAdd(crossX, doubledW, L::MultiplyAdd(u[0], doubledDot, L::Multiply(x, scale)));
+						y = L::MultiplyAdd(crossY, doubledW, L::MultiplyAdd(u[1], doubledDot, L::Multiply(y, scale)));
+						z = L::MultiplyAdd(crossZ, doubledW, L::MultiplyAdd(u[2], doubledDot, L::Multiply(z, scale)));
+					}
+				};
+			}
+
+			template <>
+			inline void Quaternion<float>::TransformVectors(const Quaternion<float>& quaternion, const Vec3<float>* vectors, Vec3<float>* results, const std::size_t count)
+			{
+				Simd::TransformVec3s(Simd::QuaternionKernel(quaternion), reinterpret_cast<const float*>(vectors), reinterpret_cast<float*>(results), count);
+			}
+
+			template <>
+			inline void Quaternion<float>::TransformVectors(const Quaternion<float>& quaternion, const Vec3Arrays<const float>& vectors, const Vec3Arrays<float>& results, const std::size_t count)
+			{
+				Simd::TransformVec3Arrays(Simd::QuaternionKernel(quaternion), vectors, results, count);
+			}
+		}
+	}
+#endif
@@ -1,95 +1,222 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <ostream>
+#include <utility>
 
 namespace Visage
 {
 	namespace Math
 	{
-		template <template <typename> class vectorType, typename T, int numberOfElements, int... Indices>
-		class Swizzle
+		// Some components of a vector in the order of Indices, returned by the swizzle accessors. Reading it gives a
+		// vectorType<T>, assigning to it writes the components back, so v.zy() = Vec2<T>(1, 2) sets z and y.
+		template <template <typename> class vectorType, typename T, int... Indices>
+		class SwizzleProxy
 		{
 		private:
-			std::array<T, numberOfElements> data;
+			// Points at the x, y, z and w members rather than into data, constant expressions may only access the
+			// union member the vector constructors initialize
+			T* components[sizeof...(Indices)];
 
-		public:
-			vectorType<T>& operator=(const vectorType<T>& vector)
+			template <std::size_t... Positions>
+			constexpr vectorType<T> Read(std::index_sequence<Positions...>) const
+			{
+				return vectorType<T>(*components[Positions]...);
+			}
+
+			// Unrolled by the expansion, a loop over the components is left rolled at -O2
+			template <std::size_t... Positions>
+			constexpr void Write(const std::array<T, sizeof...(Indices)>& values, std::index_sequence<Positions...>)
 			{
-				T indices[sizeof...(Indices)] = {Indices...};
+				((*components[Positions] = values[Positions]), ...);
+			}
 
-				for (unsigned int i = 0; i < this->data.size(); i++)
+			// The components of a vector read through its members for the same reason, in the order they are written
+			static constexpr std::array<T, sizeof...(Indices)> Values(const vectorType<T>& vector)
+			{
+				if constexpr (sizeof...(Indices) == 2)
+				{
+					return {{ vector.x, vector.y }};
+				}
+				else if constexpr (sizeof...(Indices) == 3)
 				{
-					this->data[indices[i]] = vector[i];
+					return {{ vector.x, vector.y, vector.z }};
 				}
+				else
+				{
+					return {{ vector.x, vector.y, vector.z, vector.w }};
+				}
+			}
 
-				return *(vectorType<T>*)this;
+		public:
+			template <std::size_t numberOfComponents>
+			constexpr explicit SwizzleProxy(const std::array<T*, numberOfComponents>& vectorComponents)
+				: components{ vectorComponents[Indices]... }
+			{ }
+
+			constexpr SwizzleProxy(const SwizzleProxy& swizzle) = default;
+
+			// Copies the values rather than the reference, v.xy() = u.xy() writes u's components into v
+			constexpr SwizzleProxy& operator=(const SwizzleProxy& swizzle)
+			{
+				return *this = static_cast<vectorType<T>>(swizzle);
 			}
 
-			unsigned int NumberOfBytes()
+			// Takes a copy, the vector may be the one this refers to as in v.yx() = v
+			constexpr SwizzleProxy& operator=(const vectorType<T> vector)
 			{
-				return sizeof...(Indices) * sizeof(T);
+				Write(Values(vector), std::make_index_sequence<sizeof...(Indices)>());
+				return *this;
 			}
 
-			unsigned int NumberOfElements()
+			constexpr operator vectorType<T>() const
 			{
-				return sizeof...(Indices);
+				return Read(std::make_index_sequence<sizeof...(Indices)>());
 			}
 
-			inline operator vectorType<T>() const
+			constexpr SwizzleProxy& operator+=(const vectorType<T>& vector)
 			{
-				return vectorType<T>(data[Indices]...);
+				return *this = static_cast<vectorType<T>>(*this) + vector;
 			}
 
-			inline vectorType<T>& operator+=(const vectorType<T>& vector)
+			constexpr SwizzleProxy& operator-=(const vectorType<T>& vector)
 			{
-				return *(reinterpret_cast<vectorType<T>*>(this)) += vector;
+				return *this = static_cast<vectorType<T>>(*this) - vector;
 			}
 
-			inline vectorType<T>& operator-=(const vectorType<T>& vector)
+			constexpr SwizzleProxy& operator*=(const T scalar)
 			{
-				return *(reinterpret_cast<vectorType<T>*>(this)) -= vector;
+				return *this = static_cast<vectorType<T>>(*this) * scalar;
 			}
 
-			inline vectorType<T>& operator*=(const T scalar)
+			constexpr SwizzleProxy& operator/=(const T scalar)
 			{
-				return *(reinterpret_cast<vectorType<T>*>(this)) *= scalar;
+				return *this = static_cast<vectorType<T>>(*this) / scalar;
 			}
 
-			inline vectorType<T>& operator/=(const T scalar)
+			friend constexpr vectorType<T> operator+(const SwizzleProxy& swizzle, const vectorType<T>& vector)
 			{
-				return *(reinterpret_cast<vectorType<T>*>(this)) /= scalar;
+				return static_cast<vectorType<T>>(swizzle) + vector;
 			}
 
-			friend vectorType<T> operator+(const Swizzle& leftSwizzle, const Swizzle& rightSwizzle)
+			friend constexpr vectorType<T> operator-(const SwizzleProxy& swizzle, const vectorType<T>& vector)
 			{
-				vectorType<T> leftSwizzleCopy = leftSwizzle;
-				return leftSwizzleCopy += rightSwizzle;
+				return static_cast<vectorType<T>>(swizzle) - vector;
 			}
 
-			friend vectorType<T> operator-(const Swizzle& leftSwizzle, const Swizzle& rightSwizzle)
+			friend constexpr vectorType<T> operator*(const SwizzleProxy& swizzle, const T scalar)
 			{
-				vectorType<T> leftSwizzleCopy = leftSwizzle;
-				return leftSwizzleCopy -= rightSwizzle;
+				return static_cast<vectorType<T>>(swizzle) * scalar;
 			}
 
-			friend vectorType<T> operator*(const Swizzle& leftSwizzle, const T scalar)
+			friend constexpr vectorType<T> operator*(const T scalar, const SwizzleProxy& swizzle)
 			{
-				vectorType<T> leftSwizzleCopy = leftSwizzle;
-				return leftSwizzleCopy *= scalar;
+				return static_cast<vectorType<T>>(swizzle) * scalar;
 			}
 
-			friend vectorType<T> operator/(const Swizzle& leftSwizzle, const T scalar)
+			friend constexpr vectorType<T> operator/(const SwizzleProxy& swizzle, const T scalar)
 			{
-				vectorType<T> leftSwizzleCopy = leftSwizzle;
-				return leftSwizzleCopy /= scalar;
+				return static_cast<vectorType<T>>(swizzle) / scalar;
 			}
 
-			friend std::ostream& operator<<(std::ostream& stream, Swizzle& swizzle)
+			friend std::ostream& operator<<(std::ostream& stream, const SwizzleProxy& swizzle)
 			{
 				stream << static_cast<vectorType<T>>(swizzle);
 				return stream;
 			}
 		};
+
+		#ifdef VISAGE_MATH_SWIZZLE_UNION
+			// The swizzles as union members overlaying the vector, e.g. v.xy without the call. Every vector then
+			// instantiates a class per swizzle, around 340 for a Vec4.
+			template <template <typename> class vectorType, typename T, int numberOfElements, int... Indices>
+			class Swizzle
+			{
+			private:
+				std::array<T, numberOfElements> data;
+
+				// Unrolled by the expansion, a loop over the components is left rolled at -O2
+				template <std::size_t... Positions>
+				void Write(const vectorType<T>& vector, std::index_sequence<Positions...>)
+				{
+					((this->data[Indices] = vector.data[Positions]), ...);
+				}
+
+			public:
+				// Takes a copy, the vector may be the one this overlays as in v.yx = v
+				Swizzle& operator=(const vectorType<T> vector)
+				{
+					Write(vector, std::make_index_sequence<sizeof...(Indices)>());
+					return *this;
+				}
+
+				unsigned int NumberOfBytes()
+				{
+					return sizeof...(Indices) * sizeof(T);
+				}
+
+				unsigned int NumberOfElements()
+				{
+					return sizeof...(Indices);
+				}
+
+				inline operator vectorType<T>() const
+				{
+					return vectorType<T>(data[Indices]...);
+				}
+
+				// The compound assignments go through the components in Indices, the swizzle only overlays the vector
+				inline Swizzle& operator+=(const vectorType<T>& vector)
+				{
+					return *this = static_cast<vectorType<T>>(*this) + vector;
+				}
+
+				inline Swizzle& operator-=(const vectorType<T>& vector)
+				{
+					return *this = static_cast<vectorType<T>>(*this) - vector;
+				}
+
+				inline Swizzle& operator*=(const T scalar)
+				{
+					return *this = static_cast<vectorType<T>>(*this) * scalar;
+				}
+
+				inline Swizzle& operator/=(const T scalar)
+				{
+					return *this = static_cast<vectorType<T>>(*this) / scalar;
+				}
+
+				friend vectorType<T> operator+(const Swizzle& leftSwizzle, const Swizzle& rightSwizzle)
+				{
+					vectorType<T> leftSwizzleCopy = leftSwizzle;
+					return leftSwizzleCopy += rightSwizzle;
+				}
+
+				friend vectorType<T> operator-(const Swizzle& leftSwizzle, const Swizzle& rightSwizzle)
+				{
+					vectorType<T> leftSwizzleCopy = leftSwizzle;
+					return leftSwizzleCopy -= rightSwizzle;
+				}
+
+				friend vectorType<T> operator*(const Swizzle& leftSwizzle, const T scalar)
+				{
+					vectorType<T> leftSwizzleCopy = leftSwizzle;
+					return leftSwizzleCopy *= scalar;
+				}
+
+				friend vectorType<T> operator/(const Swizzle& leftSwizzle, const T scalar)
+				{
+					vectorType<T> leftSwizzleCopy = leftSwizzle;
+					return leftSwizzleCopy /= scalar;
+				}
+
+				friend std::ostream& operator<<(std::ostream& stream, Swizzle& swizzle)
+				{
+					stream << static_cast<vectorType<T>>(swizzle);
+					return stream;
+				}
+			};
+		#endif
 	}
 }
@@ -26,120 +26,160 @@ namespace Visage
 					T x, y;
 				};
 
-				Swizzle<Vec2, T, 2, 0, 0> xx;
-				Swizzle<Vec2, T, 2, 0, 1> xy;
-				Swizzle<Vec2, T, 2, 1, 0> yx;
-				Swizzle<Vec2, T, 2, 1, 1> yy;
-
-				Swizzle<Vec3, T, 2, 0, 0, 0> xxx;
-				Swizzle<Vec3, T, 2, 0, 0, 1> xxy;
-				Swizzle<Vec3, T, 2, 0, 1, 0> xyx;
-				Swizzle<Vec3, T, 2, 0, 1, 1> xyy;
-				Swizzle<Vec3, T, 2, 1, 0, 0> yxx;
-				Swizzle<Vec3, T, 2, 1, 0, 1> yxy;
-				Swizzle<Vec3, T, 2, 1, 1, 0> yyx;
-				Swizzle<Vec3, T, 2, 1, 1, 1> yyy;
-
-				Swizzle<Vec4, T, 2, 0, 0, 0, 0> xxxx;
-				Swizzle<Vec4, T, 2, 0, 0, 0, 1> xxxy;
-				Swizzle<Vec4, T, 2, 0, 0, 1, 0> xxyx;
-				Swizzle<Vec4, T, 2, 0, 0, 1, 1> xxyy;
-				Swizzle<Vec4, T, 2, 0, 1, 0, 0> xyxx;
-				Swizzle<Vec4, T, 2, 0, 1, 0, 1> xyxy;
-				Swizzle<Vec4, T, 2, 0, 1, 1, 0> xyyx;
-				Swizzle<Vec4, T, 2, 0, 1, 1, 1> xyyy;
-				Swizzle<Vec4, T, 2, 1, 0, 0, 0> yxxx;
-				Swizzle<Vec4, T, 2, 1, 0, 0, 1> yxxy;
-				Swizzle<Vec4, T, 2, 1, 0, 1, 0> yxyx;
-				Swizzle<Vec4, T, 2, 1, 0, 1, 1> yxyy;
-				Swizzle<Vec4, T, 2, 1, 1, 0, 0> yyxx;
-				Swizzle<Vec4, T, 2, 1, 1, 0, 1> yyxy;
-				Swizzle<Vec4, T, 2, 1, 1, 1, 0> yyyx;
-				Swizzle<Vec4, T, 2, 1, 1, 1, 1> yyyy;
+				#ifdef VISAGE_MATH_SWIZZLE_UNION
+					Swizzle<Vec2, T, 2, 0, 0> xx;
+					Swizzle<Vec2, T, 2, 0, 1> xy;
+					Swizzle<Vec2, T, 2, 1, 0> yx;
+					Swizzle<Vec2, T, 2, 1, 1> yy;
+
+					Swizzle<Vec3, T, 2, 0, 0, 0> xxx;
+					Swizzle<Vec3, T, 2, 0, 0, 1> xxy;
+					Swizzle<Vec3, T, 2, 0, 1, 0> xyx;
+					Swizzle<Vec3, T, 2, 0, 1, 1> xyy;
+					Swizzle<Vec3, T, 2, 1, 0, 0> yxx;
+					Swizzle<Vec3, T, 2, 1, 0, 1> yxy;
+					Swizzle<Vec3, T, 2, 1, 1, 0> yyx;
+					Swizzle<Vec3, T, 2, 1, 1, 1> yyy;
+
+					Swizzle<Vec4, T, 2, 0, 0, 0, 0> xxxx;
+					Swizzle<Vec4, T, 2, 0, 0, 0, 1> xxxy;
+					Swizzle<Vec4, T, 2, 0, 0, 1, 0> xxyx;
+					Swizzle<Vec4, T, 2, 0, 0, 1, 1> xxyy;
+					Swizzle<Vec4, T, 2, 0, 1, 0, 0> xyxx;
+					Swizzle<Vec4, T, 2, 0, 1, 0, 1> xyxy;
+					Swizzle<Vec4, T, 2, 0, 1, 1, 0> xyyx;
+					Swizzle<Vec4, T, 2, 0, 1, 1, 1> xyyy;
+					Swizzle<Vec4, T, 2, 1, 0, 0, 0> yxxx;
+					Swizzle<Vec4, T, 2, 1, 0, 0, 1> yxxy;
+					Swizzle<Vec4, T, 2, 1, 0, 1, 0> yxyx;
+					Swizzle<Vec4, T, 2, 1, 0, 1, 1> yxyy;
+					Swizzle<Vec4, T, 2, 1, 1, 0, 0> yyxx;
+					Swizzle<Vec4, T, 2, 1, 1, 0, 1> yyxy;
+					Swizzle<Vec4, T, 2, 1, 1, 1, 0> yyyx;
+					Swizzle<Vec4, T, 2, 1, 1, 1, 1> yyyy;
+				#endif
 
 			};
 
-			Vec2();
-			Vec2(std::initializer_list<T> args);
-			Vec2(const T x, const T y);
-			Vec2(const T scalar);
-			Vec2(const Vec2<T>& vector);
+			#ifndef VISAGE_MATH_SWIZZLE_UNION
+		private:
+				constexpr std::array<T*, 2> ComponentPointers()
+				{
+					return {{ &x, &y }};
+				}
+
+		public:
+				// Swizzles, v.zyx() reads the components as a Vec3 and assigning to v.zy() writes them back. Swizzles
+				// repeating a component, like v.xx(), only read them
+				constexpr const Vec2<T> xx() const { return Vec2<T>(x, x); }
+				constexpr SwizzleProxy<Vec2, T, 0, 1> xy() { return SwizzleProxy<Vec2, T, 0, 1>(ComponentPointers()); }
+				constexpr Vec2<T> xy() const { return Vec2<T>(x, y); }
+				constexpr SwizzleProxy<Vec2, T, 1, 0> yx() { return SwizzleProxy<Vec2, T, 1, 0>(ComponentPointers()); }
+				constexpr Vec2<T> yx() const { return Vec2<T>(y, x); }
+				constexpr const Vec2<T> yy() const { return Vec2<T>(y, y); }
+
+				constexpr const Vec3<T> xxx() const { return Vec3<T>(x, x, x); }
+				constexpr const Vec3<T> xxy() const { return Vec3<T>(x, x, y); }
+				constexpr const Vec3<T> xyx() const { return Vec3<T>(x, y, x); }
+				constexpr const Vec3<T> xyy() const { return Vec3<T>(x, y, y); }
+				constexpr const Vec3<T> yxx() const { return Vec3<T>(y, x, x); }
+				constexpr const Vec3<T> yxy() const { return Vec3<T>(y, x, y); }
+				constexpr const Vec3<T> yyx() const { return Vec3<T>(y, y, x); }
+				constexpr const Vec3<T> yyy() const { return Vec3<T>(y, y, y); }
+
+				constexpr const Vec4<T> xxxx() const { return Vec4<T>(x, x, x, x); }
+				constexpr const Vec4<T> xxxy() const { return Vec4<T>(x, x, x, y); }
+				constexpr const Vec4<T> xxyx() const { return Vec4<T>(x, x, y, x); }
+				constexpr const Vec4<T> xxyy() const { return Vec4<T>(x, x, y, y); }
+				constexpr const Vec4<T> xyxx() const { return Vec4<T>(x, y, x, x); }
+				constexpr const Vec4<T> xyxy() const { return Vec4<T>(x, y, x, y); }
+				constexpr const Vec4<T> xyyx() const { return Vec4<T>(x, y, y, x); }
+				constexpr const Vec4<T> xyyy() const { return Vec4<T>(x, y, y, y); }
+				constexpr const Vec4<T> yxxx() const { return Vec4<T>(y, x, x, x); }
+				constexpr const Vec4<T> yxxy() const { return Vec4<T>(y, x, x, y); }
+				constexpr const Vec4<T> yxyx() const { return Vec4<T>(y, x, y, x); }
+				constexpr const Vec4<T> yxyy() const { return Vec4<T>(y, x, y, y); }
+				constexpr const Vec4<T> yyxx() const { return Vec4<T>(y, y, x, x); }
+				constexpr const Vec4<T> yyxy() const { return Vec4<T>(y, y, x, y); }
+				constexpr const Vec4<T> yyyx() const { return Vec4<T>(y, y, y, x); }
+				constexpr const Vec4<T> yyyy() const { return Vec4<T>(y, y, y, y); }
+			#endif
+
+			constexpr Vec2();
+			constexpr Vec2(std::initializer_list<T> args);
+			constexpr Vec2(const T x, const T y);
+			constexpr Vec2(const T scalar);
+			Vec2(const Vec2<T>& vector) = default;
 
 			~Vec2() = default;
 
 			T Magnitude() const;
-			T SqrMagnitude() const;
+			constexpr T SqrMagnitude() const;
 			Vec2<T> Normalized() const;
 			Vec2<T>& Normalize();
-			Vec2<T> Renormalized() const;
-			Vec2<T>& Renormalize();
-			Vec2<T> Negated() const;
-			Vec2<T>& Negate();
-
-			static T Dot(const Vec2<T>& leftVector, const Vec2<T>& rightVector);
-			static Vec2<T> Project(const Vec2<T>& leftVector, const Vec2<T>& rightVector);
-			static Vec2<T> Reject(const Vec2<T>& leftVector, const Vec2<T>& rightVector);
-			static Vec2<T> Lerp(const Vec2<T>& leftVector, const Vec2<T>& rightVector, const T t);
-			static Vec2<T> Zero();
-			static Vec2<T> XAxis();
-			static Vec2<T> YAxis();
-			static Vec2<T> Up();
-			static Vec2<T> Down();
-			static Vec2<T> Left();
-			static Vec2<T> Right();
-
-			Vec2<T>& operator=(const Vec2<T>& vector);
-			Vec2<T>& operator+=(const Vec2<T>& vector);
-			Vec2<T>& operator-=(const Vec2<T>& vector);
-
-			Vec2<T>& operator*=(const T scalar);
-			Vec2<T>& operator/=(const T scalar);
-
-			friend bool operator==(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
+			constexpr Vec2<T> Renormalized() const;
+			constexpr Vec2<T>& Renormalize();
+			constexpr Vec2<T> Negated() const;
+			constexpr Vec2<T>& Negate();
+
+			static constexpr T Dot(const Vec2<T>& leftVector, const Vec2<T>& rightVector);
+			static constexpr Vec2<T> Project(const Vec2<T>& leftVector, const Vec2<T>& rightVector);
+			static constexpr Vec2<T> Reject(const Vec2<T>& leftVector, const Vec2<T>& rightVector);
+			static constexpr Vec2<T> Lerp(const Vec2<T>& leftVector, const Vec2<T>& rightVector, const T t);
+			static constexpr Vec2<T> Zero();
+			static constexpr Vec2<T> XAxis();
+			static constexpr Vec2<T> YAxis();
+			static constexpr Vec2<T> Up();
+			static constexpr Vec2<T> Down();
+			static constexpr Vec2<T> Left();
+			static constexpr Vec2<T> Right();
+
+			Vec2<T>& operator=(const Vec2<T>& vector) = default;
+			constexpr Vec2<T>& operator+=(const Vec2<T>& vector);
+			constexpr Vec2<T>& operator-=(const Vec2<T>& vector);
+
+			constexpr Vec2<T>& operator*=(const T scalar);
+			constexpr Vec2<T>& operator/=(const T scalar);
+
+			friend constexpr bool operator==(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
 			{
 				return NearEquals(leftVector.x, rightVector.x) &&
 					NearEquals(leftVector.y, rightVector.y);
 			}
 
-			friend bool operator!=(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
+			friend constexpr bool operator!=(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
 			{
 				return !(leftVector == rightVector);
 			}
 
-			friend Vec2<T> operator+(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
+			friend constexpr Vec2<T> operator+(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
 			{
-				Vec2<T> leftVectorCopy = leftVector;
-				return leftVectorCopy += rightVector;
+				return Vec2<T>(leftVector.x + rightVector.x, leftVector.y + rightVector.y);
 			}
 
-			friend Vec2<T> operator-(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
+			friend constexpr Vec2<T> operator-(const Vec2<T>& leftVector, const Vec2<T>& rightVector)
 			{
-				Vec2<T> leftVectorCopy = leftVector;
-				return leftVectorCopy -= rightVector;
+				return Vec2<T>(leftVector.x - rightVector.x, leftVector.y - rightVector.y);
 			}
 
-			friend Vec2<T> operator*(const Vec2<T>& vector, const T scalar)
+			friend constexpr Vec2<T> operator*(const Vec2<T>& vector, const T scalar)
 			{
-				Vec2<T> vectorCopy = vector;
-				return vectorCopy *= scalar;
+				return Vec2<T>(vector.x * scalar, vector.y * scalar);
 			}
 
-			friend Vec2<T> operator*(const T scalar, const Vec2<T>& vector)
+			friend constexpr Vec2<T> operator*(const T scalar, const Vec2<T>& vector)
 			{
-				Vec2<T> vectorCopy = vector;
-				return vectorCopy *= scalar;
+				return Vec2<T>(scalar * vector.x, scalar * vector.y);
 			}
 
-			friend Vec2<T> operator/(const Vec2<T>& vector, const T scalar)
+			friend constexpr Vec2<T> operator/(const Vec2<T>& vector, const T scalar)
 			{
-				Vec2<T> vectorCopy = vector;
-				return vectorCopy /= scalar;
+				return Vec2<T>(vector.x / scalar, vector.y / scalar);
 			}
 
-			friend Vec2<T> operator/(const T scalar, const Vec2<T>& vector)
+			friend constexpr Vec2<T> operator/(const T scalar, const Vec2<T>& vector)
 			{
-				Vec2<T> vectorCopy = vector;
-				return vectorCopy /= scalar;
+				return Vec2<T>(scalar / vector.x, scalar / vector.y);
 			}
 
 			friend std::ostream& operator<<(std::ostream& stream, const Vec2<T>& vector)
@@ -21,213 +21,352 @@ namespace Visage
 					T x, y, z;
 				};
 
-				Swizzle<Vec2, T, 3, 0, 0> xx;
-				Swizzle<Vec2, T, 3, 0, 1> xy;
-				Swizzle<Vec2, T, 3, 0, 2> xz;
-				Swizzle<Vec2, T, 3, 1, 0> yx;
-				Swizzle<Vec2, T, 3, 1, 1> yy;
-				Swizzle<Vec2, T, 3, 1, 2> yz;
-				Swizzle<Vec2, T, 3, 2, 0> zx;
-				Swizzle<Vec2, T, 3, 2, 1> zy;
-				Swizzle<Vec2, T, 3, 2, 2> zz;
-
-				Swizzle<Vec3, T, 3, 0, 0, 0> xxx;
-				Swizzle<Vec3, T, 3, 0, 0, 1> xxy;
-				Swizzle<Vec3, T, 3, 0, 0, 2> xxz;
-				Swizzle<Vec3, T, 3, 0, 1, 0> xyx;
-				Swizzle<Vec3, T, 3, 0, 1, 1> xyy;
-				Swizzle<Vec3, T, 3, 0, 1, 2> xyz;
-				Swizzle<Vec3, T, 3, 0, 2, 0> xzx;
-				Swizzle<Vec3, T, 3, 0, 2, 1> xzy;
-				Swizzle<Vec3, T, 3, 0, 2, 2> xzz;
-				Swizzle<Vec3, T, 3, 1, 0, 0> yxx;
-				Swizzle<Vec3, T, 3, 1, 0, 1> yxy;
-				Swizzle<Vec3, T, 3, 1, 0, 2> yxz;
-				Swizzle<Vec3, T, 3, 1, 1, 0> yyx;
-				Swizzle<Vec3, T, 3, 1, 1, 1> yyy;
-				Swizzle<Vec3, T, 3, 1, 1, 2> yyz;
-				Swizzle<Vec3, T, 3, 1, 2, 0> yzx;
-				Swizzle<Vec3, T, 3, 1, 2, 1> yzy;
-				Swizzle<Vec3, T, 3, 1, 2, 2> yzz;
-				Swizzle<Vec3, T, 3, 2, 0, 0> zxx;
-				Swizzle<Vec3, T, 3, 2, 0, 1> zxy;
-				Swizzle<Vec3, T, 3, 2, 0, 2> zxz;
-				Swizzle<Vec3, T, 3, 2, 1, 0> zyx;
-				Swizzle<Vec3, T, 3, 2, 1, 1> zyy;
-				Swizzle<Vec3, T, 3, 2, 1, 2> zyz;
-				Swizzle<Vec3, T, 3, 2, 2, 0> zzx;
-				Swizzle<Vec3, T, 3, 2, 2, 1> zzy;
-				Swizzle<Vec3, T, 3, 2, 2, 2> zzz;
-
-				Swizzle<Vec4, T, 3, 0, 0, 0, 0> xxxx;
-				Swizzle<Vec4, T, 3, 0, 0, 0, 1> xxxy;
-				Swizzle<Vec4, T, 3, 0, 0, 0, 2> xxxz;
-				Swizzle<Vec4, T, 3, 0, 0, 1, 0> xxyx;
-				Swizzle<Vec4, T, 3, 0, 0, 1, 1> xxyy;
-				Swizzle<Vec4, T, 3, 0, 0, 1, 2> xxyz;
-				Swizzle<Vec4, T, 3, 0, 0, 2, 0> xxzx;
-				Swizzle<Vec4, T, 3, 0, 0, 2, 1> xxzy;
-				Swizzle<Vec4, T, 3, 0, 0, 2, 2> xxzz;
-				Swizzle<Vec4, T, 3, 0, 1, 0, 0> xyxx;
-				Swizzle<Vec4, T, 3, 0, 1, 0, 1> xyxy;
-				Swizzle<Vec4, T, 3, 0, 1, 0, 2> xyxz;
-				Swizzle<Vec4, T, 3, 0, 1, 1, 0> xyyx;
-				Swizzle<Vec4, T, 3, 0, 1, 1, 1> xyyy;
-				Swizzle<Vec4, T, 3, 0, 1, 1, 2> xyyz;
-				Swizzle<Vec4, T, 3, 0, 1, 2, 0> xyzx;
-				Swizzle<Vec4, T, 3, 0, 1, 2, 1> xyzy;
-				Swizzle<Vec4, T, 3, 0, 1, 2, 2> xyzz;
-				Swizzle<Vec4, T, 3, 0, 2, 0, 0> xzxx;
-				Swizzle<Vec4, T, 3, 0, 2, 0, 1> xzxy;
-				Swizzle<Vec4, T, 3, 0, 2, 0, 2> xzxz;
-				Swizzle<Vec4, T, 3, 0, 2, 1, 0> xzyx;
-				Swizzle<Vec4, T, 3, 0, 2, 1, 1> xzyy;
-				Swizzle<Vec4, T, 3, 0, 2, 1, 2> xzyz;
-				Swizzle<Vec4, T, 3, 0, 2, 2, 0> xzzx;
-				Swizzle<Vec4, T, 3, 0, 2, 2, 1> xzzy;
-				Swizzle<Vec4, T, 3, 0, 2, 2, 2> xzzz;
-				Swizzle<Vec4, T, 3, 1, 0, 0, 0> yxxx;
-				Swizzle<Vec4, T, 3, 1, 0, 0, 1> yxxy;
-				Swizzle<Vec4, T, 3, 1, 0, 0, 2> yxxz;
-				Swizzle<Vec4, T, 3, 1, 0, 1, 0> yxyx;
-				Swizzle<Vec4, T, 3, 1, 0, 1, 1> yxyy;
-				Swizzle<Vec4, T, 3, 1, 0, 1, 2> yxyz;
-				Swizzle<Vec4, T, 3, 1, 0, 2, 0> yxzx;
-				Swizzle<Vec4, T, 3, 1, 0, 2, 1> yxzy;
-				Swizzle<Vec4, T, 3, 1, 0, 2, 2> yxzz;
-				Swizzle<Vec4, T, 3, 1, 1, 0, 0> yyxx;
-				Swizzle<Vec4, T, 3, 1, 1, 0, 1> yyxy;
-				Swizzle<Vec4, T, 3, 1, 1, 0, 2> yyxz;
-				Swizzle<Vec4, T, 3, 1, 1, 1, 0> yyyx;
-				Swizzle<Vec4, T, 3, 1, 1, 1, 1> yyyy;
-				Swizzle<Vec4, T, 3, 1, 1, 1, 2> yyyz;
-				Swizzle<Vec4, T, 3, 1, 1, 2, 0> yyzx;
-				Swizzle<Vec4, T, 3, 1, 1, 2, 1> yyzy;
-				Swizzle<Vec4, T, 3, 1, 1, 2, 2> yyzz;
-				Swizzle<Vec4, T, 3, 1, 2, 0, 0> yzxx;
-				Swizzle<Vec4, T, 3, 1, 2, 0, 1> yzxy;
-				Swizzle<Vec4, T, 3, 1, 2, 0, 2> yzxz;
-				Swizzle<Vec4, T, 3, 1, 2, 1, 0> yzyx;
-				Swizzle<Vec4, T, 3, 1, 2, 1, 1> yzyy;
-				Swizzle<Vec4, T, 3, 1, 2, 1, 2> yzyz;
-				Swizzle<Vec4, T, 3, 1, 2, 2, 0> yzzx;
-				Swizzle<Vec4, T, 3, 1, 2, 2, 1> yzzy;
-				Swizzle<Vec4, T, 3, 1, 2, 2, 2> yzzz;
-				Swizzle<Vec4, T, 3, 2, 0, 0, 0> zxxx;
-				Swizzle<Vec4, T, 3, 2, 0, 0, 1> zxxy;
-				Swizzle<Vec4, T, 3, 2, 0, 0, 2> zxxz;
-				Swizzle<Vec4, T, 3, 2, 0, 1, 0> zxyx;
-				Swizzle<Vec4, T, 3, 2, 0, 1, 1> zxyy;
-				Swizzle<Vec4, T, 3, 2, 0, 1, 2> zxyz;
-				Swizzle<Vec4, T, 3, 2, 0, 2, 0> zxzx;
-				Swizzle<Vec4, T, 3, 2, 0, 2, 1> zxzy;
-				Swizzle<Vec4, T, 3, 2, 0, 2, 2> zxzz;
-				Swizzle<Vec4, T, 3, 2, 1, 0, 0> zyxx;
-				Swizzle<Vec4, T, 3, 2, 1, 0, 1> zyxy;
-				Swizzle<Vec4, T, 3, 2, 1, 0, 2> zyxz;
-				Swizzle<Vec4, T, 3, 2, 1, 1, 0> zyyx;
-				Swizzle<Vec4, T, 3, 2, 1, 1, 1> zyyy;
-				Swizzle<Vec4, T, 3, 2, 1, 1, 2> zyyz;
-				Swizzle<Vec4, T, 3, 2, 1, 2, 0> zyzx;
-				Swizzle<Vec4, T, 3, 2, 1, 2, 1> zyzy;
-				Swizzle<Vec4, T, 3, 2, 1, 2, 2> zyzz;
-				Swizzle<Vec4, T, 3, 2, 2, 0, 0> zzxx;
-				Swizzle<Vec4, T, 3, 2, 2, 0, 1> zzxy;
-				Swizzle<Vec4, T, 3, 2, 2, 0, 2> zzxz;
-				Swizzle<Vec4, T, 3, 2, 2, 1, 0> zzyx;
-				Swizzle<Vec4, T, 3, 2, 2, 1, 1> zzyy;
-				Swizzle<Vec4, T, 3, 2, 2, 1, 2> zzyz;
-				Swizzle<Vec4, T, 3, 2, 2, 2, 0> zzzx;
-				Swizzle<Vec4, T, 3, 2, 2, 2, 1> zzzy;
-				Swizzle<Vec4, T, 3, 2, 2, 2, 2> zzzz;
+				#ifdef VISAGE_MATH_SWIZZLE_UNION
+					Swizzle<Vec2, T, 3, 0, 0> xx;
+					Swizzle<Vec2, T, 3, 0, 1> xy;
+					Swizzle<Vec2, T, 3, 0, 2> xz;
+					Swizzle<Vec2, T, 3, 1, 0> yx;
+					Swizzle<Vec2, T, 3, 1, 1> yy;
+					Swizzle<Vec2, T, 3, 1, 2> yz;
+					Swizzle<Vec2, T, 3, 2, 0> zx;
+					Swizzle<Vec2, T, 3, 2, 1> zy;
+					Swizzle<Vec2, T, 3, 2, 2> zz;
+
+					Swizzle<Vec3, T, 3, 0, 0, 0> xxx;
+					Swizzle<Vec3, T, 3, 0, 0, 1> xxy;
+					Swizzle<Vec3, T, 3, 0, 0, 2> xxz;
+					Swizzle<Vec3, T, 3, 0, 1, 0> xyx;
+					Swizzle<Vec3, T, 3, 0, 1, 1> xyy;
+					Swizzle<Vec3, T, 3, 0, 1, 2> xyz;
+					Swizzle<Vec3, T, 3, 0, 2, 0> xzx;
+					Swizzle<Vec3, T, 3, 0, 2, 1> xzy;
+					Swizzle<Vec3, T, 3, 0, 2, 2> xzz;
+					Swizzle<Vec3, T, 3, 1, 0, 0> yxx;
+					Swizzle<Vec3, T, 3, 1, 0, 1> yxy;
+					Swizzle<Vec3, T, 3, 1, 0, 2> yxz;
+					Swizzle<Vec3, T, 3, 1, 1, 0> yyx;
+					Swizzle<Vec3, T, 3, 1, 1, 1> yyy;
+					Swizzle<Vec3, T, 3, 1, 1, 2> yyz;
+					Swizzle<Vec3, T, 3, 1, 2, 0> yzx;
+					Swizzle<Vec3, T, 3, 1, 2, 1> yzy;
+					Swizzle<Vec3, T, 3, 1, 2, 2> yzz;
+					Swizzle<Vec3, T, 3, 2, 0, 0> zxx;
+					Swizzle<Vec3, T, 3, 2, 0, 1> zxy;
+					Swizzle<Vec3, T, 3, 2, 0, 2> zxz;
+					Swizzle<Vec3, T, 3, 2, 1, 0> zyx;
+					Swizzle<Vec3, T, 3, 2, 1, 1> zyy;
+					Swizzle<Vec3, T, 3, 2, 1, 2> zyz;
+					Swizzle<Vec3, T, 3, 2, 2, 0> zzx;
+					Swizzle<Vec3, T, 3, 2, 2, 1> zzy;
+					Swizzle<Vec3, T, 3, 2, 2, 2> zzz;
+
+					Swizzle<Vec4, T, 3, 0, 0, 0, 0> xxxx;
+					Swizzle<Vec4, T, 3, 0, 0, 0, 1> xxxy;
+					Swizzle<Vec4, T, 3, 0, 0, 0, 2> xxxz;
+					Swizzle<Vec4, T, 3, 0, 0, 1, 0> xxyx;
+					Swizzle<Vec4, T, 3, 0, 0, 1, 1> xxyy;
+					Swizzle<Vec4, T, 3, 0, 0, 1, 2> xxyz;
+					Swizzle<Vec4, T, 3, 0, 0, 2, 0> xxzx;
+					Swizzle<Vec4, T, 3, 0, 0, 2, 1> xxzy;
+					Swizzle<Vec4, T, 3, 0, 0, 2, 2> xxzz;
+					Swizzle<Vec4, T, 3, 0, 1, 0, 0> xyxx;
+					Swizzle<Vec4, T, 3, 0, 1, 0, 1> xyxy;
+					Swizzle<Vec4, T, 3, 0, 1, 0, 2> xyxz;
+					Swizzle<Vec4, T, 3, 0, 1, 1, 0> xyyx;
+					Swizzle<Vec4, T, 3, 0, 1, 1, 1> xyyy;
+					Swizzle<Vec4, T, 3, 0, 1, 1, 2> xyyz;
+					Swizzle<Vec4, T, 3, 0, 1, 2, 0> xyzx;
+					Swizzle<Vec4, T, 3, 0, 1, 2, 1> xyzy;
+					Swizzle<Vec4, T, 3, 0, 1, 2, 2> xyzz;
+					Swizzle<Vec4, T, 3, 0, 2, 0, 0> xzxx;
+					Swizzle<Vec4, T, 3, 0, 2, 0, 1> xzxy;
+					Swizzle<Vec4, T, 3, 0, 2, 0, 2> xzxz;
+					Swizzle<Vec4, T, 3, 0, 2, 1, 0> xzyx;
+					Swizzle<Vec4, T, 3, 0, 2, 1, 1> xzyy;
+					Swizzle<Vec4, T, 3, 0, 2, 1, 2> xzyz;
+					Swizzle<Vec4, T, 3, 0, 2, 2, 0> xzzx;
+					Swizzle<Vec4, T, 3, 0, 2, 2, 1> xzzy;
+					Swizzle<Vec4, T, 3, 0, 2, 2, 2> xzzz;
+					Swizzle<Vec4, T, 3, 1, 0, 0, 0> yxxx;
+					Swizzle<Vec4, T, 3, 1, 0, 0, 1> yxxy;
+					Swizzle<Vec4, T, 3, 1, 0, 0, 2> yxxz;
+					Swizzle<Vec4, T, 3, 1, 0, 1, 0> yxyx;
+					Swizzle<Vec4, T, 3, 1, 0, 1, 1> yxyy;
+					Swizzle<Vec4, T, 3, 1, 0, 1, 2> yxyz;
+					Swizzle<Vec4, T, 3, 1, 0, 2, 0> yxzx;
+					Swizzle<Vec4, T, 3, 1, 0, 2, 1> yxzy;
+					Swizzle<Vec4, T, 3, 1, 0, 2, 2> yxzz;
+					Swizzle<Vec4, T, 3, 1, 1, 0, 0> yyxx;
+					Swizzle<Vec4, T, 3, 1, 1, 0, 1> yyxy;
+					Swizzle<Vec4, T, 3, 1, 1, 0, 2> yyxz;
+					Swizzle<Vec4, T, 3, 1, 1, 1, 0> yyyx;
+					Swizzle<Vec4, T, 3, 1, 1, 1, 1> yyyy;
+					Swizzle<Vec4, T, 3, 1, 1, 1, 2> yyyz;
+					Swizzle<Vec4, T, 3, 1, 1, 2, 0> yyzx;
+					Swizzle<Vec4, T, 3, 1, 1, 2, 1> yyzy;
+					Swizzle<Vec4, T, 3, 1, 1, 2, 2> yyzz;
+					Swizzle<Vec4, T, 3, 1, 2, 0, 0> yzxx;
+					Swizzle<Vec4, T, 3, 1, 2, 0, 1> yzxy;
+					Swizzle<Vec4, T, 3, 1, 2, 0, 2> yzxz;
+					Swizzle<Vec4, T, 3, 1, 2, 1, 0> yzyx;
+					Swizzle<Vec4, T, 3, 1, 2, 1, 1> yzyy;
+					Swizzle<Vec4, T, 3, 1, 2, 1, 2> yzyz;
+					Swizzle<Vec4, T, 3, 1, 2, 2, 0> yzzx;
+					Swizzle<Vec4, T, 3, 1, 2, 2, 1> yzzy;
+					Swizzle<Vec4, T, 3, 1, 2, 2, 2> yzzz;
+					Swizzle<Vec4, T, 3, 2, 0, 0, 0> zxxx;
+					Swizzle<Vec4, T, 3, 2, 0, 0, 1> zxxy;
+					Swizzle<Vec4, T, 3, 2, 0, 0, 2> zxxz;
+					Swizzle<Vec4, T, 3, 2, 0, 1, 0> zxyx;
+					Swizzle<Vec4, T, 3, 2, 0, 1, 1> zxyy;
+					Swizzle<Vec4, T, 3, 2, 0, 1, 2> zxyz;
+					Swizzle<Vec4, T, 3, 2, 0, 2, 0> zxzx;
+					Swizzle<Vec4, T, 3, 2, 0, 2, 1> zxzy;
+					Swizzle<Vec4, T, 3, 2, 0, 2, 2> zxzz;
+					Swizzle<Vec4, T, 3, 2, 1, 0, 0> zyxx;
+					Swizzle<Vec4, T, 3, 2, 1, 0, 1> zyxy;
+					Swizzle<Vec4, T, 3, 2, 1, 0, 2> zyxz;
+					Swizzle<Vec4, T, 3, 2, 1, 1, 0> zyyx;
+					Swizzle<Vec4, T, 3, 2, 1, 1, 1> zyyy;
+					Swizzle<Vec4, T, 3, 2, 1, 1, 2> zyyz;
+					Swizzle<Vec4, T, 3, 2, 1, 2, 0> zyzx;
+					Swizzle<Vec4, T, 3, 2, 1, 2, 1> zyzy;
+					Swizzle<Vec4, T, 3, 2, 1, 2, 2> zyzz;
+					Swizzle<Vec4, T, 3, 2, 2, 0, 0> zzxx;
+					Swizzle<Vec4, T, 3, 2, 2, 0, 1> zzxy;
+					Swizzle<Vec4, T, 3, 2, 2, 0, 2> zzxz;
+					Swizzle<Vec4, T, 3, 2, 2, 1, 0> zzyx;
+					Swizzle<Vec4, T, 3, 2, 2, 1, 1> zzyy;
+					Swizzle<Vec4, T, 3, 2, 2, 1, 2> zzyz;
+					Swizzle<Vec4, T, 3, 2, 2, 2, 0> zzzx;
+					Swizzle<Vec4, T, 3, 2, 2, 2, 1> zzzy;
+					Swizzle<Vec4, T, 3, 2, 2, 2, 2> zzzz;
+				#endif
 			};
 
-			Vec3();
+			#ifndef VISAGE_MATH_SWIZZLE_UNION
+		private:
+				constexpr std::array<T*, 3> ComponentPointers()
+				{
+					return {{ &x, &y, &z }};
+				}
+
+		public:
+				// Swizzles, v.zyx() reads the components as a Vec3 and assigning to v.zy() writes them back. Swizzles
+				// repeating a component, like v.xx(), only read them
+				constexpr const Vec2<T> xx() const { return Vec2<T>(x, x); }
+				constexpr SwizzleProxy<Vec2, T, 0, 1> xy() { return SwizzleProxy<Vec2, T, 0, 1>(ComponentPointers()); }
+				constexpr Vec2<T> xy() const { return Vec2<T>(x, y); }
+				constexpr SwizzleProxy<Vec2, T, 0, 2> xz() { return SwizzleProxy<Vec2, T, 0, 2>(ComponentPointers()); }
+				constexpr Vec2<T> xz() const { return Vec2<T>(x, z); }
+				constexpr SwizzleProxy<Vec2, T, 1, 0> yx() { return SwizzleProxy<Vec2, T, 1, 0>(ComponentPointers()); }
+				constexpr Vec2<T> yx() const { return Vec2<T>(y, x); }
+				constexpr const Vec2<T> yy() const { return Vec2<T>(y, y); }
+				constexpr SwizzleProxy<Vec2, T, 1, 2> yz() { return SwizzleProxy<Vec2, T, 1, 2>(ComponentPointers()); }
+				constexpr Vec2<T> yz() const { return Vec2<T>(y, z); }
+				constexpr SwizzleProxy<Vec2, T, 2, 0> zx() { return SwizzleProxy<Vec2, T, 2, 0>(ComponentPointers()); }
+				constexpr Vec2<T> zx() const { return Vec2<T>(z, x); }
+				constexpr SwizzleProxy<Vec2, T, 2, 1> zy() { return SwizzleProxy<Vec2, T, 2, 1>(ComponentPointers()); }
+				constexpr Vec2<T> zy() const { return Vec2<T>(z, y); }
+				constexpr const Vec2<T> zz() const { return Vec2<T>(z, z); }
+
+				constexpr const Vec3<T> xxx() const { return Vec3<T>(x, x, x); }
+				constexpr const Vec3<T> xxy() const { return Vec3<T>(x, x, y); }
+				constexpr const Vec3<T> xxz() const { return Vec3<T>(x, x, z); }
+				constexpr const Vec3<T> xyx() const { return Vec3<T>(x, y, x); }
+				constexpr const Vec3<T> xyy() const { return Vec3<T>(x, y, y); }
+				constexpr SwizzleProxy<Vec3, T, 0, 1, 2> xyz() { return SwizzleProxy<Vec3, T, 0, 1, 2>(ComponentPointers()); }
+				constexpr Vec3<T> xyz() const { return Vec3<T>(x, y, z); }
+				constexpr const Vec3<T> xzx() const { return Vec3<T>(x, z, x); }
+				constexpr SwizzleProxy<Vec3, T, 0, 2, 1> xzy() { return SwizzleProxy<Vec3, T, 0, 2, 1>(ComponentPointers()); }
+				constexpr Vec3<T> xzy() const { return Vec3<T>(x, z, y); }
+				constexpr const Vec3<T> xzz() const { return Vec3<T>(x, z, z); }
+				constexpr const Vec3<T> yxx() const { return Vec3<T>(y, x, x); }
+				constexpr const Vec3<T> yxy() const { return Vec3<T>(y, x, y); }
+				constexpr SwizzleProxy<Vec3, T, 1, 0, 2> yxz() { return SwizzleProxy<Vec3, T, 1, 0, 2>(ComponentPointers()); }
+				constexpr Vec3<T> yxz() const { return Vec3<T>(y, x, z); }
+				constexpr const Vec3<T> yyx() const { return Vec3<T>(y, y, x); }
+				constexpr const Vec3<T> yyy() const { return Vec3<T>(y, y, y); }
+				constexpr const Vec3<T> yyz() const { return Vec3<T>(y, y, z); }
+				constexpr SwizzleProxy<Vec3, T, 1, 2, 0> yzx() { return SwizzleProxy<Vec3, T, 1, 2, 0>(ComponentPointers()); }
+				constexpr Vec3<T> yzx() const { return Vec3<T>(y, z, x); }
+				constexpr const Vec3<T> yzy() const { return Vec3<T>(y, z, y); }
+				constexpr const Vec3<T> yzz() const { return Vec3<T>(y, z, z); }
+				constexpr const Vec3<T> zxx() const { return Vec3<T>(z, x, x); }
+				constexpr SwizzleProxy<Vec3, T, 2, 0, 1> zxy() { return SwizzleProxy<Vec3, T, 2, 0, 1>(ComponentPointers()); }
+				constexpr Vec3<T> zxy() const { return Vec3<T>(z, x, y); }
+				constexpr const Vec3<T> zxz() const { return Vec3<T>(z, x, z); }
+				constexpr SwizzleProxy<Vec3, T, 2, 1, 0> zyx() { return SwizzleProxy<Vec3, T, 2, 1, 0>(ComponentPointers()); }
+				constexpr Vec3<T> zyx() const { return Vec3<T>(z, y, x); }
+				constexpr const Vec3<T> zyy() const { return Vec3<T>(z, y, y); }
+				constexpr const Vec3<T> zyz() const { return Vec3<T>(z, y, z); }
+				constexpr const Vec3<T> zzx() const { return Vec3<T>(z, z, x); }
+				constexpr const Vec3<T> zzy() const { return Vec3<T>(z, z, y); }
+				constexpr const Vec3<T> zzz() const { return Vec3<T>(z, z, z); }
+
+				constexpr const Vec4<T> xxxx() const { return Vec4<T>(x, x, x, x); }
+				constexpr const Vec4<T> xxxy() const { return Vec4<T>(x, x, x, y); }
+				constexpr const Vec4<T> xxxz() const { return Vec4<T>(x, x, x, z); }
+				constexpr const Vec4<T> xxyx() const { return Vec4<T>(x, x, y, x); }
+				constexpr const Vec4<T> xxyy() const { return Vec4<T>(x, x, y, y); }
+				constexpr const Vec4<T> xxyz() const { return Vec4<T>(x, x, y, z); }
+				constexpr const Vec4<T> xxzx() const { return Vec4<T>(x, x, z, x); }
+				constexpr const Vec4<T> xxzy() const { return Vec4<T>(x, x, z, y); }
+				constexpr const Vec4<T> xxzz() const { return Vec4<T>(x, x, z, z); }
+				constexpr const Vec4<T> xyxx() const { return Vec4<T>(x, y, x, x); }
+				constexpr const Vec4<T> xyxy() const { return Vec4<T>(x, y, x, y); }
+				constexpr const Vec4<T> xyxz() const { return Vec4<T>(x, y, x, z); }
+				constexpr const Vec4<T> xyyx() const { return Vec4<T>(x, y, y, x); }
+				constexpr const Vec4<T> xyyy() const { return Vec4<T>(x, y, y, y); }
+				constexpr const Vec4<T> xyyz() const { return Vec4<T>(x, y, y, z); }
+				constexpr const Vec4<T> xyzx() const { return Vec4<T>(x, y, z, x); }
+				constexpr const Vec4<T> xyzy() const { return Vec4<T>(x, y, z, y); }
+				constexpr const Vec4<T> xyzz() const { return Vec4<T>(x, y, z, z); }
+				constexpr const Vec4<T> xzxx() const { return Vec4<T>(x, z, x, x); }
+				constexpr const Vec4<T> xzxy() const { return Vec4<T>(x, z, x, y); }
+				constexpr const Vec4<T> xzxz() const { return Vec4<T>(x, z, x, z); }
+				constexpr const Vec4<T> xzyx() const { return Vec4<T>(x, z, y, x); }
+				constexpr const Vec4<T> xzyy() const { return Vec4<T>(x, z, y, y); }
+				constexpr const Vec4<T> xzyz() const { return Vec4<T>(x, z, y, z); }
+				constexpr const Vec4<T> xzzx() const { return Vec4<T>(x, z, z, x); }
+				constexpr const Vec4<T> xzzy() const { return Vec4<T>(x, z, z, y); }
+				constexpr const Vec4<T> xzzz() const { return Vec4<T>(x, z, z, z); }
+				constexpr const Vec4<T> yxxx() const { return Vec4<T>(y, x, x, x); }
+				constexpr const Vec4<T> yxxy() const { return Vec4<T>(y, x, x, y); }
+				constexpr const Vec4<T> yxxz() const { return Vec4<T>(y, x, x, z); }
+				constexpr const Vec4<T> yxyx() const { return Vec4<T>(y, x, y, x); }
+				constexpr const Vec4<T> yxyy() const { return Vec4<T>(y, x, y, y); }
+				constexpr const Vec4<T> yxyz() const { return Vec4<T>(y, x, y, z); }
+				constexpr const Vec4<T> yxzx() const { return Vec4<T>(y, x, z, x); }
+				constexpr const Vec4<T> yxzy() const { return Vec4<T>(y, x, z, y); }
+				constexpr const Vec4<T> yxzz() const { return Vec4<T>(y, x, z, z); }
+				constexpr const Vec4<T> yyxx() const { return Vec4<T>(y, y, x, x); }
+				constexpr const Vec4<T> yyxy() const { return Vec4<T>(y, y, x, y); }
+				constexpr const Vec4<T> yyxz() const { return Vec4<T>(y, y, x, z); }
+				constexpr const Vec4<T> yyyx() const { return Vec4<T>(y, y, y, x); }
+				constexpr const Vec4<T> yyyy() const { return Vec4<T>(y, y, y, y); }
+				constexpr const Vec4<T> yyyz() const { return Vec4<T>(y, y, y, z); }
+				constexpr const Vec4<T> yyzx() const { return Vec4<T>(y, y, z, x); }
+				constexpr const Vec4<T> yyzy() const { return Vec4<T>(y, y, z, y); }
+				constexpr const Vec4<T> yyzz() const { return Vec4<T>(y, y, z, z); }
+				constexpr const Vec4<T> yzxx() const { return Vec4<T>(y, z, x, x); }
+				constexpr const Vec4<T> yzxy() const { return Vec4<T>(y, z, x, y); }
+				constexpr const Vec4<T> yzxz() const { return Vec4<T>(y, z, x, z); }
+				constexpr const Vec4<T> yzyx() const { return Vec4<T>(y, z, y, x); }
+				constexpr const Vec4<T> yzyy() const { return Vec4<T>(y, z, y, y); }
+				constexpr const Vec4<T> yzyz() const { return Vec4<T>(y, z, y, z); }
+				constexpr const Vec4<T> yzzx() const { return Vec4<T>(y, z, z, x); }
+				constexpr const Vec4<T> yzzy() const { return Vec4<T>(y, z, z, y); }
+				constexpr const Vec4<T> yzzz() const { return Vec4<T>(y, z, z, z); }
+				constexpr const Vec4<T> zxxx() const { return Vec4<T>(z, x, x, x); }
+				constexpr const Vec4<T> zxxy() const { return Vec4<T>(z, x, x, y); }
+				constexpr const Vec4<T> zxxz() const { return Vec4<T>(z, x, x, z); }
+				constexpr const Vec4<T> zxyx() const { return Vec4<T>(z, x, y, x); }
+				constexpr const Vec4<T> zxyy() const { return Vec4<T>(z, x, y, y); }
+				constexpr const Vec4<T> zxyz() const { return Vec4<T>(z, x, y, z); }
+				constexpr const Vec4<T> zxzx() const { return Vec4<T>(z, x, z, x); }
+				constexpr const Vec4<T> zxzy() const { return Vec4<T>(z, x, z, y); }
+				constexpr const Vec4<T> zxzz() const { return Vec4<T>(z, x, z, z); }
+				constexpr const Vec4<T> zyxx() const { return Vec4<T>(z, y, x, x); }
+				constexpr const Vec4<T> zyxy() const { return Vec4<T>(z, y, x, y); }
+				constexpr const Vec4<T> zyxz() const { return Vec4<T>(z, y, x, z); }
+				constexpr const Vec4<T> zyyx() const { return Vec4<T>(z, y, y, x); }
+				constexpr const Vec4<T> zyyy() const { return Vec4<T>(z, y, y, y); }
+				constexpr const Vec4<T> zyyz() const { return Vec4<T>(z, y, y, z); }
+				constexpr const Vec4<T> zyzx() const { return Vec4<T>(z, y, z, x); }
+				constexpr const Vec4<T> zyzy() const { return Vec4<T>(z, y, z, y); }
+				constexpr const Vec4<T> zyzz() const { return Vec4<T>(z, y, z, z); }
+				constexpr const Vec4<T> zzxx() const { return Vec4<T>(z, z, x, x); }
+				constexpr const Vec4<T> zzxy() const { return Vec4<T>(z, z, x, y); }
+				constexpr const Vec4<T> zzxz() const { return Vec4<T>(z, z, x, z); }
+				constexpr const Vec4<T> zzyx() const { return Vec4<T>(z, z, y, x); }
+				constexpr const Vec4<T> zzyy() const { return Vec4<T>(z, z, y, y); }
+				constexpr const Vec4<T> zzyz() const { return Vec4<T>(z, z, y, z); }
+				constexpr const Vec4<T> zzzx() const { return Vec4<T>(z, z, z, x); }
+				constexpr const Vec4<T> zzzy() const { return Vec4<T>(z, z, z, y); }
+				constexpr const Vec4<T> zzzz() const { return Vec4<T>(z, z, z, z); }
+			#endif
+
+			constexpr Vec3();
 			Vec3(const Vec3<T>& v) = default;
-			Vec3(std::initializer_list<T> args);
-			Vec3(const T x, const T y, const T z);
-			Vec3(const T value);
+			constexpr Vec3(std::initializer_list<T> args);
+			constexpr Vec3(const T x, const T y, const T z);
+			constexpr Vec3(const T value);
 
 			~Vec3() = default;
 
 			T Magnitude() const;
-			T SqrMagnitude() const;
+			constexpr T SqrMagnitude() const;
 			Vec3<T> Normalize() const;
 			Vec3<T>& Normalized();
-			Vec3<T> Renormalized() const;
-			Vec3<T>& Renormalize();
-			Vec3<T> Negated() const;
-			Vec3<T>& Negate();
-
-			static T Dot(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
-			static Vec3<T> Cross(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
-			static Vec3<T> Project(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
-			static Vec3<T> Reject(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
-			static Vec3<T> Lerp(const Vec3<T>& leftVector, const Vec3<T>& rightVector, const float t);
-			static Vec3<T> Zero();
-			static Vec3<T> XAxis();
-			static Vec3<T> YAxis();
-			static Vec3<T> ZAxis();
-			static Vec3<T> Up();
-			static Vec3<T> Down();
-			static Vec3<T> Left();
-			static Vec3<T> Right();
-			static Vec3<T> Back();
-			static Vec3<T> Forward();
-
-			Vec3<T>& operator=(const Vec3<T>& vector);
-			Vec3<T>& operator+=(const Vec3<T>& vector);
-			Vec3<T>& operator-=(const Vec3<T>& vector);
-
-			Vec3<T>& operator*=(const T scalar);
-			Vec3<T>& operator/=(const T scalar);
-
-			friend bool operator==(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
+			constexpr Vec3<T> Renormalized() const;
+			constexpr Vec3<T>& Renormalize();
+			constexpr Vec3<T> Negated() const;
+			constexpr Vec3<T>& Negate();
+
+			static constexpr T Dot(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
+			static constexpr Vec3<T> Cross(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
+			static constexpr Vec3<T> Project(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
+			static constexpr Vec3<T> Reject(const Vec3<T>& leftVector, const Vec3<T>& rightVector);
+			static constexpr Vec3<T> Lerp(const Vec3<T>& leftVector, const Vec3<T>& rightVector, const float t);
+			static constexpr Vec3<T> Zero();
+			static constexpr Vec3<T> XAxis();
+			static constexpr Vec3<T> YAxis();
+			static constexpr Vec3<T> ZAxis();
+			static constexpr Vec3<T> Up();
+			static constexpr Vec3<T> Down();
+			static constexpr Vec3<T> Left();
+			static constexpr Vec3<T> Right();
+			static constexpr Vec3<T> Back();
+			static constexpr Vec3<T> Forward();
+
+			Vec3<T>& operator=(const Vec3<T>& vector) = default;
+			constexpr Vec3<T>& operator+=(const Vec3<T>& vector);
+			constexpr Vec3<T>& operator-=(const Vec3<T>& vector);
+
+			constexpr Vec3<T>& operator*=(const T scalar);
+			constexpr Vec3<T>& operator/=(const T scalar);
+
+			friend constexpr bool operator==(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
 			{
 				return NearEquals(leftVector.x, rightVector.x) &&
 					NearEquals(leftVector.y, rightVector.y) &&
 					NearEquals(leftVector.z, rightVector.z);
 			}
 
-			friend bool operator!=(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
+			friend constexpr bool operator!=(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
 			{
 				return !(leftVector == rightVector);
 			}
 
-			friend Vec3<T> operator+(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
+			friend constexpr Vec3<T> operator+(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
 			{
-				Vec3<T> leftVectorCopy = leftVector;
-				return leftVectorCopy += rightVector;
+				return Vec3<T>(leftVector.x + rightVector.x, leftVector.y + rightVector.y, leftVector.z + rightVector.z);
 			}
 
-			friend Vec3<T> operator-(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
+			friend constexpr Vec3<T> operator-(const Vec3<T>& leftVector, const Vec3<T>& rightVector)
 			{
-				Vec3<T> leftVectorCopy = leftVector;
-				return leftVectorCopy -= rightVector;
+				return Vec3<T>(leftVector.x - rightVector.x, leftVector.y - rightVector.y, leftVector.z - rightVector.z);
 			}
 
-			friend Vec3<T> operator*(const Vec3<T>& vector, const T scalar)
+			friend constexpr Vec3<T> operator*(const Vec3<T>& vector, const T scalar)
 			{
-				Vec3<T> vectorCopy = vector;
-				return vectorCopy *= scalar;
+				return Vec3<T>(vector.x * scalar, vector.y * scalar, vector.z * scalar);
 			}
 
-			friend Vec3<T> operator*(const T scalar, const Vec3<T>& vector)
+			friend constexpr Vec3<T> operator*(const T scalar, const Vec3<T>& vector)
 			{
-				Vec3<T> vectorCopy = vector;
-				return vectorCopy *= scalar;
+				return Vec3<T>(scalar * vector.x, scalar * vector.y, scalar * vector.z);
 			}
 
-			friend Vec3<T> operator/(const Vec3<T>& vector, const T scalar)
+			friend constexpr Vec3<T> operator/(const Vec3<T>& vector, const T scalar)
 			{
-				Vec3<T> vectorCopy = vector;
-				return vectorCopy /= scalar;
+				return Vec3<T>(vector.x / scalar, vector.y / scalar, vector.z / scalar);
 			}
 
-			friend Vec3<T> operator/(const T scalar, const Vec3<T>& vector)
+			friend constexpr Vec3<T> operator/(const T scalar, const Vec3<T>& vector)
 			{
-				Vec3<T> vectorCopy = vector;
-				return vectorCopy /= scalar;
+				return Vec3<T>(scalar / vector.x, scalar / vector.y, scalar / vector.z);
 			}
 
 			friend std::ostream& operator<<(std::ostream& stream, const Vec3<T>& vector)
@@ -20,376 +20,788 @@ namespace Visage
 					T x, y, z, w;
 				};
 
-				Swizzle<Vec2, T, 4, 0, 0> xx;
-				Swizzle<Vec2, T, 4, 0, 1> xy;
-				Swizzle<Vec2, T, 4, 0, 2> xz;
-				Swizzle<Vec2, T, 4, 0, 3> xw;
-				Swizzle<Vec2, T, 4, 1, 0> yx;
-				Swizzle<Vec2, T, 4, 1, 1> yy;
-				Swizzle<Vec2, T, 4, 1, 2> yz;
-				Swizzle<Vec2, T, 4, 1, 3> yw;
-				Swizzle<Vec2, T, 4, 2, 0> zx;
-				Swizzle<Vec2, T, 4, 2, 1> zy;
-				Swizzle<Vec2, T, 4, 2, 2> zz;
-				Swizzle<Vec2, T, 4, 2, 3> zw;
-				Swizzle<Vec2, T, 4, 3, 0> wx;
-				Swizzle<Vec2, T, 4, 3, 1> wy;
-				Swizzle<Vec2, T, 4, 3, 2> wz;
-				Swizzle<Vec2, T, 4, 3, 3> ww;
+				#ifdef VISAGE_MATH_SWIZZLE_UNION
+					Swizzle<Vec2, T, 4, 0, 0> xx;
+					Swizzle<Vec2, T, 4, 0, 1> xy;
+					Swizzle<Vec2, T, 4, 0, 2> xz;
+					Swizzle<Vec2, T, 4, 0, 3> xw;
+					Swizzle<Vec2, T, 4, 1, 0> yx;
+					Swizzle<Vec2, T, 4, 1, 1> yy;
+					Swizzle<Vec2, T, 4, 1, 2> yz;
+					Swizzle<Vec2, T, 4, 1, 3> yw;
+					Swizzle<Vec2, T, 4, 2, 0> zx;
+					Swizzle<Vec2, T, 4, 2, 1> zy;
+					Swizzle<Vec2, T, 4, 2, 2> zz;
+					Swizzle<Vec2, T, 4, 2, 3> zw;
+					Swizzle<Vec2, T, 4, 3, 0> wx;
+					Swizzle<Vec2, T, 4, 3, 1> wy;
+					Swizzle<Vec2, T, 4, 3, 2> wz;
+					Swizzle<Vec2, T, 4, 3, 3> ww;
 
-				Swizzle<Vec3, T, 4, 0, 0, 0> xxx;
-				Swizzle<Vec3, T, 4, 0, 0, 1> xxy;
-				Swizzle<Vec3, T, 4, 0, 0, 2> xxz;
-				Swizzle<Vec3, T, 4, 0, 0, 3> xxw;
-				Swizzle<Vec3, T, 4, 0, 1, 0> xyx;
-				Swizzle<Vec3, T, 4, 0, 1, 1> xyy;
-				Swizzle<Vec3, T, 4, 0, 1, 2> xyz;
-				Swizzle<Vec3, T, 4, 0, 1, 3> xyw;
-				Swizzle<Vec3, T, 4, 0, 2, 0> xzx;
-				Swizzle<Vec3, T, 4, 0, 2, 1> xzy;
-				Swizzle<Vec3, T, 4, 0, 2, 2> xzz;
-				Swizzle<Vec3, T, 4, 0, 2, 3> xzw;
-				Swizzle<Vec3, T, 4, 0, 3, 0> xwx;
-				Swizzle<Vec3, T, 4, 0, 3, 1> xwy;
-				Swizzle<Vec3, T, 4, 0, 3, 2> xwz;
-				Swizzle<Vec3, T, 4, 0, 3, 3> xww;
-				Swizzle<Vec3, T, 4, 1, 0, 0> yxx;
-				Swizzle<Vec3, T, 4, 1, 0, 1> yxy;
-				Swizzle<Vec3, T, 4, 1, 0, 2> yxz;
-				Swizzle<Vec3, T, 4, 1, 0, 3> yxw;
-				Swizzle<Vec3, T, 4, 1, 1, 0> yyx;
-				Swizzle<Vec3, T, 4, 1, 1, 1> yyy;
-				Swizzle<Vec3, T, 4, 1, 1, 2> yyz;
-				Swizzle<Vec3, T, 4, 1, 1, 3> yyw;
-				Swizzle<Vec3, T, 4, 1, 2, 0> yzx;
-				Swizzle<Vec3, T, 4, 1, 2, 1> yzy;
-				Swizzle<Vec3, T, 4, 1, 2, 2> yzz;
-				Swizzle<Vec3, T, 4, 1, 2, 3> yzw;
-				Swizzle<Vec3, T, 4, 1, 3, 0> ywx;
-				Swizzle<Vec3, T, 4, 1, 3, 1> ywy;
-				Swizzle<Vec3, T, 4, 1, 3, 2> ywz;
-				Swizzle<Vec3, T, 4, 1, 3, 3> yww;
-				Swizzle<Vec3, T, 4, 2, 0, 0> zxx;
-				Swizzle<Vec3, T, 4, 2, 0, 1> zxy;
-				Swizzle<Vec3, T, 4, 2, 0, 2> zxz;
-				Swizzle<Vec3, T, 4, 2, 0, 3> zxw;
-				Swizzle<Vec3, T, 4, 2, 1, 0> zyx;
-				Swizzle<Vec3, T, 4, 2, 1, 1> zyy;
-				Swizzle<Vec3, T, 4, 2, 1, 2> zyz;
-				Swizzle<Vec3, T, 4, 2, 1, 3> zyw;
-				Swizzle<Vec3, T, 4, 2, 2, 0> zzx;
-				Swizzle<Vec3, T, 4, 2, 2, 1> zzy;
-				Swizzle<Vec3, T, 4, 2, 2, 2> zzz;
-				Swizzle<Vec3, T, 4, 2, 2, 3> zzw;
-				Swizzle<Vec3, T, 4, 2, 3, 0> zwx;
-				Swizzle<Vec3, T, 4, 2, 3, 1> zwy;
-				Swizzle<Vec3, T, 4, 2, 3, 2> zwz;
-				Swizzle<Vec3, T, 4, 2, 3, 3> zww;
-				Swizzle<Vec3, T, 4, 3, 0, 0> wxx;
-				Swizzle<Vec3, T, 4, 3, 0, 1> wxy;
-				Swizzle<Vec3, T, 4, 3, 0, 2> wxz;
-				Swizzle<Vec3, T, 4, 3, 0, 3> wxw;
-				Swizzle<Vec3, T, 4, 3, 1, 0> wyx;
-				Swizzle<Vec3, T, 4, 3, 1, 1> wyy;
-				Swizzle<Vec3, T, 4, 3, 1, 2> wyz;
-				Swizzle<Vec3, T, 4, 3, 1, 3> wyw;
-				Swizzle<Vec3, T, 4, 3, 2, 0> wzx;
-				Swizzle<Vec3, T, 4, 3, 2, 1> wzy;
-				Swizzle<Vec3, T, 4, 3, 2, 2> wzz;
-				Swizzle<Vec3, T, 4, 3, 2, 3> wzw;
-				Swizzle<Vec3, T, 4, 3, 3, 0> wwx;
-				Swizzle<Vec3, T, 4, 3, 3, 1> wwy;
-				Swizzle<Vec3, T, 4, 3, 3, 2> wwz;
-				Swizzle<Vec3, T, 4, 3, 3, 3> www;
+					Swizzle<Vec3, T, 4, 0, 0, 0> xxx;
+					Swizzle<Vec3, T, 4, 0, 0, 1> xxy;
+					Swizzle<Vec3, T, 4, 0, 0, 2> xxz;
+					Swizzle<Vec3, T, 4, 0, 0, 3> xxw;
+					Swizzle<Vec3, T, 4, 0, 1, 0> xyx;
+					Swizzle<Vec3, T, 4, 0, 1, 1> xyy;
+					Swizzle<Vec3, T, 4, 0, 1, 2> xyz;
+					Swizzle<Vec3, T, 4, 0, 1, 3> xyw;
+					Swizzle<Vec3, T, 4, 0, 2, 0> xzx;
+					Swizzle<Vec3, T, 4, 0, 2, 1> xzy;
+					Swizzle<Vec3, T, 4, 0, 2, 2> xzz;
+					Swizzle<Vec3, T, 4, 0, 2, 3> xzw;
+					Swizzle<Vec3, T, 4, 0, 3, 0> xwx;
+					Swizzle<Vec3, T, 4, 0, 3, 1> xwy;
+					Swizzle<Vec3, T, 4, 0, 3, 2> xwz;
+					Swizzle<Vec3, T, 4, 0, 3, 3> xww;
+					Swizzle<Vec3, T, 4, 1, 0, 0> yxx;
+					Swizzle<Vec3, T, 4, 1, 0, 1> yxy;
+					Swizzle<Vec3, T, 4, 1, 0, 2> yxz;
+					Swizzle<Vec3, T, 4, 1, 0, 3> yxw;
+					Swizzle<Vec3, T, 4, 1, 1, 0> yyx;
+					Swizzle<Vec3, T, 4, 1, 1, 1> yyy;
+					Swizzle<Vec3, T, 4, 1, 1, 2> yyz;
+					Swizzle<Vec3, T, 4, 1, 1, 3> yyw;
+					Swizzle<Vec3, T, 4, 1, 2, 0> yzx;
+					Swizzle<Vec3, T, 4, 1, 2, 1> yzy;
+					Swizzle<Vec3, T, 4, 1, 2, 2> yzz;
+					Swizzle<Vec3, T, 4, 1, 2, 3> yzw;
+					Swizzle<Vec3, T, 4, 1, 3, 0> ywx;
+					Swizzle<Vec3, T, 4, 1, 3, 1> ywy;
+					Swizzle<Vec3, T, 4, 1, 3, 2> ywz;
+					Swizzle<Vec3, T, 4, 1, 3, 3> yww;
+					Swizzle<Vec3, T, 4, 2, 0, 0> zxx;
+					Swizzle<Vec3, T, 4, 2, 0, 1> zxy;
+					Swizzle<Vec3, T, 4, 2, 0, 2> zxz;
+					Swizzle<Vec3, T, 4, 2, 0, 3> zxw;
+					Swizzle<Vec3, T, 4, 2, 1, 0> zyx;
+					Swizzle<Vec3, T, 4, 2, 1, 1> zyy;
+					Swizzle<Vec3, T, 4, 2, 1, 2> zyz;
+					Swizzle<Vec3, T, 4, 2, 1, 3> zyw;
+					Swizzle<Vec3, T, 4, 2, 2, 0> zzx;
+					Swizzle<Vec3, T, 4, 2, 2, 1> zzy;
+					Swizzle<Vec3, T, 4, 2, 2, 2> zzz;
+					Swizzle<Vec3, T, 4, 2, 2, 3> zzw;
+					Swizzle<Vec3, T, 4, 2, 3, 0> zwx;
+					Swizzle<Vec3, T, 4, 2, 3, 1> zwy;
+					Swizzle<Vec3, T, 4, 2, 3, 2> zwz;
+					Swizzle<Vec3, T, 4, 2, 3, 3> zww;
+					Swizzle<Vec3, T, 4, 3, 0, 0> wxx;
+					Swizzle<Vec3, T, 4, 3, 0, 1> wxy;
+					Swizzle<Vec3, T, 4, 3, 0, 2> wxz;
+					Swizzle<Vec3, T, 4, 3, 0, 3> wxw;
+					Swizzle<Vec3, T, 4, 3, 1, 0> wyx;
+					Swizzle<Vec3, T, 4, 3, 1, 1> wyy;
+					Swizzle<Vec3, T, 4, 3, 1, 2> wyz;
+					Swizzle<Vec3, T, 4, 3, 1, 3> wyw;
+					Swizzle<Vec3, T, 4, 3, 2, 0> wzx;
+					Swizzle<Vec3, T, 4, 3, 2, 1> wzy;
+					Swizzle<Vec3, T, 4, 3, 2, 2> wzz;
+					Swizzle<Vec3, T, 4, 3, 2, 3> wzw;
+					Swizzle<Vec3, T, 4, 3, 3, 0> wwx;
+					Swizzle<Vec3, T, 4, 3, 3, 1> wwy;
+					Swizzle<Vec3, T, 4, 3, 3, 2> wwz;
+					Swizzle<Vec3, T, 4, 3, 3, 3> www;
 
-				Swizzle<Vec4, T, 4, 0, 0, 0, 0> xxxx;
-				Swizzle<Vec4, T, 4, 0, 0, 0, 1> xxxy;
-				Swizzle<Vec4, T, 4, 0, 0, 0, 2> xxxz;
-				Swizzle<Vec4, T, 4, 0, 0, 0, 3> xxxw;
-				Swizzle<Vec4, T, 4, 0, 0, 1, 0> xxyx;
-				Swizzle<Vec4, T, 4, 0, 0, 1, 1> xxyy;
-				Swizzle<Vec4, T, 4, 0, 0, 1, 2> xxyz;
-				Swizzle<Vec4, T, 4, 0, 0, 1, 3> xxyw;
-				Swizzle<Vec4, T, 4, 0, 0, 2, 0> xxzx;
-				Swizzle<Vec4, T, 4, 0, 0, 2, 1> xxzy;
-				Swizzle<Vec4, T, 4, 0, 0, 2, 2> xxzz;
-				Swizzle<Vec4, T, 4, 0, 0, 2, 3> xxzw;
-				Swizzle<Vec4, T, 4, 0, 0, 3, 0> xxwx;
-				Swizzle<Vec4, T, 4, 0, 0, 3, 1> xxwy;
-				Swizzle<Vec4, T, 4, 0, 0, 3, 2> xxwz;
-				Swizzle<Vec4, T, 4, 0, 0, 3, 3> xxww;
-				Swizzle<Vec4, T, 4, 0, 1, 0, 0> xyxx;
-				Swizzle<Vec4, T, 4, 0, 1, 0, 1> xyxy;
-				Swizzle<Vec4, T, 4, 0, 1, 0, 2> xyxz;
-				Swizzle<Vec4, T, 4, 0, 1, 0, 3> xyxw;
-				Swizzle<Vec4, T, 4, 0, 1, 1, 0> xyyx;
-				Swizzle<Vec4, T, 4, 0, 1, 1, 1> xyyy;
-				Swizzle<Vec4, T, 4, 0, 1, 1, 2> xyyz;
-				Swizzle<Vec4, T, 4, 0, 1, 1, 3> xyyw;
-				Swizzle<Vec4, T, 4, 0, 1, 2, 0> xyzx;
-				Swizzle<Vec4, T, 4, 0, 1, 2, 1> xyzy;
-				Swizzle<Vec4, T, 4, 0, 1, 2, 2> xyzz;
-				Swizzle<Vec4, T, 4, 0, 1, 2, 3> xyzw;
-				Swizzle<Vec4, T, 4, 0, 1, 3, 0> xywx;
-				Swizzle<Vec4, T, 4, 0, 1, 3, 1> xywy;
-				Swizzle<Vec4, T, 4, 0, 1, 3, 2> xywz;
-				Swizzle<Vec4, T, 4, 0, 1, 3, 3> xyww;
-				Swizzle<Vec4, T, 4, 0, 2, 0, 0> xzxx;
-				Swizzle<Vec4, T, 4, 0, 2, 0, 1> xzxy;
-				Swizzle<Vec4, T, 4, 0, 2, 0, 2> xzxz;
-				Swizzle<Vec4, T, 4, 0, 2, 0, 3> xzxw;
-				Swizzle<Vec4, T, 4, 0, 2, 1, 0> xzyx;
-				Swizzle<Vec4, T, 4, 0, 2, 1, 1> xzyy;
-				Swizzle<Vec4, T, 4, 0, 2, 1, 2> xzyz;
-				Swizzle<Vec4, T, 4, 0, 2, 1, 3> xzyw;
-				Swizzle<Vec4, T, 4, 0, 2, 2, 0> xzzx;
-				Swizzle<Vec4, T, 4, 0, 2, 2, 1> xzzy;
-				Swizzle<Vec4, T, 4, 0, 2, 2, 2> xzzz;
-				Swizzle<Vec4, T, 4, 0, 2, 2, 3> xzzw;
-				Swizzle<Vec4, T, 4, 0, 2, 3, 0> xzwx;
-				Swizzle<Vec4, T, 4, 0, 2, 3, 1> xzwy;
-				Swizzle<Vec4, T, 4, 0, 2, 3, 2> xzwz;
-				Swizzle<Vec4, T, 4, 0, 2, 3, 3> xzww;
-				Swizzle<Vec4, T, 4, 0, 3, 0, 0> xwxx;
-				Swizzle<Vec4, T, 4, 0, 3, 0, 1> xwxy;
-				Swizzle<Vec4, T, 4, 0, 3, 0, 2> xwxz;
-				Swizzle<Vec4, T, 4, 0, 3, 0, 3> xwxw;
-				Swizzle<Vec4, T, 4, 0, 3, 1, 0> xwyx;
-				Swizzle<Vec4, T, 4, 0, 3, 1, 1> xwyy;
-				Swizzle<Vec4, T, 4, 0, 3, 1, 2> xwyz;
-				Swizzle<Vec4, T, 4, 0, 3, 1, 3> xwyw;
-				Swizzle<Vec4, T, 4, 0, 3, 2, 0> xwzx;
-				Swizzle<Vec4, T, 4, 0, 3, 2, 1> xwzy;
-				Swizzle<Vec4, T, 4, 0, 3, 2, 2> xwzz;
-				Swizzle<Vec4, T, 4, 0, 3, 2, 3> xwzw;
-				Swizzle<Vec4, T, 4, 0, 3, 3, 0> xwwx;
-				Swizzle<Vec4, T, 4, 0, 3, 3, 1> xwwy;
-				Swizzle<Vec4, T, 4, 0, 3, 3, 2> xwwz;
-				Swizzle<Vec4, T, 4, 0, 3, 3, 3> xwww;
-				Swizzle<Vec4, T, 4, 1, 0, 0, 0> yxxx;
-				Swizzle<Vec4, T, 4, 1, 0, 0, 1> yxxy;
-				Swizzle<Vec4, T, 4, 1, 0, 0, 2> yxxz;
-				Swizzle<Vec4, T, 4, 1, 0, 0, 3> yxxw;
-				Swizzle<Vec4, T, 4, 1, 0, 1, 0> yxyx;
-				Swizzle<Vec4, T, 4, 1, 0, 1, 1> yxyy;
-				Swizzle<Vec4, T, 4, 1, 0, 1, 2> yxyz;
-				Swizzle<Vec4, T, 4, 1, 0, 1, 3> yxyw;
-				Swizzle<Vec4, T, 4, 1, 0, 2, 0> yxzx;
-				Swizzle<Vec4, T, 4, 1, 0, 2, 1> yxzy;
-				Swizzle<Vec4, T, 4, 1, 0, 2, 2> yxzz;
-				Swizzle<Vec4, T, 4, 1, 0, 2, 3> yxzw;
-				Swizzle<Vec4, T, 4, 1, 0, 3, 0> yxwx;
-				Swizzle<Vec4, T, 4, 1, 0, 3, 1> yxwy;
-				Swizzle<Vec4, T, 4, 1, 0, 3, 2> yxwz;
-				Swizzle<Vec4, T, 4, 1, 0, 3, 3> yxww;
-				Swizzle<Vec4, T, 4, 1, 1, 0, 0> yyxx;
-				Swizzle<Vec4, T, 4, 1, 1, 0, 1> yyxy;
-				Swizzle<Vec4, T, 4, 1, 1, 0, 2> yyxz;
-				Swizzle<Vec4, T, 4, 1, 1, 0, 3> yyxw;
-				Swizzle<Vec4, T, 4, 1, 1, 1, 0> yyyx;
-				Swizzle<Vec4, T, 4, 1, 1, 1, 1> yyyy;
-				Swizzle<Vec4, T, 4, 1, 1, 1, 2> yyyz;
-				Swizzle<Vec4, T, 4, 1, 1, 1, 3> yyyw;
-				Swizzle<Vec4, T, 4, 1, 1, 2, 0> yyzx;
-				Swizzle<Vec4, T, 4, 1, 1, 2, 1> yyzy;
-				Swizzle<Vec4, T, 4, 1, 1, 2, 2> yyzz;
-				Swizzle<Vec4, T, 4, 1, 1, 2, 3> yyzw;
-				Swizzle<Vec4, T, 4, 1, 1, 3, 0> yywx;
-				Swizzle<Vec4, T, 4, 1, 1, 3, 1> yywy;
-				Swizzle<Vec4, T, 4, 1, 1, 3, 2> yywz;
-				Swizzle<Vec4, T, 4, 1, 1, 3, 3> yyww;
-				Swizzle<Vec4, T, 4, 1, 2, 0, 0> yzxx;
-				Swizzle<Vec4, T, 4, 1, 2, 0, 1> yzxy;
-				Swizzle<Vec4, T, 4, 1, 2, 0, 2> yzxz;
-				Swizzle<Vec4, T, 4, 1, 2, 0, 3> yzxw;
-				Swizzle<Vec4, T, 4, 1, 2, 1, 0> yzyx;
-				Swizzle<Vec4, T, 4, 1, 2, 1, 1> yzyy;
-				Swizzle<Vec4, T, 4, 1, 2, 1, 2> yzyz;
-				Swizzle<Vec4, T, 4, 1, 2, 1, 3> yzyw;
-				Swizzle<Vec4, T, 4, 1, 2, 2, 0> yzzx;
-				Swizzle<Vec4, T, 4, 1, 2, 2, 1> yzzy;
-				Swizzle<Vec4, T, 4, 1, 2, 2, 2> yzzz;
-				Swizzle<Vec4, T, 4, 1, 2, 2, 3> yzzw;
-				Swizzle<Vec4, T, 4, 1, 2, 3, 0> yzwx;
-				Swizzle<Vec4, T, 4, 1, 2, 3, 1> yzwy;
-				Swizzle<Vec4, T, 4, 1, 2, 3, 2> yzwz;
-				Swizzle<Vec4, T, 4, 1, 2, 3, 3> yzww;
-				Swizzle<Vec4, T, 4, 1, 3, 0, 0> ywxx;
-				Swizzle<Vec4, T, 4, 1, 3, 0, 1> ywxy;
-				Swizzle<Vec4, T, 4, 1, 3, 0, 2> ywxz;
-				Swizzle<Vec4, T, 4, 1, 3, 0, 3> ywxw;
-				Swizzle<Vec4, T, 4, 1, 3, 1, 0> ywyx;
-				Swizzle<Vec4, T, 4, 1, 3, 1, 1> ywyy;
-				Swizzle<Vec4, T, 4, 1, 3, 1, 2> ywyz;
-				Swizzle<Vec4, T, 4, 1, 3, 1, 3> ywyw;
-				Swizzle<Vec4, T, 4, 1, 3, 2, 0> ywzx;
-				Swizzle<Vec4, T, 4, 1, 3, 2, 1> ywzy;
-				Swizzle<Vec4, T, 4, 1, 3, 2, 2> ywzz;
-				Swizzle<Vec4, T, 4, 1, 3, 2, 3> ywzw;
-				Swizzle<Vec4, T, 4, 1, 3, 3, 0> ywwx;
-				Swizzle<Vec4, T, 4, 1, 3, 3, 1> ywwy;
-				Swizzle<Vec4, T, 4, 1, 3, 3, 2> ywwz;
-				Swizzle<Vec4, T, 4, 1, 3, 3, 3> ywww;
-				Swizzle<Vec4, T, 4, 2, 0, 0, 0> zxxx;
-				Swizzle<Vec4, T, 4, 2, 0, 0, 1> zxxy;
-				Swizzle<Vec4, T, 4, 2, 0, 0, 2> zxxz;
-				Swizzle<Vec4, T, 4, 2, 0, 0, 3> zxxw;
-				Swizzle<Vec4, T, 4, 2, 0, 1, 0> zxyx;
-				Swizzle<Vec4, T, 4, 2, 0, 1, 1> zxyy;
-				Swizzle<Vec4, T, 4, 2, 0, 1, 2> zxyz;
-				Swizzle<Vec4, T, 4, 2, 0, 1, 3> zxyw;
-				Swizzle<Vec4, T, 4, 2, 0, 2, 0> zxzx;
-				Swizzle<Vec4, T, 4, 2, 0, 2, 1> zxzy;
-				Swizzle<Vec4, T, 4, 2, 0, 2, 2> zxzz;
-				Swizzle<Vec4, T, 4, 2, 0, 2, 3> zxzw;
-				Swizzle<Vec4, T, 4, 2, 0, 3, 0> zxwx;
-				Swizzle<Vec4, T, 4, 2, 0, 3, 1> zxwy;
-				Swizzle<Vec4, T, 4, 2, 0, 3, 2> zxwz;
-				Swizzle<Vec4, T, 4, 2, 0, 3, 3> zxww;
-				Swizzle<Vec4, T, 4, 2, 1, 0, 0> zyxx;
-				Swizzle<Vec4, T, 4, 2, 1, 0, 1> zyxy;
-				Swizzle<Vec4, T, 4, 2, 1, 0, 2> zyxz;
-				Swizzle<Vec4, T, 4, 2, 1, 0, 3> zyxw;
-				Swizzle<Vec4, T, 4, 2, 1, 1, 0> zyyx;
-				Swizzle<Vec4, T, 4, 2, 1, 1, 1> zyyy;
-				Swizzle<Vec4, T, 4, 2, 1, 1, 2> zyyz;
-				Swizzle<Vec4, T, 4, 2, 1, 1, 3> zyyw;
-				Swizzle<Vec4, T, 4, 2, 1, 2, 0> zyzx;
-				Swizzle<Vec4, T, 4, 2, 1, 2, 1> zyzy;
-				Swizzle<Vec4, T, 4, 2, 1, 2, 2> zyzz;
-				Swizzle<Vec4, T, 4, 2, 1, 2, 3> zyzw;
-				Swizzle<Vec4, T, 4, 2, 1, 3, 0> zywx;
-				Swizzle<Vec4, T, 4, 2, 1, 3, 1> zywy;
-				Swizzle<Vec4, T, 4, 2, 1, 3, 2> zywz;
-				Swizzle<Vec4, T, 4, 2, 1, 3, 3> zyww;
-				Swizzle<Vec4, T, 4, 2, 2, 0, 0> zzxx;
-				Swizzle<Vec4, T, 4, 2, 2, 0, 1> zzxy;
-				Swizzle<Vec4, T, 4, 2, 2, 0, 2> zzxz;
-				Swizzle<Vec4, T, 4, 2, 2, 0, 3> zzxw;
-				Swizzle<Vec4, T, 4, 2, 2, 1, 0> zzyx;
-				Swizzle<Vec4, T, 4, 2, 2, 1, 1> zzyy;
-				Swizzle<Vec4, T, 4, 2, 2, 1, 2> zzyz;
-				Swizzle<Vec4, T, 4, 2, 2, 1, 3> zzyw;
-				Swizzle<Vec4, T, 4, 2, 2, 2, 0> zzzx;
-				Swizzle<Vec4, T, 4, 2, 2, 2, 1> zzzy;
-				Swizzle<Vec4, T, 4, 2, 2, 2, 2> zzzz;
-				Swizzle<Vec4, T, 4, 2, 2, 2, 3> zzzw;
-				Swizzle<Vec4, T, 4, 2, 2, 3, 0> zzwx;
-				Swizzle<Vec4, T, 4, 2, 2, 3, 1> zzwy;
-				Swizzle<Vec4, T, 4, 2, 2, 3, 2> zzwz;
-				Swizzle<Vec4, T, 4, 2, 2, 3, 3> zzww;
-				Swizzle<Vec4, T, 4, 2, 3, 0, 0> zwxx;
-				Swizzle<Vec4, T, 4, 2, 3, 0, 1> zwxy;
-				Swizzle<Vec4, T, 4, 2, 3, 0, 2> zwxz;
-				Swizzle<Vec4, T, 4, 2, 3, 0, 3> zwxw;
-				Swizzle<Vec4, T, 4, 2, 3, 1, 0> zwyx;
-				Swizzle<Vec4, T, 4, 2, 3, 1, 1> zwyy;
-				Swizzle<Vec4, T, 4, 2, 3, 1, 2> zwyz;
-				Swizzle<Vec4, T, 4, 2, 3, 1, 3> zwyw;
-				Swizzle<Vec4, T, 4, 2, 3, 2, 0> zwzx;
-				Swizzle<Vec4, T, 4, 2, 3, 2, 1> zwzy;
-				Swizzle<Vec4, T, 4, 2, 3, 2, 2> zwzz;
-				Swizzle<Vec4, T, 4, 2, 3, 2, 3> zwzw;
-				Swizzle<Vec4, T, 4, 2, 3, 3, 0> zwwx;
-				Swizzle<Vec4, T, 4, 2, 3, 3, 1> zwwy;
-				Swizzle<Vec4, T, 4, 2, 3, 3, 2> zwwz;
-				Swizzle<Vec4, T, 4, 2, 3, 3, 3> zwww;
-				Swizzle<Vec4, T, 4, 3, 0, 0, 0> wxxx;
-				Swizzle<Vec4, T, 4, 3, 0, 0, 1> wxxy;
-				Swizzle<Vec4, T, 4, 3, 0, 0, 2> wxxz;
-				Swizzle<Vec4, T, 4, 3, 0, 0, 3> wxxw;
-				Swizzle<Vec4, T, 4, 3, 0, 1, 0> wxyx;
-				Swizzle<Vec4, T, 4, 3, 0, 1, 1> wxyy;
-				Swizzle<Vec4, T, 4, 3, 0, 1, 2> wxyz;
-				Swizzle<Vec4, T, 4, 3, 0, 1, 3> wxyw;
-				Swizzle<Vec4, T, 4, 3, 0, 2, 0> wxzx;
-				Swizzle<Vec4, T, 4, 3, 0, 2, 1> wxzy;
-				Swizzle<Vec4, T, 4, 3, 0, 2, 2> wxzz;
-				Swizzle<Vec4, T, 4, 3, 0, 2, 3> wxzw;
-				Swizzle<Vec4, T, 4, 3, 0, 3, 0> wxwx;
-				Swizzle<Vec4, T, 4, 3, 0, 3, 1> wxwy;
-				Swizzle<Vec4, T, 4, 3, 0, 3, 2> wxwz;
-				Swizzle<Vec4, T, 4, 3, 0, 3, 3> wxww;
-				Swizzle<Vec4, T, 4, 3, 1, 0, 0> wyxx;
-				Swizzle<Vec4, T, 4, 3, 1, 0, 1> wyxy;
-				Swizzle<Vec4, T, 4, 3, 1, 0, 2> wyxz;
-				Swizzle<Vec4, T, 4, 3, 1, 0, 3> wyxw;
-				Swizzle<Vec4, T, 4, 3, 1, 1, 0> wyyx;
-				Swizzle<Vec4, T, 4, 3, 1, 1, 1> wyyy;
-				Swizzle<Vec4, T, 4, 3, 1, 1, 2> wyyz;
-				Swizzle<Vec4, T, 4, 3, 1, 1, 3> wyyw;
-				Swizzle<Vec4, T, 4, 3, 1, 2, 0> wyzx;
-				Swizzle<Vec4, T, 4, 3, 1, 2, 1> wyzy;
-				Swizzle<Vec4, T, 4, 3, 1, 2, 2> wyzz;
-				Swizzle<Vec4, T, 4, 3, 1, 2, 3> wyzw;
-				Swizzle<Vec4, T, 4, 3, 1, 3, 0> wywx;
-				Swizzle<Vec4, T, 4, 3, 1, 3, 1> wywy;
-				Swizzle<Vec4, T, 4, 3, 1, 3, 2> wywz;
-				Swizzle<Vec4, T, 4, 3, 1, 3, 3> wyww;
-				Swizzle<Vec4, T, 4, 3, 2, 0, 0> wzxx;
-				Swizzle<Vec4, T, 4, 3, 2, 0, 1> wzxy;
-				Swizzle<Vec4, T, 4, 3, 2, 0, 2> wzxz;
-				Swizzle<Vec4, T, 4, 3, 2, 0, 3> wzxw;
-				Swizzle<Vec4, T, 4, 3, 2, 1, 0> wzyx;
-				Swizzle<Vec4, T, 4, 3, 2, 1, 1> wzyy;
-				Swizzle<Vec4, T, 4, 3, 2, 1, 2> wzyz;
-				Swizzle<Vec4, T, 4, 3, 2, 1, 3> wzyw;
-				Swizzle<Vec4, T, 4, 3, 2, 2, 0> wzzx;
-				Swizzle<Vec4, T, 4, 3, 2, 2, 1> wzzy;
-				Swizzle<Vec4, T, 4, 3, 2, 2, 2> wzzz;
-				Swizzle<Vec4, T, 4, 3, 2, 2, 3> wzzw;
-				Swizzle<Vec4, T, 4, 3, 2, 3, 0> wzwx;
-				Swizzle<Vec4, T, 4, 3, 2, 3, 1> wzwy;
-				Swizzle<Vec4, T, 4, 3, 2, 3, 2> wzwz;
-				Swizzle<Vec4, T, 4, 3, 2, 3, 3> wzww;
-				Swizzle<Vec4, T, 4, 3, 3, 0, 0> wwxx;
-				Swizzle<Vec4, T, 4, 3, 3, 0, 1> wwxy;
-				Swizzle<Vec4, T, 4, 3, 3, 0, 2> wwxz;
-				Swizzle<Vec4, T, 4, 3, 3, 0, 3> wwxw;
-				Swizzle<Vec4, T, 4, 3, 3, 1, 0> wwyx;
-				Swizzle<Vec4, T, 4, 3, 3, 1, 1> wwyy;
-				Swizzle<Vec4, T, 4, 3, 3, 1, 2> wwyz;
-				Swizzle<Vec4, T, 4, 3, 3, 1, 3> wwyw;
-				Swizzle<Vec4, T, 4, 3, 3, 2, 0> wwzx;
-				Swizzle<Vec4, T, 4, 3, 3, 2, 1> wwzy;
-				Swizzle<Vec4, T, 4, 3, 3, 2, 2> wwzz;
-				Swizzle<Vec4, T, 4, 3, 3, 2, 3> wwzw;
-				Swizzle<Vec4, T, 4, 3, 3, 3, 0> wwwx;
-				Swizzle<Vec4, T, 4, 3, 3, 3, 1> wwwy;
-				Swizzle<Vec4, T, 4, 3, 3, 3, 2> wwwz;
-				Swizzle<Vec4, T, 4, 3, 3, 3, 3> wwww;
+					Swizzle<Vec4, T, 4, 0, 0, 0, 0> xxxx;
+					Swizzle<Vec4, T, 4, 0, 0, 0, 1> xxxy;
+					Swizzle<Vec4, T, 4, 0, 0, 0, 2> xxxz;
+					Swizzle<Vec4, T, 4, 0, 0, 0, 3> xxxw;
+					Swizzle<Vec4, T, 4, 0, 0, 1, 0> xxyx;
+					Swizzle<Vec4, T, 4, 0, 0, 1, 1> xxyy;
+					Swizzle<Vec4, T, 4, 0, 0, 1, 2> xxyz;
+					Swizzle<Vec4, T, 4, 0, 0, 1, 3> xxyw;
+					Swizzle<Vec4, T, 4, 0, 0, 2, 0> xxzx;
+					Swizzle<Vec4, T, 4, 0, 0, 2, 1> xxzy;
+					Swizzle<Vec4, T, 4, 0, 0, 2, 2> xxzz;
+					Swizzle<Vec4, T, 4, 0, 0, 2, 3> xxzw;
+					Swizzle<Vec4, T, 4, 0, 0, 3, 0> xxwx;
+					Swizzle<Vec4, T, 4, 0, 0, 3, 1> xxwy;
+					Swizzle<Vec4, T, 4, 0, 0, 3, 2> xxwz;
+					Swizzle<Vec4, T, 4, 0, 0, 3, 3> xxww;
+					Swizzle<Vec4, T, 4, 0, 1, 0, 0> xyxx;
+					Swizzle<Vec4, T, 4, 0, 1, 0, 1> xyxy;
+					Swizzle<Vec4, T, 4, 0, 1, 0, 2> xyxz;
+					Swizzle<Vec4, T, 4, 0, 1, 0, 3> xyxw;
+					Swizzle<Vec4, T, 4, 0, 1, 1, 0> xyyx;
+					Swizzle<Vec4, T, 4, 0, 1, 1, 1> xyyy;
+					Swizzle<Vec4, T, 4, 0, 1, 1, 2> xyyz;
+					Swizzle<Vec4, T, 4, 0, 1, 1, 3> xyyw;
+					Swizzle<Vec4, T, 4, 0, 1, 2, 0> xyzx;
+					Swizzle<Vec4, T, 4, 0, 1, 2, 1> xyzy;
+					Swizzle<Vec4, T, 4, 0, 1, 2, 2> xyzz;
+					Swizzle<Vec4, T, 4, 0, 1, 2, 3> xyzw;
+					Swizzle<Vec4, T, 4, 0, 1, 3, 0> xywx;
+					Swizzle<Vec4, T, 4, 0, 1, 3, 1> xywy;
+					Swizzle<Vec4, T, 4, 0, 1, 3, 2> xywz;
+					Swizzle<Vec4, T, 4, 0, 1, 3, 3> xyww;
+					Swizzle<Vec4, T, 4, 0, 2, 0, 0> xzxx;
+					Swizzle<Vec4, T, 4, 0, 2, 0, 1> xzxy;
+					Swizzle<Vec4, T, 4, 0, 2, 0, 2> xzxz;
+					Swizzle<Vec4, T, 4, 0, 2, 0, 3> xzxw;
+					Swizzle<Vec4, T, 4, 0, 2, 1, 0> xzyx;
+					Swizzle<Vec4, T, 4, 0, 2, 1, 1> xzyy;
+					Swizzle<Vec4, T, 4, 0, 2, 1, 2> xzyz;
+					Swizzle<Vec4, T, 4, 0, 2, 1, 3> xzyw;
+					Swizzle<Vec4, T, 4, 0, 2, 2, 0> xzzx;
+					Swizzle<Vec4, T, 4, 0, 2, 2, 1> xzzy;
+					Swizzle<Vec4, T, 4, 0, 2, 2, 2> xzzz;
+					Swizzle<Vec4, T, 4, 0, 2, 2, 3> xzzw;
+					Swizzle<Vec4, T, 4, 0, 2, 3, 0> xzwx;
+					Swizzle<Vec4, T, 4, 0, 2, 3, 1> xzwy;
+					Swizzle<Vec4, T, 4, 0, 2, 3, 2> xzwz;
+					Swizzle<Vec4, T, 4, 0, 2, 3, 3> xzww;
+					Swizzle<Vec4, T, 4, 0, 3, 0, 0> xwxx;
+					Swizzle<Vec4, T, 4, 0, 3, 0, 1> xwxy;
+					Swizzle<Vec4, T, 4, 0, 3, 0, 2> xwxz;
+					Swizzle<Vec4, T, 4, 0, 3, 0, 3> xwxw;
+					Swizzle<Vec4, T, 4, 0, 3, 1, 0> xwyx;
+					Swizzle<Vec4, T, 4, 0, 3, 1, 1> xwyy;
+					Swizzle<Vec4, T, 4, 0, 3, 1, 2> xwyz;
+					Swizzle<Vec4, T, 4, 0, 3, 1, 3> xwyw;
+					Swizzle<Vec4, T, 4, 0, 3, 2, 0> xwzx;
+					Swizzle<Vec4, T, 4, 0, 3, 2, 1> xwzy;
+					Swizzle<Vec4, T, 4, 0, 3, 2, 2> xwzz;
+					Swizzle<Vec4, T, 4, 0, 3, 2, 3> xwzw;
+					Swizzle<Vec4, T, 4, 0, 3, 3, 0> xwwx;
+					Swizzle<Vec4, T, 4, 0, 3, 3, 1> xwwy;
+					Swizzle<Vec4, T, 4, 0, 3, 3, 2> xwwz;
+					Swizzle<Vec4, T, 4, 0, 3, 3, 3> xwww;
+					Swizzle<Vec4, T, 4, 1, 0, 0, 0> yxxx;
+					Swizzle<Vec4, T, 4, 1, 0, 0, 1> yxxy;
+					Swizzle<Vec4, T, 4, 1, 0, 0, 2> yxxz;
+					Swizzle<Vec4, T, 4, 1, 0, 0, 3> yxxw;
+					Swizzle<Vec4, T, 4, 1, 0, 1, 0> yxyx;
+					Swizzle<Vec4, T, 4, 1, 0, 1, 1> yxyy;
+					Swizzle<Vec4, T, 4, 1, 0, 1, 2> yxyz;
+					Swizzle<Vec4, T, 4, 1, 0, 1, 3> yxyw;
+					Swizzle<Vec4, T, 4, 1, 0, 2, 0> yxzx;
+					Swizzle<Vec4, T, 4, 1, 0, 2, 1> yxzy;
+					Swizzle<Vec4, T, 4, 1, 0, 2, 2> yxzz;
+					Swizzle<Vec4, T, 4, 1, 0, 2, 3> yxzw;
+					Swizzle<Vec4, T, 4, 1, 0, 3, 0> yxwx;
+					Swizzle<Vec4, T, 4, 1, 0, 3, 1> yxwy;
+					Swizzle<Vec4, T, 4, 1, 0, 3, 2> yxwz;
+					Swizzle<Vec4, T, 4, 1, 0, 3, 3> yxww;
+					Swizzle<Vec4, T, 4, 1, 1, 0, 0> yyxx;
+					Swizzle<Vec4, T, 4, 1, 1, 0, 1> yyxy;
+					Swizzle<Vec4, T, 4, 1, 1, 0, 2> yyxz;
+					Swizzle<Vec4, T, 4, 1, 1, 0, 3> yyxw;
+					Swizzle<Vec4, T, 4, 1, 1, 1, 0> yyyx;
+					Swizzle<Vec4, T, 4, 1, 1, 1, 1> yyyy;
+					Swizzle<Vec4, T, 4, 1, 1, 1, 2> yyyz;
+					Swizzle<Vec4, T, 4, 1, 1, 1, 3> yyyw;
+					Swizzle<Vec4, T, 4, 1, 1, 2, 0> yyzx;
+					Swizzle<Vec4, T, 4, 1, 1, 2, 1> yyzy;
+					Swizzle<Vec4, T, 4, 1, 1, 2, 2> yyzz;
+					Swizzle<Vec4, T, 4, 1, 1, 2, 3> yyzw;
+					Swizzle<Vec4, T, 4, 1, 1, 3, 0> yywx;
+					Swizzle<Vec4, T, 4, 1, 1, 3, 1> yywy;
+					Swizzle<Vec4, T, 4, 1, 1, 3, 2> yywz;
+					Swizzle<Vec4, T, 4, 1, 1, 3, 3> yyww;
+					Swizzle<Vec4, T, 4, 1, 2, 0, 0> yzxx;
+					Swizzle<Vec4, T, 4, 1, 2, 0, 1> yzxy;
+					Swizzle<Vec4, T, 4, 1, 2, 0, 2> yzxz;
+					Swizzle<Vec4, T, 4, 1, 2, 0, 3> yzxw;
+					Swizzle<Vec4, T, 4, 1, 2, 1, 0> yzyx;
+					Swizzle<Vec4, T, 4, 1, 2, 1, 1> yzyy;
+					Swizzle<Vec4, T, 4, 1, 2, 1, 2> yzyz;
+					Swizzle<Vec4, T, 4, 1, 2, 1, 3> yzyw;
+					Swizzle<Vec4, T, 4, 1, 2, 2, 0> yzzx;
+					Swizzle<Vec4, T, 4, 1, 2, 2, 1> yzzy;
+					Swizzle<Vec4, T, 4, 1, 2, 2, 2> yzzz;
+					Swizzle<Vec4, T, 4, 1, 2, 2, 3> yzzw;
+					Swizzle<Vec4, T, 4, 1, 2, 3, 0> yzwx;
+					Swizzle<Vec4, T, 4, 1, 2, 3, 1> yzwy;
+					Swizzle<Vec4, T, 4, 1, 2, 3, 2> yzwz;
+					Swizzle<Vec4, T, 4, 1, 2, 3, 3> yzww;
+					Swizzle<Vec4, T, 4, 1, 3, 0, 0> ywxx;
+					Swizzle<Vec4, T, 4, 1, 3, 0, 1> ywxy;
+					Swizzle<Vec4, T, 4, 1, 3, 0, 2> ywxz;
+					Swizzle<Vec4, T, 4, 1, 3, 0, 3> ywxw;
+					Swizzle<Vec4, T, 4, 1, 3, 1, 0> ywyx;
+					Swizzle<Vec4, T, 4, 1, 3, 1, 1> ywyy;
+					Swizzle<Vec4, T, 4, 1, 3, 1, 2> ywyz;
+					Swizzle<Vec4, T, 4, 1, 3, 1, 3> ywyw;
+					Swizzle<Vec4, T, 4, 1, 3, 2, 0> ywzx;
+					Swizzle<Vec4, T, 4, 1, 3, 2, 1> ywzy;
+					Swizzle<Vec4, T, 4, 1, 3, 2, 2> ywzz;
+					Swizzle<Vec4, T, 4, 1, 3, 2, 3> ywzw;
+					Swizzle<Vec4, T, 4, 1, 3, 3, 0> ywwx;
+					Swizzle<Vec4, T, 4, 1, 3, 3, 1> ywwy;
+					Swizzle<Vec4, T, 4, 1, 3, 3, 2> ywwz;
+					Swizzle<Vec4, T, 4, 1, 3, 3, 3> ywww;
+					Swizzle<Vec4, T, 4, 2, 0, 0, 0> zxxx;
+					Swizzle<Vec4, T, 4, 2, 0, 0, 1> zxxy;
+					Swizzle<Vec4, T, 4, 2, 0, 0, 2> zxxz;
+					Swizzle<Vec4, T, 4, 2, 0, 0, 3> zxxw;
+					Swizzle<Vec4, T, 4, 2, 0, 1, 0> zxyx;
+					Swizzle<Vec4, T, 4, 2, 0, 1, 1> zxyy;
+					Swizzle<Vec4, T, 4, 2, 0, 1, 2> zxyz;
+					Swizzle<Vec4, T, 4, 2, 0, 1, 3> zxyw;
+					Swizzle<Vec4, T, 4, 2, 0, 2, 0> zxzx;
+					Swizzle<Vec4, T, 4, 2, 0, 2, 1> zxzy;
+					Swizzle<Vec4, T, 4, 2, 0, 2, 2> zxzz;
+					Swizzle<Vec4, T, 4, 2, 0, 2, 3> zxzw;
+					Swizzle<Vec4, T, 4, 2, 0, 3, 0> zxwx;
+					Swizzle<Vec4, T, 4, 2, 0, 3, 1> zxwy;
+					Swizzle<Vec4, T, 4, 2, 0, 3, 2> zxwz;
+					Swizzle<Vec4, T, 4, 2, 0, 3, 3> zxww;
+					Swizzle<Vec4, T, 4, 2, 1, 0, 0> zyxx;
+					Swizzle<Vec4, T, 4, 2, 1, 0, 1> zyxy;
+					Swizzle<Vec4, T, 4, 2, 1, 0, 2> zyxz;
+					Swizzle<Vec4, T, 4, 2, 1, 0, 3> zyxw;
+					Swizzle<Vec4, T, 4, 2, 1, 1, 0> zyyx;
+					Swizzle<Vec4, T, 4, 2, 1, 1, 1> zyyy;
+					Swizzle<Vec4, T, 4, 2, 1, 1, 2> zyyz;
+					Swizzle<Vec4, T, 4, 2, 1, 1, 3> zyyw;
+					Swizzle<Vec4, T, 4, 2, 1, 2, 0> zyzx;
+					Swizzle<Vec4, T, 4, 2, 1, 2, 1> zyzy;
+					Swizzle<Vec4, T, 4, 2, 1, 2, 2> zyzz;
+					Swizzle<Vec4, T, 4, 2, 1, 2, 3> zyzw;
+					Swizzle<Vec4, T, 4, 2, 1, 3, 0> zywx;
+					Swizzle<Vec4, T, 4, 2, 1, 3, 1> zywy;
+					Swizzle<Vec4, T, 4, 2, 1, 3, 2> zywz;
+					Swizzle<Vec4, T, 4, 2, 1, 3, 3> zyww;
+					Swizzle<Vec4, T, 4, 2, 2, 0, 0> zzxx;
+					Swizzle<Vec4, T, 4, 2, 2, 0, 1> zzxy;
+					Swizzle<Vec4, T, 4, 2, 2, 0, 2> zzxz;
+					Swizzle<Vec4, T, 4, 2, 2, 0, 3> zzxw;
+					Swizzle<Vec4, T, 4, 2, 2, 1, 0> zzyx;
+					Swizzle<Vec4, T, 4, 2, 2, 1, 1> zzyy;
+					Swizzle<Vec4, T, 4, 2, 2, 1, 2> zzyz;
+					Swizzle<Vec4, T, 4, 2, 2, 1, 3> zzyw;
+					Swizzle<Vec4, T, 4, 2, 2, 2, 0> zzzx;
+					Swizzle<Vec4, T, 4, 2, 2, 2, 1> zzzy;
+					Swizzle<Vec4, T, 4, 2, 2, 2, 2> zzzz;
+					Swizzle<Vec4, T, 4, 2, 2, 2, 3> zzzw;
+					Swizzle<Vec4, T, 4, 2, 2, 3, 0> zzwx;
+					Swizzle<Vec4, T, 4, 2, 2, 3, 1> zzwy;
+					Swizzle<Vec4, T, 4, 2, 2, 3, 2> zzwz;
+					Swizzle<Vec4, T, 4, 2, 2, 3, 3> zzww;
+					Swizzle<Vec4, T, 4, 2, 3, 0, 0> zwxx;
+					Swizzle<Vec4, T, 4, 2, 3, 0, 1> zwxy;
+					Swizzle<Vec4, T, 4, 2, 3, 0, 2> zwxz;
+					Swizzle<Vec4, T, 4, 2, 3, 0, 3> zwxw;
+					Swizzle<Vec4, T, 4, 2, 3, 1, 0> zwyx;
+					Swizzle<Vec4, T, 4, 2, 3, 1, 1> zwyy;
+					Swizzle<Vec4, T, 4, 2, 3, 1, 2> zwyz;
+					Swizzle<Vec4, T, 4, 2, 3, 1, 3> zwyw;
+					Swizzle<Vec4, T, 4, 2, 3, 2, 0> zwzx;
+					Swizzle<Vec4, T, 4, 2, 3, 2, 1> zwzy;
+					Swizzle<Vec4, T, 4, 2, 3, 2, 2> zwzz;
+					Swizzle<Vec4, T, 4, 2, 3, 2, 3> zwzw;
+					Swizzle<Vec4, T, 4, 2, 3, 3, 0> zwwx;
+					Swizzle<Vec4, T, 4, 2, 3, 3, 1> zwwy;
+					Swizzle<Vec4, T, 4, 2, 3, 3, 2> zwwz;
+					Swizzle<Vec4, T, 4, 2, 3, 3, 3> zwww;
+					Swizzle<Vec4, T, 4, 3, 0, 0, 0> wxxx;
+					Swizzle<Vec4, T, 4, 3, 0, 0, 1> wxxy;
+					Swizzle<Vec4, T, 4, 3, 0, 0, 2> wxxz;
+					Swizzle<Vec4, T, 4, 3, 0, 0, 3> wxxw;
+					Swizzle<Vec4, T, 4, 3, 0, 1, 0> wxyx;
+					Swizzle<Vec4, T, 4, 3, 0, 1, 1> wxyy;
+					Swizzle<Vec4, T, 4, 3, 0, 1, 2> wxyz;
+					Swizzle<Vec4, T, 4, 3, 0, 1, 3> wxyw;
+					Swizzle<Vec4, T, 4, 3, 0, 2, 0> wxzx;
+					Swizzle<Vec4, T, 4, 3, 0, 2, 1> wxzy;
+					Swizzle<Vec4, T, 4, 3, 0, 2, 2> wxzz;
+					Swizzle<Vec4, T, 4, 3, 0, 2, 3> wxzw;
+					Swizzle<Vec4, T, 4, 3, 0, 3, 0> wxwx;
+					Swizzle<Vec4, T, 4, 3, 0, 3, 1> wxwy;
+					Swizzle<Vec4, T, 4, 3, 0, 3, 2> wxwz;
+					Swizzle<Vec4, T, 4, 3, 0, 3, 3> wxww;
+					Swizzle<Vec4, T, 4, 3, 1, 0, 0> wyxx;
+					Swizzle<Vec4, T, 4, 3, 1, 0, 1> wyxy;
+					Swizzle<Vec4, T, 4, 3, 1, 0, 2> wyxz;
+					Swizzle<Vec4, T, 4, 3, 1, 0, 3> wyxw;
+					Swizzle<Vec4, T, 4, 3, 1, 1, 0> wyyx;
+					Swizzle<Vec4, T, 4, 3, 1, 1, 1> wyyy;
+					Swizzle<Vec4, T, 4, 3, 1, 1, 2> wyyz;
+					Swizzle<Vec4, T, 4, 3, 1, 1, 3> wyyw;
+					Swizzle<Vec4, T, 4, 3, 1, 2, 0> wyzx;
+					Swizzle<Vec4, T, 4, 3, 1, 2, 1> wyzy;
+					Swizzle<Vec4, T, 4, 3, 1, 2, 2> wyzz;
+					Swizzle<Vec4, T, 4, 3, 1, 2, 3> wyzw;
+					Swizzle<Vec4, T, 4, 3, 1, 3, 0> wywx;
+					Swizzle<Vec4, T, 4, 3, 1, 3, 1> wywy;
+					Swizzle<Vec4, T, 4, 3, 1, 3, 2> wywz;
+					Swizzle<Vec4, T, 4, 3, 1, 3, 3> wyww;
+					Swizzle<Vec4, T, 4, 3, 2, 0, 0> wzxx;
+					Swizzle<Vec4, T, 4, 3, 2, 0, 1> wzxy;
+					Swizzle<Vec4, T, 4, 3, 2, 0, 2> wzxz;
+					Swizzle<Vec4, T, 4, 3, 2, 0, 3> wzxw;
+					Swizzle<Vec4, T, 4, 3, 2, 1, 0> wzyx;
+					Swizzle<Vec4, T, 4, 3, 2, 1, 1> wzyy;
+					Swizzle<Vec4, T, 4, 3, 2, 1, 2> wzyz;
+					Swizzle<Vec4, T, 4, 3, 2, 1, 3> wzyw;
+					Swizzle<Vec4, T, 4, 3, 2, 2, 0> wzzx;
+					Swizzle<Vec4, T, 4, 3, 2, 2, 1> wzzy;
+					Swizzle<Vec4, T, 4, 3, 2, 2, 2> wzzz;
+					Swizzle<Vec4, T, 4, 3, 2, 2, 3> wzzw;
+					Swizzle<Vec4, T, 4, 3, 2, 3, 0> wzwx;
+					Swizzle<Vec4, T, 4, 3, 2, 3, 1> wzwy;
+					Swizzle<Vec4, T, 4, 3, 2, 3, 2> wzwz;
+					Swizzle<Vec4, T, 4, 3, 2, 3, 3> wzww;
+					Swizzle<Vec4, T, 4, 3, 3, 0, 0> wwxx;
+					Swizzle<Vec4, T, 4, 3, 3, 0, 1> wwxy;
+					Swizzle<Vec4, T, 4, 3, 3, 0, 2> wwxz;
+					Swizzle<Vec4, T, 4, 3, 3, 0, 3> wwxw;
+					Swizzle<Vec4, T, 4, 3, 3, 1, 0> wwyx;
+					Swizzle<Vec4, T, 4, 3, 3, 1, 1> wwyy;
+					Swizzle<Vec4, T, 4, 3, 3, 1, 2> wwyz;
+					Swizzle<Vec4, T, 4, 3, 3, 1, 3> wwyw;
+					Swizzle<Vec4, T, 4, 3, 3, 2, 0> wwzx;
+					Swizzle<Vec4, T, 4, 3, 3, 2, 1> wwzy;
+					Swizzle<Vec4, T, 4, 3, 3, 2, 2> wwzz;
+					Swizzle<Vec4, T, 4, 3, 3, 2, 3> wwzw;
+					Swizzle<Vec4, T, 4, 3, 3, 3, 0> wwwx;
+					Swizzle<Vec4, T, 4, 3, 3, 3, 1> wwwy;
+					Swizzle<Vec4, T, 4, 3, 3, 3, 2> wwwz;
+					Swizzle<Vec4, T, 4, 3, 3, 3, 3> wwww;
+				#endif
 			};
 
-			Vec4();
-			Vec4(const Vec4<T>& vector);
-			Vec4(std::initializer_list<T> args);
-			Vec4(const T x, const T y, const T z, const T w);
-			Vec4(const T x, const T y, const T z);
-			Vec4(const T scalar);
+			#ifndef VISAGE_MATH_SWIZZLE_UNION
+		private:
+				constexpr std::array<T*, 4> ComponentPointers()
+				{
+					return {{ &x, &y, &z, &w }};
+				}
+
+		public:
+				// Swizzles, v.zyx() reads the components as a Vec3 and assigning to v.zy() writes them back. Swizzles
+				// repeating a component, like v.xx(), only read them
+				constexpr const Vec2<T> xx() const { return Vec2<T>(x, x); }
+				constexpr SwizzleProxy<Vec2, T, 0, 1> xy() { return SwizzleProxy<Vec2, T, 0, 1>(ComponentPointers()); }
+				constexpr Vec2<T> xy() const { return Vec2<T>(x, y); }
+				constexpr SwizzleProxy<Vec2, T, 0, 2> xz() { return SwizzleProxy<Vec2, T, 0, 2>(ComponentPointers()); }
+				constexpr Vec2<T> xz() const { return Vec2<T>(x, z); }
+				constexpr SwizzleProxy<Vec2, T, 0, 3> xw() { return SwizzleProxy<Vec2, T, 0, 3>(ComponentPointers()); }
+				constexpr Vec2<T> xw() const { return Vec2<T>(x, w); }
+				constexpr SwizzleProxy<Vec2, T, 1, 0> yx() { return SwizzleProxy<Vec2, T, 1, 0>(ComponentPointers()); }
+				constexpr Vec2<T> yx() const { return Vec2<T>(y, x); }
+				constexpr const Vec2<T> yy() const { return Vec2<T>(y, y); }
+				constexpr SwizzleProxy<Vec2, T, 1, 2> yz() { return SwizzleProxy<Vec2, T, 1, 2>(ComponentPointers()); }
+				constexpr Vec2<T> yz() const { return Vec2<T>(y, z); }
+				constexpr SwizzleProxy<Vec2, T, 1, 3> yw() { return SwizzleProxy<Vec2, T, 1, 3>(ComponentPointers()); }
+				constexpr Vec2<T> yw() const { return Vec2<T>(y, w); }
+				constexpr SwizzleProxy<Vec2, T, 2, 0> zx() { return SwizzleProxy<Vec2, T, 2, 0>(ComponentPointers()); }
+				constexpr Vec2<T> zx() const { return Vec2<T>(z, x); }
+				constexpr SwizzleProxy<Vec2, T, 2, 1> zy() { return SwizzleProxy<Vec2, T, 2, 1>(ComponentPointers()); }
+				constexpr Vec2<T> zy() const { return Vec2<T>(z, y); }
+				constexpr const Vec2<T> zz() const { return Vec2<T>(z, z); }
+				constexpr SwizzleProxy<Vec2, T, 2, 3> zw() { return SwizzleProxy<Vec2, T, 2, 3>(ComponentPointers()); }
+				constexpr Vec2<T> zw() const { return Vec2<T>(z, w); }
+				constexpr SwizzleProxy<Vec2, T, 3, 0> wx() { return SwizzleProxy<Vec2, T, 3, 0>(ComponentPointers()); }
+				constexpr Vec2<T> wx() const { return Vec2<T>(w, x); }
+				constexpr SwizzleProxy<Vec2, T, 3, 1> wy() { return SwizzleProxy<Vec2, T, 3, 1>(ComponentPointers()); }
+				constexpr Vec2<T> wy() const { return Vec2<T>(w, y); }
+				constexpr SwizzleProxy<Vec2, T, 3, 2> wz() { return SwizzleProxy<Vec2, T, 3, 2>(ComponentPointers()); }
+				constexpr Vec2<T> wz() const { return Vec2<T>(w, z); }
+				constexpr const Vec2<T> ww() const { return Vec2<T>(w, w); }
+
+				constexpr const Vec3<T> xxx() const { return Vec3<T>(x, x, x); }
+				constexpr const Vec3<T> xxy() const { return Vec3<T>(x, x, y); }
+				constexpr const Vec3<T> xxz() const { return Vec3<T>(x, x, z); }
+				constexpr const Vec3<T> xxw() const { return Vec3<T>(x, x, w); }
+				constexpr const Vec3<T> xyx() const { return Vec3<T>(x, y, x); }
+				constexpr const Vec3<T> xyy() const { return Vec3<T>(x, y, y); }
+				constexpr SwizzleProxy<Vec3, T, 0, 1, 2> xyz() { return SwizzleProxy<Vec3, T, 0, 1, 2>(ComponentPointers()); }
+				constexpr Vec3<T> xyz() const { return Vec3<T>(x, y, z); }
+				constexpr SwizzleProxy<Vec3, T, 0, 1, 3> xyw() { return SwizzleProxy<Vec3, T, 0, 1, 3>(ComponentPointers()); }
+				constexpr Vec3<T> xyw() const { return Vec3<T>(x, y, w); }
+				constexpr const Vec3<T> xzx() const { return Vec3<T>(x, z, x); }
+				constexpr SwizzleProxy<Vec3, T, 0, 2, 1> xzy() { return SwizzleProxy<Vec3, T, 0, 2, 1>(ComponentPointers()); }
+				constexpr Vec3<T> xzy() const { return Vec3<T>(x, z, y); }
+				constexpr const Vec3<T> xzz() const { return Vec3<T>(x, z, z); }
+				constexpr SwizzleProxy<Vec3, T, 0, 2, 3> xzw() { return SwizzleProxy<Vec3, T, 0, 2, 3>(ComponentPointers()); }
+				constexpr Vec3<T> xzw() const { return Vec3<T>(x, z, w); }
+				constexpr const Vec3<T> xwx() const { return Vec3<T>(x, w, x); }
+				constexpr SwizzleProxy<Vec3, T, 0, 3, 1> xwy() { return SwizzleProxy<Vec3, T, 0, 3, 1>(ComponentPointers()); }
+				constexpr Vec3<T> xwy() const { return Vec3<T>(x, w, y); }
+				constexpr SwizzleProxy<Vec3, T, 0, 3, 2> xwz() { return SwizzleProxy<Vec3, T, 0, 3, 2>(ComponentPointers()); }
+				constexpr Vec3<T> xwz() const { return Vec3<T>(x, w, z); }
+				constexpr const Vec3<T> xww() const { return Vec3<T>(x, w, w); }
+				constexpr const Vec3<T> yxx() const { return Vec3<T>(y, x, x); }
+				constexpr const Vec3<T> yxy() const { return Vec3<T>(y, x, y); }
+				constexpr SwizzleProxy<Vec3, T, 1, 0, 2> yxz() { return SwizzleProxy<Vec3, T, 1, 0, 2>(ComponentPointers()); }
+				constexpr Vec3<T> yxz() const { return Vec3<T>(y, x, z); }
+				constexpr SwizzleProxy<Vec3, T, 1, 0, 3> yxw() { return SwizzleProxy<Vec3, T, 1, 0, 3>(ComponentPointers()); }
+				constexpr Vec3<T> yxw() const { return Vec3<T>(y, x, w); }
+				constexpr const Vec3<T> yyx() const { return Vec3<T>(y, y, x); }
+				constexpr const Vec3<T> yyy() const { return Vec3<T>(y, y, y); }
+				constexpr const Vec3<T> yyz() const { return Vec3<T>(y, y, z); }
+				constexpr const Vec3<T> yyw() const { return Vec3<T>(y, y, w); }
+				constexpr SwizzleProxy<Vec3, T, 1, 2, 0> yzx() { return SwizzleProxy<Vec3, T, 1, 2, 0>(ComponentPointers()); }
+				constexpr Vec3<T> yzx() const { return Vec3<T>(y, z, x); }
+				constexpr const Vec3<T> yzy() const { return Vec3<T>(y, z, y); }
+				constexpr const Vec3<T> yzz() const { return Vec3<T>(y, z, z); }
+				constexpr SwizzleProxy<Vec3, T, 1, 2, 3> yzw() { return SwizzleProxy<Vec3, T, 1, 2, 3>(ComponentPointers()); }
+				constexpr Vec3<T> yzw() const { return Vec3<T>(y, z, w); }
+				constexpr SwizzleProxy<Vec3, T, 1, 3, 0> ywx() { return SwizzleProxy<Vec3, T, 1, 3, 0>(ComponentPointers()); }
+				constexpr Vec3<T> ywx() const { return Vec3<T>(y, w, x); }
+				constexpr const Vec3<T> ywy() const { return Vec3<T>(y, w, y); }
+				constexpr SwizzleProxy<Vec3, T, 1, 3, 2> ywz() { return SwizzleProxy<Vec3, T, 1, 3, 2>(ComponentPointers()); }
+				constexpr Vec3<T> ywz() const { return Vec3<T>(y, w, z); }
+				constexpr const Vec3<T> yww() const { return Vec3<T>(y, w, w); }
+				constexpr const Vec3<T> zxx() const { return Vec3<T>(z, x, x); }
+				constexpr SwizzleProxy<Vec3, T, 2, 0, 1> zxy() { return SwizzleProxy<Vec3, T, 2, 0, 1>(ComponentPointers()); }
+				constexpr Vec3<T> zxy() const { return Vec3<T>(z, x, y); }
+				constexpr const Vec3<T> zxz() const { return Vec3<T>(z, x, z); }
+				constexpr SwizzleProxy<Vec3, T, 2, 0, 3> zxw() { return SwizzleProxy<Vec3, T, 2, 0, 3>(ComponentPointers()); }
+				constexpr Vec3<T> zxw() const { return Vec3<T>(z, x, w); }
+				constexpr SwizzleProxy<Vec3, T, 2, 1, 0> zyx() { return SwizzleProxy<Vec3, T, 2, 1, 0>(ComponentPointers()); }
+				constexpr Vec3<T> zyx() const { return Vec3<T>(z, y, x); }
+				constexpr const Vec3<T> zyy() const { return Vec3<T>(z, y, y); }
+				constexpr const Vec3<T> zyz() const { return Vec3<T>(z, y, z); }
+				constexpr SwizzleProxy<Vec3, T, 2, 1, 3> zyw() { return SwizzleProxy<Vec3, T, 2, 1, 3>(ComponentPointers()); }
+				constexpr Vec3<T> zyw() const { return Vec3<T>(z, y, w); }
+				constexpr const Vec3<T> zzx() const { return Vec3<T>(z, z, x); }
+				constexpr const Vec3<T> zzy() const { return Vec3<T>(z, z, y); }
+				constexpr const Vec3<T> zzz() const { return Vec3<T>(z, z, z); }
+				constexpr const Vec3<T> zzw() const { return Vec3<T>(z, z, w); }
+				constexpr SwizzleProxy<Vec3, T, 2, 3, 0> zwx() { return SwizzleProxy<Vec3, T, 2, 3, 0>(ComponentPointers()); }
+				constexpr Vec3<T> zwx() const { return Vec3<T>(z, w, x); }
+				constexpr SwizzleProxy<Vec3, T, 2, 3, 1> zwy() { return SwizzleProxy<Vec3, T, 2, 3, 1>(ComponentPointers()); }
+				constexpr Vec3<T> zwy() const { return Vec3<T>(z, w, y); }
+				constexpr const Vec3<T> zwz() const { return Vec3<T>(z, w, z); }
+				constexpr const Vec3<T> zww() const { return Vec3<T>(z, w, w); }
+				constexpr const Vec3<T> wxx() const { return Vec3<T>(w, x, x); }
+				constexpr SwizzleProxy<Vec3, T, 3, 0, 1> wxy() { return SwizzleProxy<Vec3, T, 3, 0, 1>(ComponentPointers()); }
+				constexpr Vec3<T> wxy() const { return Vec3<T>(w, x, y); }
+				constexpr SwizzleProxy<Vec3, T, 3, 0, 2> wxz() { return SwizzleProxy<Vec3, T, 3, 0, 2>(ComponentPointers()); }
+				constexpr Vec3<T> wxz() const { return Vec3<T>(w, x, z); }
+				constexpr const Vec3<T> wxw() const { return Vec3<T>(w, x, w); }
+				constexpr SwizzleProxy<Vec3, T, 3, 1, 0> wyx() { return SwizzleProxy<Vec3, T, 3, 1, 0>(ComponentPointers()); }
+				constexpr Vec3<T> wyx() const { return Vec3<T>(w, y, x); }
+				constexpr const Vec3<T> wyy() const { return Vec3<T>(w, y, y); }
+				constexpr SwizzleProxy<Vec3, T, 3, 1, 2> wyz() { return SwizzleProxy<Vec3, T, 3, 1, 2>(ComponentPointers()); }
+				constexpr Vec3<T> wyz() const { return Vec3<T>(w, y, z); }
+				constexpr const Vec3<T> wyw() const { return Vec3<T>(w, y, w); }
+				constexpr SwizzleProxy<Vec3, T, 3, 2, 0> wzx() { return SwizzleProxy<Vec3, T, 3, 2, 0>(ComponentPointers()); }
+				constexpr Vec3<T> wzx() const { return Vec3<T>(w, z, x); }
+				constexpr SwizzleProxy<Vec3, T, 3, 2, 1> wzy() { return SwizzleProxy<Vec3, T, 3, 2, 1>(ComponentPointers()); }
+				constexpr Vec3<T> wzy() const { return Vec3<T>(w, z, y); }
+				constexpr const Vec3<T> wzz() const { return Vec3<T>(w, z, z); }
+				constexpr const Vec3<T> wzw() const { return Vec3<T>(w, z, w); }
+				constexpr const Vec3<T> wwx() const { return Vec3<T>(w, w, x); }
+				constexpr const Vec3<T> wwy() const { return Vec3<T>(w, w, y); }
+				constexpr const Vec3<T> wwz() const { return Vec3<T>(w, w, z); }
+				constexpr const Vec3<T> www() const { return Vec3<T>(w, w, w); }
+
+				constexpr const Vec4<T> xxxx() const { return Vec4<T>(x, x, x, x); }
+				constexpr const Vec4<T> xxxy() const { return Vec4<T>(x, x, x, y); }
+				constexpr const Vec4<T> xxxz() const { return Vec4<T>(x, x, x, z); }
+				constexpr const Vec4<T> xxxw() const { return Vec4<T>(x, x, x, w); }
+				constexpr const Vec4<T> xxyx() const { return Vec4<T>(x, x, y, x); }
+				constexpr const Vec4<T> xxyy() const { return Vec4<T>(x, x, y, y); }
+				constexpr const Vec4<T> xxyz() const { return Vec4<T>(x, x, y, z); }
+				constexpr const Vec4<T> xxyw() const { return Vec4<T>(x, x, y, w); }
+				constexpr const Vec4<T> xxzx() const { return Vec4<T>(x, x, z, x); }
+				constexpr const Vec4<T> xxzy() const { return Vec4<T>(x, x, z, y); }
+				constexpr const Vec4<T> xxzz() const { return Vec4<T>(x, x, z, z); }
+				constexpr const Vec4<T> xxzw() const { return Vec4<T>(x, x, z, w); }
+				constexpr const Vec4<T> xxwx() const { return Vec4<T>(x, x, w, x); }
+				constexpr const Vec4<T> xxwy() const { return Vec4<T>(x, x, w, y); }
+				constexpr const Vec4<T> xxwz() const { return Vec4<T>(x, x, w, z); }
+				constexpr const Vec4<T> xxww() const { return Vec4<T>(x, x, w, w); }
+				constexpr const Vec4<T> xyxx() const { return Vec4<T>(x, y, x, x); }
+				constexpr const Vec4<T> xyxy() const { return Vec4<T>(x, y, x, y); }
+				constexpr const Vec4<T> xyxz() const { return Vec4<T>(x, y, x, z); }
+				constexpr const Vec4<T> xyxw() const { return Vec4<T>(x, y, x, w); }
+				constexpr const Vec4<T> xyyx() const { return Vec4<T>(x, y, y, x); }
+				constexpr const Vec4<T> xyyy() const { return Vec4<T>(x, y, y, y); }
+				constexpr const Vec4<T> xyyz() const { return Vec4<T>(x, y, y, z); }
+				constexpr const Vec4<T> xyyw() const { return Vec4<T>(x, y, y, w); }
+				constexpr const Vec4<T> xyzx() const { return Vec4<T>(x, y, z, x); }
+				constexpr const Vec4<T> xyzy() const { return Vec4<T>(x, y, z, y); }
+				constexpr const Vec4<T> xyzz() const { return Vec4<T>(x, y, z, z); }
+				constexpr SwizzleProxy<Vec4, T, 0, 1, 2, 3> xyzw() { return SwizzleProxy<Vec4, T, 0, 1, 2, 3>(ComponentPointers()); }
+				constexpr Vec4<T> xyzw() const { return Vec4<T>(x, y, z, w); }
+				constexpr const Vec4<T> xywx() const { return Vec4<T>(x, y, w, x); }
+				constexpr const Vec4<T> xywy() const { return Vec4<T>(x, y, w, y); }
+				constexpr SwizzleProxy<Vec4, T, 0, 1, 3, 2> xywz() { return SwizzleProxy<Vec4, T, 0, 1, 3, 2>(ComponentPointers()); }
+				constexpr Vec4<T> xywz() const { return Vec4<T>(x, y, w, z); }
+				constexpr const Vec4<T> xyww() const { return Vec4<T>(x, y, w, w); }
+				constexpr const Vec4<T> xzxx() const { return Vec4<T>(x, z, x, x); }
+				constexpr const Vec4<T> xzxy() const { return Vec4<T>(x, z, x, y); }
+				constexpr const Vec4<T> xzxz() const { return Vec4<T>(x, z, x, z); }
+				constexpr const Vec4<T> xzxw() const { return Vec4<T>(x, z, x, w); }
+				constexpr const Vec4<T> xzyx() const { return Vec4<T>(x, z, y, x); }
+				constexpr const Vec4<T> xzyy() const { return Vec4<T>(x, z, y, y); }
+				constexpr const Vec4<T> xzyz() const { return Vec4<T>(x, z, y, z); }
+				constexpr SwizzleProxy<Vec4, T, 0, 2, 1, 3> xzyw() { return SwizzleProxy<Vec4, T, 0, 2, 1, 3>(ComponentPointers()); }
+				constexpr Vec4<T> xzyw() const { return Vec4<T>(x, z, y, w); }
+				constexpr const Vec4<T> xzzx() const { return Vec4<T>(x, z, z, x); }
+				constexpr const Vec4<T> xzzy() const { return Vec4<T>(x, z, z, y); }
+				constexpr const Vec4<T> xzzz() const { return Vec4<T>(x, z, z, z); }
+				constexpr const Vec4<T> xzzw() const { return Vec4<T>(x, z, z, w); }
+				constexpr const Vec4<T> xzwx() const { return Vec4<T>(x, z, w, x); }
+				constexpr SwizzleProxy<Vec4, T, 0, 2, 3, 1> xzwy() { return SwizzleProxy<Vec4, T, 0, 2, 3, 1>(ComponentPointers()); }
+				constexpr Vec4<T> xzwy() const { return Vec4<T>(x, z, w, y); }
+				constexpr const Vec4<T> xzwz() const { return Vec4<T>(x, z, w, z); }
+				constexpr const Vec4<T> xzww() const { return Vec4<T>(x, z, w, w); }
+				constexpr const Vec4<T> xwxx() const { return Vec4<T>(x, w, x, x); }
+				constexpr const Vec4<T> xwxy() const { return Vec4<T>(x, w, x, y); }
+				constexpr const Vec4<T> xwxz() const { return Vec4<T>(x, w, x, z); }
+				constexpr const Vec4<T> xwxw() const { return Vec4<T>(x, w, x, w); }
+				constexpr const Vec4<T> xwyx() const { return Vec4<T>(x, w, y, x); }
+				constexpr const Vec4<T> xwyy() const { return Vec4<T>(x, w, y, y); }
+				constexpr SwizzleProxy<Vec4, T, 0, 3, 1, 2> xwyz() { return SwizzleProxy<Vec4, T, 0, 3, 1, 2>(ComponentPointers()); }
+				constexpr Vec4<T> xwyz() const { return Vec4<T>(x, w, y, z); }
+				constexpr const Vec4<T> xwyw() const { return Vec4<T>(x, w, y, w); }
+				constexpr const Vec4<T> xwzx() const { return Vec4<T>(x, w, z, x); }
+				constexpr SwizzleProxy<Vec4, T, 0, 3, 2, 1> xwzy() { return SwizzleProxy<Vec4, T, 0, 3, 2, 1>(ComponentPointers()); }
+				constexpr Vec4<T> xwzy() const { return Vec4<T>(x, w, z, y); }
+				constexpr const Vec4<T> xwzz() const { return Vec4<T>(x, w, z, z); }
+				constexpr const Vec4<T> xwzw() const { return Vec4<T>(x, w, z, w); }
+				constexpr const Vec4<T> xwwx() const { return Vec4<T>(x, w, w, x); }
+				constexpr const Vec4<T> xwwy() const { return Vec4<T>(x, w, w, y); }
+				constexpr const Vec4<T> xwwz() const { return Vec4<T>(x, w, w, z); }
+				constexpr const Vec4<T> xwww() const { return Vec4<T>(x, w, w, w); }
+				constexpr const Vec4<T> yxxx() const { return Vec4<T>(y, x, x, x); }
+				constexpr const Vec4<T> yxxy() const { return Vec4<T>(y, x, x, y); }
+				constexpr const Vec4<T> yxxz() const { return Vec4<T>(y, x, x, z); }
+				constexpr const Vec4<T> yxxw() const { return Vec4<T>(y, x, x, w); }
+				constexpr const Vec4<T> yxyx() const { return Vec4<T>(y, x, y, x); }
+				constexpr const Vec4<T> yxyy() const { return Vec4<T>(y, x, y, y); }
+				constexpr const Vec4<T> yxyz() const { return Vec4<T>(y, x, y, z); }
+				constexpr const Vec4<T> yxyw() const { return Vec4<T>(y, x, y, w); }
+				constexpr const Vec4<T> yxzx() const { return Vec4<T>(y, x, z, x); }
+				constexpr const Vec4<T> yxzy() const { return Vec4<T>(y, x, z, y); }
+				constexpr const Vec4<T> yxzz() const { return Vec4<T>(y, x, z, z); }
+				constexpr SwizzleProxy<Vec4, T, 1, 0, 2, 3> yxzw() { return SwizzleProxy<Vec4, T, 1, 0, 2, 3>(ComponentPointers()); }
+				constexpr Vec4<T> yxzw() const { return Vec4<T>(y, x, z, w); }
+				constexpr const Vec4<T> yxwx() const { return Vec4<T>(y, x, w, x); }
+				constexpr const Vec4<T> yxwy() const { return Vec4<T>(y, x, w, y); }
+				constexpr SwizzleProxy<Vec4, T, 1, 0, 3, 2> yxwz() { return SwizzleProxy<Vec4, T, 1, 0, 3, 2>(ComponentPointers()); }
+				constexpr Vec4<T> yxwz() const { return Vec4<T>(y, x, w, z); }
+				constexpr const Vec4<T> yxww() const { return Vec4<T>(y, x, w, w); }
+				constexpr const Vec4<T> yyxx() const { return Vec4<T>(y, y, x, x); }
+				constexpr const Vec4<T> yyxy() const { return Vec4<T>(y, y, x, y); }
+				constexpr const Vec4<T> yyxz() const { return Vec4<T>(y, y, x, z); }
+				constexpr const Vec4<T> yyxw() const { return Vec4<T>(y, y, x, w); }
+				constexpr const Vec4<T> yyyx() const { return Vec4<T>(y, y, y, x); }
+				constexpr const Vec4<T> yyyy() const { return Vec4<T>(y, y, y, y); }
+				constexpr const Vec4<T> yyyz() const { return Vec4<T>(y, y, y, z); }
+				constexpr const Vec4<T> yyyw() const { return Vec4<T>(y, y, y, w); }
+				constexpr const Vec4<T> yyzx() const { return Vec4<T>(y, y, z, x); }
+				constexpr const Vec4<T> yyzy() const { return Vec4<T>(y, y, z, y); }
+				constexpr const Vec4<T> yyzz() const { return Vec4<T>(y, y, z, z); }
+				constexpr const Vec4<T> yyzw() const { return Vec4<T>(y, y, z, w); }
+				constexpr const Vec4<T> yywx() const { return Vec4<T>(y, y, w, x); }
+				constexpr const Vec4<T> yywy() const { return Vec4<T>(y, y, w, y); }
+				constexpr const Vec4<T> yywz() const { return Vec4<T>(y, y, w, z); }
+				constexpr const Vec4<T> yyww() const { return Vec4<T>(y, y, w, w); }
+				constexpr const Vec4<T> yzxx() const { return Vec4<T>(y, z, x, x); }
+				constexpr const Vec4<T> yzxy() const { return Vec4<T>(y, z, x, y); }
+				constexpr const Vec4<T> yzxz() const { return Vec4<T>(y, z, x, z); }
+				constexpr SwizzleProxy<Vec4, T, 1, 2, 0, 3> yzxw() { return SwizzleProxy<Vec4, T, 1, 2, 0, 3>(ComponentPointers()); }
+				constexpr Vec4<T> yzxw() const { return Vec4<T>(y, z, x, w); }
+				constexpr const Vec4<T> yzyx() const { return Vec4<T>(y, z, y, x); }
+				constexpr const Vec4<T> yzyy() const { return Vec4<T>(y, z, y, y); }
+				constexpr const Vec4<T> yzyz() const { return Vec4<T>(y, z, y, z); }
+				constexpr const Vec4<T> yzyw() const { return Vec4<T>(y, z, y, w); }
+				constexpr const Vec4<T> yzzx() const { return Vec4<T>(y, z, z, x); }
+				constexpr const Vec4<T> yzzy() const { return Vec4<T>(y, z, z, y); }
+				constexpr const Vec4<T> yzzz() const { return Vec4<T>(y, z, z, z); }
+				constexpr const Vec4<T> yzzw() const { return Vec4<T>(y, z, z, w); }
+				constexpr SwizzleProxy<Vec4, T, 1, 2, 3, 0> yzwx() { return SwizzleProxy<Vec4, T, 1, 2, 3, 0>(ComponentPointers()); }
+				constexpr Vec4<T> yzwx() const { return Vec4<T>(y, z, w, x); }
+				constexpr const Vec4<T> yzwy() const { return Vec4<T>(y, z, w, y); }
+				constexpr const Vec4<T> yzwz() const { return Vec4<T>(y, z, w, z); }
+				constexpr const Vec4<T> yzww() const { return Vec4<T>(y, z, w, w); }
+				constexpr const Vec4<T> ywxx() const { return Vec4<T>(y, w, x, x); }
+				constexpr const Vec4<T> ywxy() const { return Vec4<T>(y, w, x, y); }
+				constexpr SwizzleProxy<Vec4, T, 1, 3, 0, 2> ywxz() { return SwizzleProxy<Vec4, T, 1, 3, 0, 2>(ComponentPointers()); }
+				constexpr Vec4<T> ywxz() const { return Vec4<T>(y, w, x, z); }
+				constexpr const Vec4<T> ywxw() const { return Vec4<T>(y, w, x, w); }
+				constexpr const Vec4<T> ywyx() const { return Vec4<T>(y, w, y, x); }
+				constexpr const Vec4<T> ywyy() const { return Vec4<T>(y, w, y, y); }
+				constexpr const Vec4<T> ywyz() const { return Vec4<T>(y, w, y, z); }
+				constexpr const Vec4<T> ywyw() const { return Vec4<T>(y, w, y, w); }
+				constexpr SwizzleProxy<Vec4, T, 1, 3, 2, 0> ywzx() { return SwizzleProxy<Vec4, T, 1, 3, 2, 0>(ComponentPointers()); }
+				constexpr Vec4<T> ywzx() const { return Vec4<T>(y, w, z, x); }
+				constexpr const Vec4<T> ywzy() const { return Vec4<T>(y, w, z, y); }
+				constexpr const Vec4<T> ywzz() const { return Vec4<T>(y, w, z, z); }
+				constexpr const Vec4<T> ywzw() const { return Vec4<T>(y, w, z, w); }
+				constexpr const Vec4<T> ywwx() const { return Vec4<T>(y, w, w, x); }
+				constexpr const Vec4<T> ywwy() const { return Vec4<T>(y, w, w, y); }
+				constexpr const Vec4<T> ywwz() const { return Vec4<T>(y, w, w, z); }
+				constexpr const Vec4<T> ywww() const { return Vec4<T>(y, w, w, w); }
+				constexpr const Vec4<T> zxxx() const { return Vec4<T>(z, x, x, x); }
+				constexpr const Vec4<T> zxxy() const { return Vec4<T>(z, x, x, y); }
+				constexpr const Vec4<T> zxxz() const { return Vec4<T>(z, x, x, z); }
+				constexpr const Vec4<T> zxxw() const { return Vec4<T>(z, x, x, w); }
+				constexpr const Vec4<T> zxyx() const { return Vec4<T>(z, x, y, x); }
+				constexpr const Vec4<T> zxyy() const { return Vec4<T>(z, x, y, y); }
+				constexpr const Vec4<T> zxyz() const { return Vec4<T>(z, x, y, z); }
+				constexpr SwizzleProxy<Vec4, T, 2, 0, 1, 3> zxyw() { return SwizzleProxy<Vec4, T, 2, 0, 1, 3>(ComponentPointers()); }
+				constexpr Vec4<T> zxyw() const { return Vec4<T>(z, x, y, w); }
+				constexpr const Vec4<T> zxzx() const { return Vec4<T>(z, x, z, x); }
+				constexpr const Vec4<T> zxzy() const { return Vec4<T>(z, x, z, y); }
+				constexpr const Vec4<T> zxzz() const { return Vec4<T>(z, x, z, z); }
+				constexpr const Vec4<T> zxzw() const { return Vec4<T>(z, x, z, w); }
+				constexpr const Vec4<T> zxwx() const { return Vec4<T>(z, x, w, x); }
+				constexpr SwizzleProxy<Vec4, T, 2, 0, 3, 1> zxwy() { return SwizzleProxy<Vec4, T, 2, 0, 3, 1>(ComponentPointers()); }
+				constexpr Vec4<T> zxwy() const { return Vec4<T>(z, x, w, y); }
+				constexpr const Vec4<T> zxwz() const { return Vec4<T>(z, x, w, z); }
+				constexpr const Vec4<T> zxww() const { return Vec4<T>(z, x, w, w); }
+				constexpr const Vec4<T> zyxx() const { return Vec4<T>(z, y, x, x); }
+				constexpr const Vec4<T> zyxy() const { return Vec4<T>(z, y, x, y); }
+				constexpr const Vec4<T> zyxz() const { return Vec4<T>(z, y, x, z); }
+				constexpr SwizzleProxy<Vec4, T, 2, 1, 0, 3> zyxw() { return SwizzleProxy<Vec4, T, 2, 1, 0, 3>(ComponentPointers()); }
+				constexpr Vec4<T> zyxw() const { return Vec4<T>(z, y, x, w); }
+				constexpr const Vec4<T> zyyx() const { return Vec4<T>(z, y, y, x); }
+				constexpr const Vec4<T> zyyy() const { return Vec4<T>(z, y, y, y); }
+				constexpr const Vec4<T> zyyz() const { return Vec4<T>(z, y, y, z); }
+				constexpr const Vec4<T> zyyw() const { return Vec4<T>(z, y, y, w); }
+				constexpr const Vec4<T> zyzx() const { return Vec4<T>(z, y, z, x); }
+				constexpr const Vec4<T> zyzy() const { return Vec4<T>(z, y, z, y); }
+				constexpr const Vec4<T> zyzz() const { return Vec4<T>(z, y, z, z); }
+				constexpr const Vec4<T> zyzw() const { return Vec4<T>(z, y, z, w); }
+				constexpr SwizzleProxy<Vec4, T, 2, 1, 3, 0> zywx() { return SwizzleProxy<Vec4, T, 2, 1, 3, 0>(ComponentPointers()); }
+				constexpr Vec4<T> zywx() const { return Vec4<T>(z, y, w, x); }
+				constexpr const Vec4<T> zywy() const { return Vec4<T>(z, y, w, y); }
+				constexpr const Vec4<T> zywz() const { return Vec4<T>(z, y, w, z); }
+				constexpr const Vec4<T> zyww() const { return Vec4<T>(z, y, w, w); }
+				constexpr const Vec4<T> zzxx() const { return Vec4<T>(z, z, x, x); }
+				constexpr const Vec4<T> zzxy() const { return Vec4<T>(z, z, x, y); }
+				constexpr const Vec4<T> zzxz() const { return Vec4<T>(z, z, x, z); }
+				constexpr const Vec4<T> zzxw() const { return Vec4<T>(z, z, x, w); }
+				constexpr const Vec4<T> zzyx() const { return Vec4<T>(z, z, y, x); }
+				constexpr const Vec4<T> zzyy() const { return Vec4<T>(z, z, y, y); }
+				constexpr const Vec4<T> zzyz() const { return Vec4<T>(z, z, y, z); }
+				constexpr const Vec4<T> zzyw() const { return Vec4<T>(z, z, y, w); }
+				constexpr const Vec4<T> zzzx() const { return Vec4<T>(z, z, z, x); }
+				constexpr const Vec4<T> zzzy() const { return Vec4<T>(z, z, z, y); }
+				constexpr const Vec4<T> zzzz() const { return Vec4<T>(z, z, z, z); }
+				constexpr const Vec4<T> zzzw() const { return Vec4<T>(z, z, z, w); }
+				constexpr const Vec4<T> zzwx() const { return Vec4<T>(z, z, w, x); }
+				constexpr const Vec4<T> zzwy() const { return Vec4<T>(z, z, w, y); }
+				constexpr const Vec4<T> zzwz() const { return Vec4<T>(z, z, w, z); }
+				constexpr const Vec4<T> zzww() const { return Vec4<T>(z, z, w, w); }
+				constexpr const Vec4<T> zwxx() const { return Vec4<T>(z, w, x, x); }
+				constexpr SwizzleProxy<Vec4, T, 2, 3, 0, 1> zwxy() { return SwizzleProxy<Vec4, T, 2, 3, 0, 1>(ComponentPointers()); }
+				constexpr Vec4<T> zwxy() const { return Vec4<T>(z, w, x, y); }
+				constexpr const Vec4<T> zwxz() const { return Vec4<T>(z, w, x, z); }
+				constexpr const Vec4<T> zwxw() const { return Vec4<T>(z, w, x, w); }
+				constexpr SwizzleProxy<Vec4, T, 2, 3, 1, 0> zwyx() { return SwizzleProxy<Vec4, T, 2, 3, 1, 0>(ComponentPointers()); }
+				constexpr Vec4<T> zwyx() const { return Vec4<T>(z, w, y, x); }
+				constexpr const Vec4<T> zwyy() const { return Vec4<T>(z, w, y, y); }
+				constexpr const Vec4<T> zwyz() const { return Vec4<T>(z, w, y, z); }
+				constexpr const Vec4<T> zwyw() const { return Vec4<T>(z, w, y, w); }
+				constexpr const Vec4<T> zwzx() const { return Vec4<T>(z, w, z, x); }
+				constexpr const Vec4<T> zwzy() const { return Vec4<T>(z, w, z, y); }
+				constexpr const Vec4<T> zwzz() const { return Vec4<T>(z, w, z, z); }
+				constexpr const Vec4<T> zwzw() const { return Vec4<T>(z, w, z, w); }
+				constexpr const Vec4<T> zwwx() const { return Vec4<T>(z, w, w, x); }
+				constexpr const Vec4<T> zwwy() const { return Vec4<T>(z, w, w, y); }
+				constexpr const Vec4<T> zwwz() const { return Vec4<T>(z, w, w, z); }
+				constexpr const Vec4<T> zwww() const { return Vec4<T>(z, w, w, w); }
+				constexpr const Vec4<T> wxxx() const { return Vec4<T>(w, x, x, x); }
+				constexpr const Vec4<T> wxxy() const { return Vec4<T>(w, x, x, y); }
+				constexpr const Vec4<T> wxxz() const { return Vec4<T>(w, x, x, z); }
+				constexpr const Vec4<T> wxxw() const { return Vec4<T>(w, x, x, w); }
+				constexpr const Vec4<T> wxyx() const { return Vec4<T>(w, x, y, x); }
+				constexpr const Vec4<T> wxyy() const { return Vec4<T>(w, x, y, y); }
+				constexpr SwizzleProxy<Vec4, T, 3, 0, 1, 2> wxyz() { return SwizzleProxy<Vec4, T, 3, 0, 1, 2>(ComponentPointers()); }
+				constexpr Vec4<T> wxyz() const { return Vec4<T>(w, x, y, z); }
+				constexpr const Vec4<T> wxyw() const { return Vec4<T>(w, x, y, w); }
+				constexpr const Vec4<T> wxzx() const { return Vec4<T>(w, x, z, x); }
+				constexpr SwizzleProxy<Vec4, T, 3, 0, 2, 1> wxzy() { return SwizzleProxy<Vec4, T, 3, 0, 2, 1>(ComponentPointers()); }
+				constexpr Vec4<T> wxzy() const { return Vec4<T>(w, x, z, y); }
+				constexpr const Vec4<T> wxzz() const { return Vec4<T>(w, x, z, z); }
+				constexpr const Vec4<T> wxzw() const { return Vec4<T>(w, x, z, w); }
+				constexpr const Vec4<T> wxwx() const { return Vec4<T>(w, x, w, x); }
+				constexpr const Vec4<T> wxwy() const { return Vec4<T>(w, x, w, y); }
+				constexpr const Vec4<T> wxwz() const { return Vec4<T>(w, x, w, z); }
+				constexpr const Vec4<T> wxww() const { return Vec4<T>(w, x, w, w); }
+				constexpr const Vec4<T> wyxx() const { return Vec4<T>(w, y, x, x); }
+				constexpr const Vec4<T> wyxy() const { return Vec4<T>(w, y, x, y); }
+				constexpr SwizzleProxy<Vec4, T, 3, 1, 0, 2> wyxz() { return SwizzleProxy<Vec4, T, 3, 1, 0, 2>(ComponentPointers()); }
+				constexpr Vec4<T> wyxz() const { return Vec4<T>(w, y, x, z); }
+				constexpr const Vec4<T> wyxw() const { return Vec4<T>(w, y, x, w); }
+				constexpr const Vec4<T> wyyx() const { return Vec4<T>(w, y, y, x); }
+				constexpr const Vec4<T> wyyy() const { return Vec4<T>(w, y, y, y); }
+				constexpr const Vec4<T> wyyz() const { return Vec4<T>(w, y, y, z); }
+				constexpr const Vec4<T> wyyw() const { return Vec4<T>(w, y, y, w); }
+				constexpr SwizzleProxy<Vec4, T, 3, 1, 2, 0> wyzx() { return SwizzleProxy<Vec4, T, 3, 1, 2, 0>(ComponentPointers()); }
+				constexpr Vec4<T> wyzx() const { return Vec4<T>(w, y, z, x); }
+				constexpr const Vec4<T> wyzy() const { return Vec4<T>(w, y, z, y); }
+				constexpr const Vec4<T> wyzz() const { return Vec4<T>(w, y, z, z); }
+				constexpr const Vec4<T> wyzw() const { return Vec4<T>(w, y, z, w); }
+				constexpr const Vec4<T> wywx() const { return Vec4<T>(w, y, w, x); }
+				constexpr const Vec4<T> wywy() const { return Vec4<T>(w, y, w, y); }
+				constexpr const Vec4<T> wywz() const { return Vec4<T>(w, y, w, z); }
+				constexpr const Vec4<T> wyww() const { return Vec4<T>(w, y, w, w); }
+				constexpr const Vec4<T> wzxx() const { return Vec4<T>(w, z, x, x); }
+				constexpr SwizzleProxy<Vec4, T, 3, 2, 0, 1> wzxy() { return SwizzleProxy<Vec4, T, 3, 2, 0, 1>(ComponentPointers()); }
+				constexpr Vec4<T> wzxy() const { return Vec4<T>(w, z, x, y); }
+				constexpr const Vec4<T> wzxz() const { return Vec4<T>(w, z, x, z); }
+				constexpr const Vec4<T> wzxw() const { return Vec4<T>(w, z, x, w); }
+				constexpr SwizzleProxy<Vec4, T, 3, 2, 1, 0> wzyx() { return SwizzleProxy<Vec4, T, 3, 2, 1, 0>(ComponentPointers()); }
+				constexpr Vec4<T> wzyx() const { return Vec4<T>(w, z, y, x); }
+				constexpr const Vec4<T> wzyy() const { return Vec4<T>(w, z, y, y); }
+				constexpr const Vec4<T> wzyz() const { return Vec4<T>(w, z, y, z); }
+				constexpr const Vec4<T> wzyw() const { return Vec4<T>(w, z, y, w); }
+				constexpr const Vec4<T> wzzx() const { return Vec4<T>(w, z, z, x); }
+				constexpr const Vec4<T> wzzy() const { return Vec4<T>(w, z, z, y); }
+				constexpr const Vec4<T> wzzz() const { return Vec4<T>(w, z, z, z); }
+				constexpr const Vec4<T> wzzw() const { return Vec4<T>(w, z, z, w); }
+				constexpr const Vec4<T> wzwx() const { return Vec4<T>(w, z, w, x); }
+				constexpr const Vec4<T> wzwy() const { return Vec4<T>(w, z, w, y); }
+				constexpr const Vec4<T> wzwz() const { return Vec4<T>(w, z, w, z); }
+				constexpr const Vec4<T> wzww() const { return Vec4<T>(w, z, w, w); }
+				constexpr const Vec4<T> wwxx() const { return Vec4<T>(w, w, x, x); }
+				constexpr const Vec4<T> wwxy() const { return Vec4<T>(w, w, x, y); }
+				constexpr const Vec4<T> wwxz() const { return Vec4<T>(w, w, x, z); }
+				constexpr const Vec4<T> wwxw() const { return Vec4<T>(w, w, x, w); }
+				constexpr const Vec4<T> wwyx() const { return Vec4<T>(w, w, y, x); }
+				constexpr const Vec4<T> wwyy() const { return Vec4<T>(w, w, y, y); }
+				constexpr const Vec4<T> wwyz() const { return Vec4<T>(w, w, y, z); }
+				constexpr const Vec4<T> wwyw() const { return Vec4<T>(w, w, y, w); }
+				constexpr const Vec4<T> wwzx() const { return Vec4<T>(w, w, z, x); }
+				constexpr const Vec4<T> wwzy() const { return Vec4<T>(w, w, z, y); }
+				constexpr const Vec4<T> wwzz() const { return Vec4<T>(w, w, z, z); }
+				constexpr const Vec4<T> wwzw() const { return Vec4<T>(w, w, z, w); }
+				constexpr const Vec4<T> wwwx() const { return Vec4<T>(w, w, w, x); }
+				constexpr const Vec4<T> wwwy() const { return Vec4<T>(w, w, w, y); }
+				constexpr const Vec4<T> wwwz() const { return Vec4<T>(w, w, w, z); }
+				constexpr const Vec4<T> wwww() const { return Vec4<T>(w, w, w, w); }
+			#endif
+
+			constexpr Vec4();
+			Vec4(const Vec4<T>& vector) = default;
+			constexpr Vec4(std::initializer_list<T> args);
+			constexpr Vec4(const T x, const T y, const T z, const T w);
+			constexpr Vec4(const T x, const T y, const T z);
+			constexpr Vec4(const T scalar);
 
 			~Vec4() = default;
 
 			T Magnitude() const;
-			T SqrMagnitude() const;
+			constexpr T SqrMagnitude() const;
 			Vec4<T> Normalized() const;
 			Vec4<T>& Normalize();
-			Vec4<T> Renormalized() const;
-			Vec4<T>& Renormalize();
-			Vec4<T> Negated() const;
-			Vec4<T>& Negate();
+			constexpr Vec4<T> Renormalized() const;
+			constexpr Vec4<T>& Renormalize();
+			constexpr Vec4<T> Negated() const;
+			constexpr Vec4<T>& Negate();
 
-			static T Dot(const Vec4<T>& leftVector, const Vec4<T>& rightVector);
-			static Vec4<T> Lerp(const Vec4<T>& leftVector, const Vec4<T>& rightVector, const T t);
-			static Vec4<T> Zero();
+			static constexpr T Dot(const Vec4<T>& leftVector, const Vec4<T>& rightVector);
+			static constexpr Vec4<T> Lerp(const Vec4<T>& leftVector, const Vec4<T>& rightVector, const T t);
+			static constexpr Vec4<T> Zero();
 
-			Vec4<T>& operator=(const Vec4<T>& vector);
-			Vec4<T>& operator+=(const Vec4<T>& vector);
-			Vec4<T>& operator-=(const Vec4<T>& vector);
+			Vec4<T>& operator=(const Vec4<T>& vector) = default;
+			constexpr Vec4<T>& operator+=(const Vec4<T>& vector);
+			constexpr Vec4<T>& operator-=(const Vec4<T>& vector);
 
-			Vec4& operator*=(const T scalar);
-			Vec4& operator/=(const T scalar);
+			constexpr Vec4& operator*=(const T scalar);
+			constexpr Vec4& operator/=(const T scalar);
 
-			friend bool operator==(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
+			friend constexpr bool operator==(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
 			{
 				return NearEquals(leftVector.x, rightVector.x) &&
 					NearEquals(leftVector.y, rightVector.y) &&
@@ -397,45 +809,39 @@ namespace Visage
 					NearEquals(leftVector.w, rightVector.w);
 			}
 
-			friend bool operator!=(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
+			friend constexpr bool operator!=(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
 			{
 				return !(leftVector == rightVector);
 			}
 
-			friend Vec4<T> operator+(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
+			friend constexpr Vec4<T> operator+(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
 			{
-				Vec4<T> leftVectorCopy = leftVector;
-				return leftVectorCopy += rightVector;
+				return Vec4<T>(leftVector.x + rightVector.x, leftVector.y + rightVector.y, leftVector.z + rightVector.z, leftVector.w + rightVector.w);
 			}
 
-			friend Vec4<T> operator-(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
+			friend constexpr Vec4<T> operator-(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
 			{
-				Vec4<T> leftVectorCopy = leftVector;
-				return leftVectorCopy -= rightVector;
+				return Vec4<T>(leftVector.x - rightVector.x, leftVector.y - rightVector.y, leftVector.z - rightVector.z, leftVector.w - rightVector.w);
 			}
 
-			friend Vec4<T> operator*(const Vec4<T>& vector, const T scalar)
+			friend constexpr Vec4<T> operator*(const Vec4<T>& vector, const T scalar)
 			{
-				Vec4<T> vectorCopy = vector;
-				return vectorCopy *= scalar;
+				return Vec4<T>(vector.x * scalar, vector.y * scalar, vector.z * scalar, vector.w * scalar);
 			}
 
-			friend Vec4<T> operator*(const T scalar, const Vec4<T>& vector)
+			friend constexpr Vec4<T> operator*(const T scalar, const Vec4<T>& vector)
 			{
-				Vec4<T> vectorCopy = vector;
-				return vectorCopy *= scalar;
+				return Vec4<T>(scalar * vector.x, scalar * vector.y, scalar * vector.z, scalar * vector.w);
 			}
 
-			friend Vec4<T> operator/(const Vec4<T>& vector, const T scalar)
+			friend constexpr Vec4<T> operator/(const Vec4<T>& vector, const T scalar)
 			{
-				Vec4<T> vectorCopy = vector;
-				return vectorCopy /= scalar;
+				return Vec4<T>(vector.x / scalar, vector.y / scalar, vector.z / scalar, vector.w / scalar);
 			}
 
-			friend Vec4<T> operator/(const T scalar, const Vec4<T>& vector)
+			friend constexpr Vec4<T> operator/(const T scalar, const Vec4<T>& vector)
 			{
-				Vec4<T> vectorCopy = vector;
-				return vectorCopy /= scalar;
+				return Vec4<T>(scalar / vector.x, scalar / vector.y, scalar / vector.z, scalar / vector.w);
 			}
 
 			friend std::ostream& operator<<(std::ostream& stream, const Vec4<T>& vector)
@@ -453,3 +859,4 @@ namespace Visage
 }
 
 #include "Vec4.inl"
+#include "Vec4Simd.inl"
@@ -10,41 +10,39 @@ namespace Visage
 	namespace Math
 	{
 		template <typename T>
-		Vec4<T>::Vec4()
+		constexpr Vec4<T>::Vec4()
 			: x(0), y(0), z(0), w(0)
 		{
 		}
 
-		template <typename T>
-		Vec4<T>::Vec4(const Vec4<T>& vector)
-			: x(vector.x), y(vector.y), z(vector.z), w(vector.w)
-		{
-		}
-
 		template<typename T>
-		Vec4<T>::Vec4(std::initializer_list<T> args)
+		constexpr Vec4<T>::Vec4(std::initializer_list<T> args)
+			: x(0), y(0), z(0), w(0)
 		{
+			assert(args.size() <= 4);
+
+			T* components[] = { &x, &y, &z, &w };
 			int index = 0;
 			for (auto begin = args.begin(); begin != args.end(); ++begin)
 			{
-				this->data.at(index++) = *begin;
+				*components[index++] = *begin;
 			}
 		}
 
 		template <typename T>
-		Vec4<T>::Vec4(const T x, const T y, const T z, const T w)
+		constexpr Vec4<T>::Vec4(const T x, const T y, const T z, const T w)
 			: x(x), y(y), z(z), w(w)
 		{
 		}
 
 		template <typename T>
-		Vec4<T>::Vec4(const T x, const T y, const T z)
+		constexpr Vec4<T>::Vec4(const T x, const T y, const T z)
 			: x(x), y(y), z(z), w(0)
 		{
 		}
 
 		template <typename T>
-		Vec4<T>::Vec4(const T scalar)
+		constexpr Vec4<T>::Vec4(const T scalar)
 			: x(scalar), y(scalar), z(scalar), w(scalar)
 		{
 		}
@@ -56,7 +54,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		T Vec4<T>::SqrMagnitude() const
+		constexpr T Vec4<T>::SqrMagnitude() const
 		{
 			return x * x + y * y + z * z + w * w;
 		}
@@ -82,34 +80,34 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T> Vec4<T>::Renormalized() const
+		constexpr Vec4<T> Vec4<T>::Renormalized() const
 		{
 			T inverseMagnitude = FastInverseSqurRootAroundOne(SqrMagnitude());
 			return Vec4<T>(x * inverseMagnitude, y * inverseMagnitude, z * inverseMagnitude, w * inverseMagnitude);
 		}
 
 		template <typename T>
-		Vec4<T>& Vec4<T>::Renormalize()
+		constexpr Vec4<T>& Vec4<T>::Renormalize()
 		{
 			T inverseMagnitude = FastInverseSqurRootAroundOne(SqrMagnitude());
 			return *this *= inverseMagnitude;
 		}
 
 		template <typename T>
-		Vec4<T> Vec4<T>::Negated() const
+		constexpr Vec4<T> Vec4<T>::Negated() const
 		{
 			return *this * static_cast<T>(-1);
 		}
 
 		template <typename T>
-		Vec4<T>& Vec4<T>::Negate()
+		constexpr Vec4<T>& Vec4<T>::Negate()
 		{
 			*this *= static_cast<T>(-1);
 			return *this;
 		}
 
 		template <typename T>
-		T Vec4<T>::Dot(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
+		constexpr T Vec4<T>::Dot(const Vec4<T>& leftVector, const Vec4<T>& rightVector)
 		{
 			return leftVector.x * rightVector.x + 
 				   leftVector.y * rightVector.y + 
@@ -118,29 +116,19 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T> Vec4<T>::Lerp(const Vec4<T>& leftVector, const Vec4<T>& rightVector, const T t)
+		constexpr Vec4<T> Vec4<T>::Lerp(const Vec4<T>& leftVector, const Vec4<T>& rightVector, const T t)
 		{
 			return leftVector * (static_cast<T>(1) - t) + rightVector * t;
 		}
 
 		template <typename T>
-		Vec4<T> Vec4<T>::Zero()
+		constexpr Vec4<T> Vec4<T>::Zero()
 		{
 			return Vec4<T>();
 		}
 
 		template <typename T>
-		Vec4<T>& Vec4<T>::operator=(const Vec4<T>& vector)
-		{
-			x = vector.x;
-			y = vector.y;
-			z = vector.z;
-			w = vector.w;
-			return *this;
-		}
-
-		template <typename T>
-		Vec4<T>& Vec4<T>::operator+=(const Vec4<T>& vector)
+		constexpr Vec4<T>& Vec4<T>::operator+=(const Vec4<T>& vector)
 		{
 			x += vector.x;
 			y += vector.y;
@@ -150,7 +138,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T>& Vec4<T>::operator-=(const Vec4<T>& vector)
+		constexpr Vec4<T>& Vec4<T>::operator-=(const Vec4<T>& vector)
 		{
 			x -= vector.x;
 			y -= vector.y;
@@ -160,7 +148,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T>& Vec4<T>::operator*=(const T scalar)
+		constexpr Vec4<T>& Vec4<T>::operator*=(const T scalar)
 		{
 			x *= scalar;
 			y *= scalar;
@@ -170,7 +158,7 @@ namespace Visage
 		}
 
 		template <typename T>
-		Vec4<T>& Vec4<T>::operator/=(const T scalar)
+		constexpr Vec4<T>& Vec4<T>::operator/=(const T scalar)
 		{
 			x /= scalar;
 			y /= scalar;
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "MathSimd.h"
+
+#ifdef VISAGE_MATH_SSE
+	namespace Visage
+	{
+		namespace Math
+		{
+			// The batch transforms read arrays of vectors as floats
+			static_assert(sizeof(Vec3<float>) == 3 * sizeof(float), "Vec3<float> has to be three packed floats");
+			static_assert(sizeof(Vec4<float>) == 4 * sizeof(float), "Vec4<float> has to be four packed floats");
+
+			// The specializations of constexpr members fall back to plain arithmetic in constant expressions
+
+			template <>
+			constexpr float Vec4<float>::Dot(const Vec4<float>& leftVector, const Vec4<float>& rightVector)
+			{
+				if (IsConstantEvaluated())
+				{
+					return leftVector.x * rightVector.x + leftVector.y * rightVector.y + leftVector.z * rightVector.z + leftVector.w * rightVector.w;
+				}
+
+				return _mm_cvtss_f32(_mm_dp_ps(_mm_loadu_ps(leftVector.data.data()), _mm_loadu_ps(rightVector.data.data()), 0xF1));
+			}
+
+			template <>
+			constexpr float Vec4<float>::SqrMagnitude() const
+			{
+				return Dot(*this, *this);
+			}
+
+			template <>
+			inline Vec4<float> Vec4<float>::Normalized() const
+			{
+				__m128 vector = _mm_loadu_ps(data.data());
+				__m128 magnitude = _mm_sqrt_ps(_mm_dp_ps(vector, vector, 0xFF));
+
+				assert(!NearEquals(_mm_cvtss_f32(magnitude), 0.0f));
+
+				Vec4<float> result;
+				_mm_storeu_ps(result.data.data(), _mm_div_ps(vector, magnitude));
+				return result;
+			}
+
+			template <>
+			inline Vec4<float>& Vec4<float>::Normalize()
+			{
+				__m128 vector = _mm_loadu_ps(data.data());
+				__m128 magnitude = _mm_sqrt_ps(_mm_dp_ps(vector, vector, 0xFF));
+
+				assert(!NearEquals(_mm_cvtss_f32(magnitude), 0.0f));
+
+				_mm_storeu_ps(data.data(), _mm_div_ps(vector, magnitude));
+				return *this;
+			}
+
+			template <>
+			constexpr Vec4<float>& Vec4<float>::operator+=(const Vec4<float>& vector)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = *this + vector;
+				}
+
+				_mm_storeu_ps(data.data(), _mm_add_ps(_mm_loadu_ps(data.data()), _mm_loadu_ps(vector.data.data())));
+				return *this;
+			}
+
+			template <>
+			constexpr Vec4<float>& Vec4<float>::operator-=(const Vec4<float>& vector)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = *this - vector;
+				}
+
+				_mm_storeu_ps(data.data(), _mm_sub_ps(_mm_loadu_ps(data.data()), _mm_loadu_ps(vector.data.data())));
+				return *this;
+			}
+
+			template <>
+			constexpr Vec4<float>& Vec4<float>::operator*=(const float scalar)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = *this * scalar;
+				}
+
+				_mm_storeu_ps(data.data(), _mm_mul_ps(_mm_loadu_ps(data.data()), _mm_set1_ps(scalar)));
+				return *this;
+			}
+
+			template <>
+			constexpr Vec4<float>& Vec4<float>::operator/=(const float scalar)
+			{
+				if (IsConstantEvaluated())
+				{
+					return *this = *this / scalar;
+				}
+
+				_mm_storeu_ps(data.data(), _mm_div_ps(_mm_loadu_ps(data.data()), _mm_set1_ps(scalar)));
+				return *this;
+			}
+		}
+	}
+#endif
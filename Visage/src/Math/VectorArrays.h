@@ -0,0 +1,25 @@
+#pragma once
+
+namespace Visage
+{
+	namespace Math
+	{
+		// Vectors stored as one array per component, the layout the batch transforms (TransformVectors) read
+		// without shuffling. Inputs use const T, e.g. Vec3Arrays<const float>{ x, y, z }.
+
+		template <typename T>
+		struct Vec3Arrays {
+			T* x;
+			T* y;
+			T* z;
+		};
+
+		template <typename T>
+		struct Vec4Arrays {
+			T* x;
+			T* y;
+			T* z;
+			T* w;
+		};
+	}
+}
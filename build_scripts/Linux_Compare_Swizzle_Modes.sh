@@ -0,0 +1,82 @@
+#!/bin/sh
+# Compares the accessor swizzles with the union ones (VISAGE_MATH_SWIZZLE_UNION): the compile time of
+# Benchmark/codegen/SwizzleProbes.cpp, and the instructions each of its probes compiles to. Exits with 1 if a
+# swizzle costs more instructions than the same operation written with the components.
+#
+# Usage: build_scripts/Linux_Compare_Swizzle_Modes.sh [extra compiler flags, e.g. -mavx2 -mfma]
+# CXX picks the compiler, g++ by default.
+
+cd "$(dirname "$0")/.." || exit 1
+
+CXX="${CXX:-g++}"
+SOURCE="Benchmark/codegen/SwizzleProbes.cpp"
+PROBES="Read Write Add Scale Swap"
+RUNS=5
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+# Fastest of RUNS compilations in milliseconds
+time_compile()
+{
+	best=""
+	run=0
+	while [ "$run" -lt "$RUNS" ]; do
+		start=$(date +%s%N)
+		"$CXX" "$@" || exit 1
+		elapsed=$(( ($(date +%s%N) - start) / 1000000 ))
+		if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+			best=$elapsed
+		fi
+		run=$((run + 1))
+	done
+	echo "$best"
+}
+
+# Instructions of one function in the disassembly, without the padding after it
+count_instructions()
+{
+	awk -v symbol="<$2>:" '
+		$2 == symbol { inside = 1; next }
+		inside && NF == 0 { exit }
+		inside && $0 ~ /^ *[0-9a-f]+:\t/ && $0 !~ /\tnop/ { count++ }
+		END { print count + 0 }
+	' "$1"
+}
+
+status=0
+
+printf "%-10s %16s %16s\n" "mode" "syntax only ms" "-O2 object ms"
+
+for mode in accessor union; do
+	if [ "$mode" = union ]; then
+		MODE_FLAGS="-DVISAGE_MATH_SWIZZLE_UNION"
+	else
+		MODE_FLAGS=""
+	fi
+
+	FLAGS="-std=c++17 -IVisage/src $MODE_FLAGS $*"
+
+	syntax=$(time_compile $FLAGS -fsyntax-only "$SOURCE") || exit 1
+	object=$(time_compile $FLAGS -O2 -ffunction-sections -c "$SOURCE" -o "$WORK_DIR/$mode.o") || exit 1
+	printf "%-10s %16s %16s\n" "$mode" "$syntax" "$object"
+
+	objdump -d --no-show-raw-insn "$WORK_DIR/$mode.o" > "$WORK_DIR/$mode.s" || exit 1
+done
+
+echo
+printf "%-10s %10s %10s %10s\n" "probe" "reference" "accessor" "union"
+
+for probe in $PROBES; do
+	reference=$(count_instructions "$WORK_DIR/accessor.s" "Reference$probe")
+	accessor=$(count_instructions "$WORK_DIR/accessor.s" "Probe$probe")
+	union=$(count_instructions "$WORK_DIR/union.s" "Probe$probe")
+	unionReference=$(count_instructions "$WORK_DIR/union.s" "Reference$probe")
+	printf "%-10s %10s %10s %10s\n" "$probe" "$reference" "$accessor" "$union"
+
+	if [ "$accessor" -gt "$reference" ] || [ "$union" -gt "$unionReference" ]; then
+		echo "  $probe costs more through a swizzle than through the components"
+		status=1
+	fi
+done
+
+exit $status
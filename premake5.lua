@@ -1,3 +1,33 @@
+newoption
+{
+    trigger = "with-jemalloc",
+    description = "Adds jemalloc as a baseline to the allocator benchmark"
+}
+
+newoption
+{
+    trigger = "with-mimalloc",
+    description = "Adds mimalloc as a baseline to the allocator benchmark"
+}
+
+newoption
+{
+    trigger = "math-simd",
+    value = "ISA",
+    description = "Instruction set the float math types are specialized for, scalar if not set",
+    allowed =
+    {
+        { "sse4.1", "SSE4.1" },
+        { "avx2", "AVX2 and FMA" }
+    }
+}
+
+newoption
+{
+    trigger = "math-swizzle-union",
+    description = "Declares the vector swizzles as union members (v.xy) rather than accessors (v.xy())"
+}
+
 workspace "Visage"
     architecture "x86_64"
     startproject "Game"
@@ -13,6 +43,32 @@ workspace "Visage"
         "MultiProcessorCompile"
     }
 
+    -- Applies to every project, the math specializations are inline and have to match across all of them
+    filter "options:math-simd=sse4.1"
+        vectorextensions "SSE4.1"
+
+        defines
+        {
+            "VISAGE_MATH_SSE"
+        }
+
+    filter "options:math-simd=avx2"
+        vectorextensions "AVX2"
+
+    filter { "options:math-simd=avx2", "system:linux" }
+        buildoptions
+        {
+            "-mfma"
+        }
+
+    filter "options:math-swizzle-union"
+        defines
+        {
+            "VISAGE_MATH_SWIZZLE_UNION"
+        }
+
+    filter {}
+
     outputDir = "%{cfg.buildcfg}_%{cfg.system}_%{cfg.architecture}"
 
     vendorIncludes = {}
@@ -112,6 +168,82 @@ workspace "Visage"
             "Visage"
         }
 
+        filter "system:linux"
+            systemversion "latest"
+
+            links
+            {
+                "Glad",
+                "GLFW",
+                "dl",
+                "pthread",
+                "X11"
+            }
+
+        filter "system:windows"
+            systemversion "latest"
+
+        filter "configurations:Debug"
+            runtime "Debug"
+            symbols "On"
+
+            defines
+            {
+                "DEBUG"
+            }
+
+        filter "configurations:Release"
+            runtime "Release"
+            optimize "On"
+
+    project "Benchmark"
+        location "Benchmark"
+        kind "ConsoleApp"
+        language "C++"
+        cppdialect "C++17"
+        staticruntime "on"
+        
+        targetdir ("bin/" .. outputDir .. "/%{prj.name}")
+        objdir ("obj/" .. outputDir .. "/%{prj.name}")
+
+        files
+        {
+            "%{prj.name}/src/**.cpp",
+            "%{prj.name}/src/**.h"
+        }
+
+        includedirs
+        {
+            "%{wks.name}/src"
+        }
+
+        links
+        {
+            "Visage"
+        }
+
+        filter "options:with-jemalloc"
+            defines
+            {
+                "VISAGE_BENCHMARK_JEMALLOC"
+            }
+
+            links
+            {
+                "jemalloc"
+            }
+
+        filter "options:with-mimalloc"
+            defines
+            {
+                "VISAGE_BENCHMARK_MIMALLOC"
+            }
+
+            links
+            {
+                "mimalloc"
+            }
+
         filter "system:linux"
             systemversion "latest"
 